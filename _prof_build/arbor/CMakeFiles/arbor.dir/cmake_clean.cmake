@@ -0,0 +1,143 @@
+file(REMOVE_RECURSE
+  "../lib/libarbor.a"
+  "../lib/libarbor.pdb"
+  "CMakeFiles/arbor.dir/__/mechanisms/default_catalogue.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/default_catalogue.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/exp2syn_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/exp2syn_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/expsyn_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/expsyn_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/hh_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/hh_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/kamt_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/kamt_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/kdrmt_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/kdrmt_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/nax_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/nax_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/nernst_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/nernst_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/pas_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/pas_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/test_ca_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/test_ca_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/test_kin1_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/test_kin1_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/test_kinlva_cpu.cpp.o"
+  "CMakeFiles/arbor.dir/__/mechanisms/generated/test_kinlva_cpu.cpp.o.d"
+  "CMakeFiles/arbor.dir/arbexcept.cpp.o"
+  "CMakeFiles/arbor.dir/arbexcept.cpp.o.d"
+  "CMakeFiles/arbor.dir/assert.cpp.o"
+  "CMakeFiles/arbor.dir/assert.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/gpu/forest.cpp.o"
+  "CMakeFiles/arbor.dir/backends/gpu/forest.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/multicore/mechanism.cpp.o"
+  "CMakeFiles/arbor.dir/backends/multicore/mechanism.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/multicore/shared_state.cpp.o"
+  "CMakeFiles/arbor.dir/backends/multicore/shared_state.cpp.o.d"
+  "CMakeFiles/arbor.dir/backends/multicore/stimulus.cpp.o"
+  "CMakeFiles/arbor.dir/backends/multicore/stimulus.cpp.o.d"
+  "CMakeFiles/arbor.dir/benchmark_cell_group.cpp.o"
+  "CMakeFiles/arbor.dir/benchmark_cell_group.cpp.o.d"
+  "CMakeFiles/arbor.dir/builtin_mechanisms.cpp.o"
+  "CMakeFiles/arbor.dir/builtin_mechanisms.cpp.o.d"
+  "CMakeFiles/arbor.dir/cable_cell.cpp.o"
+  "CMakeFiles/arbor.dir/cable_cell.cpp.o.d"
+  "CMakeFiles/arbor.dir/cable_cell_param.cpp.o"
+  "CMakeFiles/arbor.dir/cable_cell_param.cpp.o.d"
+  "CMakeFiles/arbor.dir/cell_group_factory.cpp.o"
+  "CMakeFiles/arbor.dir/cell_group_factory.cpp.o.d"
+  "CMakeFiles/arbor.dir/common_types_io.cpp.o"
+  "CMakeFiles/arbor.dir/common_types_io.cpp.o.d"
+  "CMakeFiles/arbor.dir/communication/communicator.cpp.o"
+  "CMakeFiles/arbor.dir/communication/communicator.cpp.o.d"
+  "CMakeFiles/arbor.dir/communication/dry_run_context.cpp.o"
+  "CMakeFiles/arbor.dir/communication/dry_run_context.cpp.o.d"
+  "CMakeFiles/arbor.dir/event_binner.cpp.o"
+  "CMakeFiles/arbor.dir/event_binner.cpp.o.d"
+  "CMakeFiles/arbor.dir/execution_context.cpp.o"
+  "CMakeFiles/arbor.dir/execution_context.cpp.o.d"
+  "CMakeFiles/arbor.dir/fvm_layout.cpp.o"
+  "CMakeFiles/arbor.dir/fvm_layout.cpp.o.d"
+  "CMakeFiles/arbor.dir/fvm_lowered_cell_blocked.cpp.o"
+  "CMakeFiles/arbor.dir/fvm_lowered_cell_blocked.cpp.o.d"
+  "CMakeFiles/arbor.dir/fvm_lowered_cell_impl.cpp.o"
+  "CMakeFiles/arbor.dir/fvm_lowered_cell_impl.cpp.o.d"
+  "CMakeFiles/arbor.dir/gpu_context.cpp.o"
+  "CMakeFiles/arbor.dir/gpu_context.cpp.o.d"
+  "CMakeFiles/arbor.dir/hardware/memory.cpp.o"
+  "CMakeFiles/arbor.dir/hardware/memory.cpp.o.d"
+  "CMakeFiles/arbor.dir/hardware/power.cpp.o"
+  "CMakeFiles/arbor.dir/hardware/power.cpp.o.d"
+  "CMakeFiles/arbor.dir/io/locked_ostream.cpp.o"
+  "CMakeFiles/arbor.dir/io/locked_ostream.cpp.o.d"
+  "CMakeFiles/arbor.dir/io/serialize_hex.cpp.o"
+  "CMakeFiles/arbor.dir/io/serialize_hex.cpp.o.d"
+  "CMakeFiles/arbor.dir/lif_cell_group.cpp.o"
+  "CMakeFiles/arbor.dir/lif_cell_group.cpp.o.d"
+  "CMakeFiles/arbor.dir/mc_cell_group.cpp.o"
+  "CMakeFiles/arbor.dir/mc_cell_group.cpp.o.d"
+  "CMakeFiles/arbor.dir/mechcat.cpp.o"
+  "CMakeFiles/arbor.dir/mechcat.cpp.o.d"
+  "CMakeFiles/arbor.dir/memory/cuda_wrappers.cpp.o"
+  "CMakeFiles/arbor.dir/memory/cuda_wrappers.cpp.o.d"
+  "CMakeFiles/arbor.dir/memory/util.cpp.o"
+  "CMakeFiles/arbor.dir/memory/util.cpp.o.d"
+  "CMakeFiles/arbor.dir/merge_events.cpp.o"
+  "CMakeFiles/arbor.dir/merge_events.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/em_morphology.cpp.o"
+  "CMakeFiles/arbor.dir/morph/em_morphology.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/label_dict.cpp.o"
+  "CMakeFiles/arbor.dir/morph/label_dict.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/locset.cpp.o"
+  "CMakeFiles/arbor.dir/morph/locset.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/mbranch.cpp.o"
+  "CMakeFiles/arbor.dir/morph/mbranch.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/morphology.cpp.o"
+  "CMakeFiles/arbor.dir/morph/morphology.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/primitives.cpp.o"
+  "CMakeFiles/arbor.dir/morph/primitives.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/region.cpp.o"
+  "CMakeFiles/arbor.dir/morph/region.cpp.o.d"
+  "CMakeFiles/arbor.dir/morph/sample_tree.cpp.o"
+  "CMakeFiles/arbor.dir/morph/sample_tree.cpp.o.d"
+  "CMakeFiles/arbor.dir/partition_load_balance.cpp.o"
+  "CMakeFiles/arbor.dir/partition_load_balance.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/clock.cpp.o"
+  "CMakeFiles/arbor.dir/profile/clock.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/memory_meter.cpp.o"
+  "CMakeFiles/arbor.dir/profile/memory_meter.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/meter_manager.cpp.o"
+  "CMakeFiles/arbor.dir/profile/meter_manager.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/power_meter.cpp.o"
+  "CMakeFiles/arbor.dir/profile/power_meter.cpp.o.d"
+  "CMakeFiles/arbor.dir/profile/profiler.cpp.o"
+  "CMakeFiles/arbor.dir/profile/profiler.cpp.o.d"
+  "CMakeFiles/arbor.dir/schedule.cpp.o"
+  "CMakeFiles/arbor.dir/schedule.cpp.o.d"
+  "CMakeFiles/arbor.dir/simulation.cpp.o"
+  "CMakeFiles/arbor.dir/simulation.cpp.o.d"
+  "CMakeFiles/arbor.dir/spike_event_io.cpp.o"
+  "CMakeFiles/arbor.dir/spike_event_io.cpp.o.d"
+  "CMakeFiles/arbor.dir/spike_source_cell_group.cpp.o"
+  "CMakeFiles/arbor.dir/spike_source_cell_group.cpp.o.d"
+  "CMakeFiles/arbor.dir/swcio.cpp.o"
+  "CMakeFiles/arbor.dir/swcio.cpp.o.d"
+  "CMakeFiles/arbor.dir/thread_private_spike_store.cpp.o"
+  "CMakeFiles/arbor.dir/thread_private_spike_store.cpp.o.d"
+  "CMakeFiles/arbor.dir/threading/threading.cpp.o"
+  "CMakeFiles/arbor.dir/threading/threading.cpp.o.d"
+  "CMakeFiles/arbor.dir/tree.cpp.o"
+  "CMakeFiles/arbor.dir/tree.cpp.o.d"
+  "CMakeFiles/arbor.dir/util/hostname.cpp.o"
+  "CMakeFiles/arbor.dir/util/hostname.cpp.o.d"
+  "CMakeFiles/arbor.dir/util/unwind.cpp.o"
+  "CMakeFiles/arbor.dir/util/unwind.cpp.o.d"
+  "CMakeFiles/arbor.dir/version.cpp.o"
+  "CMakeFiles/arbor.dir/version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arbor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
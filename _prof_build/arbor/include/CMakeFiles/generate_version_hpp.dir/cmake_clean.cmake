@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_version_hpp"
+  "_always_rebuild"
+  "arbor/version.hpp"
+  "version.hpp-test"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/generate_version_hpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+#pragma once
+
+#define ARB_VERSION "0.2.3-dev"
+#define ARB_SOURCE_ID "2026-10-18 18:24:37 +0000 fc60ab01143cc1b0f2e515bb6fd17d3d45e9f895 modified"
+
+namespace arb {
+extern const char version[];
+extern const char source_id[];
+}
+#define ARB_PROFILE_ENABLED
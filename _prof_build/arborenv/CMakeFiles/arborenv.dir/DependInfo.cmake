@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/arborenv/affinity.cpp" "arborenv/CMakeFiles/arborenv.dir/affinity.cpp.o" "gcc" "arborenv/CMakeFiles/arborenv.dir/affinity.cpp.o.d"
+  "/root/repo/arborenv/concurrency.cpp" "arborenv/CMakeFiles/arborenv.dir/concurrency.cpp.o" "gcc" "arborenv/CMakeFiles/arborenv.dir/concurrency.cpp.o.d"
+  "/root/repo/arborenv/default_gpu.cpp" "arborenv/CMakeFiles/arborenv.dir/default_gpu.cpp.o" "gcc" "arborenv/CMakeFiles/arborenv.dir/default_gpu.cpp.o.d"
+  "/root/repo/arborenv/private_gpu.cpp" "arborenv/CMakeFiles/arborenv.dir/private_gpu.cpp.o" "gcc" "arborenv/CMakeFiles/arborenv.dir/private_gpu.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/arbor/CMakeFiles/arbor.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
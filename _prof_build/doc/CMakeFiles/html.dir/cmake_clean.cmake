@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "_doctrees"
+  "html"
+  "CMakeFiles/html"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/html.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/example/dryrun/dryrun.cpp" "example/dryrun/CMakeFiles/dryrun.dir/dryrun.cpp.o" "gcc" "example/dryrun/CMakeFiles/dryrun.dir/dryrun.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/arbor/CMakeFiles/arbor.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/arborenv/CMakeFiles/arborenv.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/sup/CMakeFiles/arbor-sup.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
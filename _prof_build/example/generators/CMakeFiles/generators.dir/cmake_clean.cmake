@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/generators"
+  "../../bin/generators.pdb"
+  "CMakeFiles/generators.dir/generators.cpp.o"
+  "CMakeFiles/generators.dir/generators.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/single-cell"
+  "../../bin/single-cell.pdb"
+  "CMakeFiles/single-cell.dir/single.cpp.o"
+  "CMakeFiles/single-cell.dir/single.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/single-cell.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
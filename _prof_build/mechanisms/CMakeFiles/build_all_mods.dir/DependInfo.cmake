@@ -0,0 +1,56 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_prof_build/mechanisms/generated/exp2syn_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/exp2syn.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/exp2syn_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/exp2syn.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/exp2syn_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/exp2syn.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/expsyn_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/expsyn.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/expsyn_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/expsyn.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/expsyn_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/expsyn.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/hh_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/hh.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/hh_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/hh.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/hh_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/hh.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/kamt_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/kamt.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/kamt_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/kamt.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/kamt_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/kamt.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/kdrmt_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/kdrmt.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/kdrmt_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/kdrmt.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/kdrmt_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/kdrmt.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/nax_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/nax.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/nax_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/nax.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/nax_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/nax.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/nernst_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/nernst.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/nernst_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/nernst.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/nernst_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/nernst.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/pas_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/pas.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/pas_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/pas.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/pas_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/pas.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_ca_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/test_ca.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_ca_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/test_ca.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_ca_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/test_ca.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_kin1_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/test_kin1.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_kin1_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/test_kin1.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_kin1_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/test_kin1.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_kinlva_cpu.cpp" "/root/repo/_prof_build/mechanisms/generated/test_kinlva.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_kinlva_gpu.cpp" "/root/repo/_prof_build/mechanisms/generated/test_kinlva.hpp"
+  "/root/repo/_prof_build/mechanisms/generated/test_kinlva_gpu.cu" "/root/repo/_prof_build/mechanisms/generated/test_kinlva.hpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,52 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_all_mods"
+  "generated/exp2syn.hpp"
+  "generated/exp2syn_cpu.cpp"
+  "generated/exp2syn_gpu.cpp"
+  "generated/exp2syn_gpu.cu"
+  "generated/expsyn.hpp"
+  "generated/expsyn_cpu.cpp"
+  "generated/expsyn_gpu.cpp"
+  "generated/expsyn_gpu.cu"
+  "generated/hh.hpp"
+  "generated/hh_cpu.cpp"
+  "generated/hh_gpu.cpp"
+  "generated/hh_gpu.cu"
+  "generated/kamt.hpp"
+  "generated/kamt_cpu.cpp"
+  "generated/kamt_gpu.cpp"
+  "generated/kamt_gpu.cu"
+  "generated/kdrmt.hpp"
+  "generated/kdrmt_cpu.cpp"
+  "generated/kdrmt_gpu.cpp"
+  "generated/kdrmt_gpu.cu"
+  "generated/nax.hpp"
+  "generated/nax_cpu.cpp"
+  "generated/nax_gpu.cpp"
+  "generated/nax_gpu.cu"
+  "generated/nernst.hpp"
+  "generated/nernst_cpu.cpp"
+  "generated/nernst_gpu.cpp"
+  "generated/nernst_gpu.cu"
+  "generated/pas.hpp"
+  "generated/pas_cpu.cpp"
+  "generated/pas_gpu.cpp"
+  "generated/pas_gpu.cu"
+  "generated/test_ca.hpp"
+  "generated/test_ca_cpu.cpp"
+  "generated/test_ca_gpu.cpp"
+  "generated/test_ca_gpu.cu"
+  "generated/test_kin1.hpp"
+  "generated/test_kin1_cpu.cpp"
+  "generated/test_kin1_gpu.cpp"
+  "generated/test_kin1_gpu.cu"
+  "generated/test_kinlva.hpp"
+  "generated/test_kinlva_cpu.cpp"
+  "generated/test_kinlva_gpu.cpp"
+  "generated/test_kinlva_gpu.cu"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_all_mods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,53 @@
+// Automatically generated by:
+// /root/repo/mechanisms/generate_default_catalogue -A arbor -I /root/repo/_prof_build/mechanisms/generated -o /root/repo/_prof_build/mechanisms/default_catalogue.cpp -B multicore pas hh expsyn exp2syn nernst test_kin1 test_kinlva test_ca nax kdrmt kamt
+
+#include <arbor/mechcat.hpp>
+#include "backends/multicore/fvm.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/pas.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/hh.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/expsyn.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/exp2syn.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/nernst.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/test_kin1.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/test_kinlva.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/test_ca.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/nax.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/kdrmt.hpp"
+#include "/root/repo/_prof_build/mechanisms/generated/kamt.hpp"
+
+namespace arb {
+
+mechanism_catalogue build_default_catalogue() {
+    mechanism_catalogue cat;
+
+    cat.add("pas", mechanism_pas_info());
+    cat.add("hh", mechanism_hh_info());
+    cat.add("expsyn", mechanism_expsyn_info());
+    cat.add("exp2syn", mechanism_exp2syn_info());
+    cat.add("nernst", mechanism_nernst_info());
+    cat.add("test_kin1", mechanism_test_kin1_info());
+    cat.add("test_kinlva", mechanism_test_kinlva_info());
+    cat.add("test_ca", mechanism_test_ca_info());
+    cat.add("nax", mechanism_nax_info());
+    cat.add("kdrmt", mechanism_kdrmt_info());
+    cat.add("kamt", mechanism_kamt_info());
+    cat.register_implementation("pas", make_mechanism_pas<multicore::backend>());
+    cat.register_implementation("hh", make_mechanism_hh<multicore::backend>());
+    cat.register_implementation("expsyn", make_mechanism_expsyn<multicore::backend>());
+    cat.register_implementation("exp2syn", make_mechanism_exp2syn<multicore::backend>());
+    cat.register_implementation("nernst", make_mechanism_nernst<multicore::backend>());
+    cat.register_implementation("test_kin1", make_mechanism_test_kin1<multicore::backend>());
+    cat.register_implementation("test_kinlva", make_mechanism_test_kinlva<multicore::backend>());
+    cat.register_implementation("test_ca", make_mechanism_test_ca<multicore::backend>());
+    cat.register_implementation("nax", make_mechanism_nax<multicore::backend>());
+    cat.register_implementation("kdrmt", make_mechanism_kdrmt<multicore::backend>());
+    cat.register_implementation("kamt", make_mechanism_kamt<multicore::backend>());
+    return cat;
+}
+
+const mechanism_catalogue& global_default_catalogue() {
+    static mechanism_catalogue cat = build_default_catalogue();
+    return cat;
+}
+
+} // namespace arb
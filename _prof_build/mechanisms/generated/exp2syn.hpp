@@ -0,0 +1,43 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_exp2syn();
+
+inline const ::arb::mechanism_info& mechanism_exp2syn_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+
+        },
+        // parameters
+        {
+            {"tau1", {spec::parameter, "ms", 0.5}},
+            {"tau2", {spec::parameter, "ms", 2}},
+            {"e", {spec::parameter, "mV", 0}}
+        },
+        // state variables
+        {
+            {"A", {spec::state, "", 0}},
+            {"B", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        1
+    };
+
+    return info;
+}
+
+} // namespace arb
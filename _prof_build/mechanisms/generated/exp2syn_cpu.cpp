@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_exp2syn: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "exp2syn"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::point; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_exp2syn()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+    void deliver_events(deliverable_event_stream::state events) override;
+    void net_receive(int i_, value_type weight);
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"B", &B},
+            {"tau1", &tau1},
+            {"A", &A},
+            {"tau2", &tau2},
+            {"e", &e},
+            {"factor", &factor}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"tau1", 0.5},
+            {"tau2", 2},
+            {"e", 0.}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"B", &B},
+            {"A", &A}
+        };
+    }
+
+private:
+    value_type* B;
+    value_type* tau1;
+    value_type* A;
+    value_type* tau2;
+    value_type* e;
+    value_type* factor;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_exp2syn();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_exp2syn<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_exp2syn());
+}
+
+void mechanism_cpu_exp2syn::deliver_events(deliverable_event_stream::state events) {
+    auto ncell = events.n_streams();
+    for (size_type c = 0; c<ncell; ++c) {
+        auto begin = events.begin_marked(c);
+        auto end = events.end_marked(c);
+        for (auto p = begin; p<end; ++p) {
+            if (p->mech_id==mechanism_id_) net_receive(p->mech_index, p->weight);
+        }
+    }
+}
+
+void mechanism_cpu_exp2syn::net_receive(int i_, value_type weight) {
+    A[i_] = A[i_]+weight*factor[i_];
+    B[i_] = B[i_]+weight*factor[i_];
+}
+
+void mechanism_cpu_exp2syn::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type tp;
+        A[i_] =  0.;
+        B[i_] =  0.;
+        tp = tau1[i_]*tau2[i_]/(tau2[i_]-tau1[i_])*log(tau2[i_]/tau1[i_]);
+        factor[i_] =  1/( -exp( -tp/tau1[i_])+exp( -tp/tau2[i_]));
+    }
+}
+
+void mechanism_cpu_exp2syn::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_exp2syn");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type ll3_, ll1_, a_1_, ll2_, ll0_, a_0_;
+        a_0_ =  -1/tau1[i_];
+        ll2_ = a_0_*dt;
+        ll0_ = ( 1+ 0.5*ll2_)/( 1- 0.5*ll2_);
+        A[i_] = A[i_]*ll0_;
+        a_1_ =  -1/tau2[i_];
+        ll3_ = a_1_*dt;
+        ll1_ = ( 1+ 0.5*ll3_)/( 1- 0.5*ll3_);
+        B[i_] = B[i_]*ll1_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_exp2syn::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_exp2syn");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type v = vec_v_[node_index_[i_]];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type i;
+        current_ =  0.;
+        conductivity_ =  0.;
+        i = (B[i_]-A[i_])*(v-e[i_]);
+        current_ = current_+i;
+        conductivity_ = conductivity_+(B[i_]-A[i_]);
+        vec_g_[node_index_[i_]] = fma(weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_exp2syn::write_ions() {
+}
+
+} // namespace arb
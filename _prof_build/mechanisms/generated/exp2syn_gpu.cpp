@@ -0,0 +1,94 @@
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using deliverable_event_stream_state =
+    ::arb::multi_event_stream_state<::arb::deliverable_event_data>;
+
+struct mechanism_gpu_exp2syn_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* B;
+    value_type* tau1;
+    value_type* A;
+    value_type* tau2;
+    value_type* e;
+    value_type* factor;
+};
+
+void mechanism_gpu_exp2syn_nrn_init_(mechanism_gpu_exp2syn_pp_&);
+void mechanism_gpu_exp2syn_nrn_state_(mechanism_gpu_exp2syn_pp_&);
+void mechanism_gpu_exp2syn_nrn_current_(mechanism_gpu_exp2syn_pp_&);
+void mechanism_gpu_exp2syn_write_ions_(mechanism_gpu_exp2syn_pp_&);
+void mechanism_gpu_exp2syn_deliver_events_(int mech_id, mechanism_gpu_exp2syn_pp_&, deliverable_event_stream_state events);
+
+class mechanism_gpu_exp2syn: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "exp2syn"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::point; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_exp2syn()); }
+
+    void nrn_init() override {
+        mechanism_gpu_exp2syn_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_exp2syn_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_exp2syn_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_exp2syn_write_ions_(pp_);
+    }
+
+    void deliver_events(deliverable_event_stream_state events) override {
+        mechanism_gpu_exp2syn_deliver_events_(mechanism_id_, pp_, events);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() { return &pp_; }
+
+    mechanism_field_table field_table() override {
+        return {
+            {"B", &pp_.B},
+            {"tau1", &pp_.tau1},
+            {"A", &pp_.A},
+            {"tau2", &pp_.tau2},
+            {"e", &pp_.e},
+            {"factor", &pp_.factor}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"tau1", 0.5},
+            {"tau2", 2},
+            {"e", 0.}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"B", &pp_.B},
+            {"A", &pp_.A}
+        };
+    }
+
+private:
+    mechanism_gpu_exp2syn_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_exp2syn();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_exp2syn<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_exp2syn());
+}
+
+} // namespace arb
@@ -0,0 +1,135 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+#include <backends/gpu/reduce_by_key.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+using deliverable_event_stream_state =
+    ::arb::multi_event_stream_state<::arb::deliverable_event_data>;
+
+struct mechanism_gpu_exp2syn_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* B;
+    value_type* tau1;
+    value_type* A;
+    value_type* tau2;
+    value_type* e;
+    value_type* factor;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_exp2syn_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        value_type tp;
+        params_.A[tid_] =  0.;
+        params_.B[tid_] =  0.;
+        tp = params_.tau1[tid_]*params_.tau2[tid_]/(params_.tau2[tid_]-params_.tau1[tid_])*log(params_.tau2[tid_]/params_.tau1[tid_]);
+        params_.factor[tid_] =  1/( -exp( -tp/params_.tau1[tid_])+exp( -tp/params_.tau2[tid_]));
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_exp2syn_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type ll3_, ll1_, a_1_, ll2_, ll0_, a_0_;
+        a_0_ =  -1/params_.tau1[tid_];
+        ll2_ = a_0_*dt;
+        ll0_ = ( 1+ 0.5*ll2_)/( 1- 0.5*ll2_);
+        params_.A[tid_] = params_.A[tid_]*ll0_;
+        a_1_ =  -1/params_.tau2[tid_];
+        ll3_ = a_1_*dt;
+        ll1_ = ( 1+ 0.5*ll3_)/( 1- 0.5*ll3_);
+        params_.B[tid_] = params_.B[tid_]*ll1_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_exp2syn_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    unsigned lane_mask_ = __ballot_sync(0xffffffff, tid_<n_);
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type i;
+        current_ =  0.;
+        conductivity_ =  0.;
+        i = (params_.B[tid_]-params_.A[tid_])*(v-params_.e[tid_]);
+        current_ = current_+i;
+        conductivity_ = conductivity_+(params_.B[tid_]-params_.A[tid_]);
+        ::arb::gpu::reduce_by_key(params_.weight_[tid_]*conductivity_,params_.vec_g_, node_index_i_, lane_mask_);
+        ::arb::gpu::reduce_by_key(params_.weight_[tid_]*current_,params_.vec_i_, node_index_i_, lane_mask_);
+    }
+}
+
+__global__
+void deliver_events(int mech_id_, mechanism_gpu_exp2syn_pp_ params_, deliverable_event_stream_state events) {
+    auto tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    auto const ncell_ = events.n;
+
+    if(tid_<ncell_) {
+        auto begin = events.ev_data+events.begin_offset[tid_];
+        auto end = events.ev_data+events.end_offset[tid_];
+        for (auto p = begin; p<end; ++p) {
+            if (p->mech_id==mech_id_) {
+                auto tid_ = p->mech_index;
+                auto weight = p->weight;
+                params_.A[tid_] = params_.A[tid_]+weight*params_.factor[tid_];
+                params_.B[tid_] = params_.B[tid_]+weight*params_.factor[tid_];
+            }
+        }
+    }
+}
+} // namspace
+
+void mechanism_gpu_exp2syn_nrn_init_(mechanism_gpu_exp2syn_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_exp2syn_nrn_current_(mechanism_gpu_exp2syn_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_exp2syn_nrn_state_(mechanism_gpu_exp2syn_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_exp2syn_write_ions_(mechanism_gpu_exp2syn_pp_& p) {}
+
+void mechanism_gpu_exp2syn_deliver_events_(int mech_id, mechanism_gpu_exp2syn_pp_& p, deliverable_event_stream_state events) {
+    auto n = events.n;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    deliver_events<<<grid_dim, block_dim>>>(mech_id, p, events);
+}
+
+} // namespace arb
@@ -0,0 +1,41 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_expsyn();
+
+inline const ::arb::mechanism_info& mechanism_expsyn_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+
+        },
+        // parameters
+        {
+            {"tau", {spec::parameter, "ms", 2.0}},
+            {"e", {spec::parameter, "mV", 0}}
+        },
+        // state variables
+        {
+            {"g", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        1
+    };
+
+    return info;
+}
+
+} // namespace arb
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_expsyn: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "expsyn"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::point; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_expsyn()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+    void deliver_events(deliverable_event_stream::state events) override;
+    void net_receive(int i_, value_type weight);
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"g", &g},
+            {"tau", &tau},
+            {"e", &e}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"tau", 2},
+            {"e", 0.}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"g", &g}
+        };
+    }
+
+private:
+    value_type* g;
+    value_type* tau;
+    value_type* e;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_expsyn();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_expsyn<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_expsyn());
+}
+
+void mechanism_cpu_expsyn::deliver_events(deliverable_event_stream::state events) {
+    auto ncell = events.n_streams();
+    for (size_type c = 0; c<ncell; ++c) {
+        auto begin = events.begin_marked(c);
+        auto end = events.end_marked(c);
+        for (auto p = begin; p<end; ++p) {
+            if (p->mech_id==mechanism_id_) net_receive(p->mech_index, p->weight);
+        }
+    }
+}
+
+void mechanism_cpu_expsyn::net_receive(int i_, value_type weight) {
+    g[i_] = g[i_]+weight;
+}
+
+void mechanism_cpu_expsyn::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        g[i_] =  0.;
+    }
+}
+
+void mechanism_cpu_expsyn::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_expsyn");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type ll1_, ll0_, a_0_;
+        a_0_ =  -1/tau[i_];
+        ll1_ = a_0_*dt;
+        ll0_ = ( 1+ 0.5*ll1_)/( 1- 0.5*ll1_);
+        g[i_] = g[i_]*ll0_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_expsyn::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_expsyn");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type v = vec_v_[node_index_[i_]];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type i;
+        current_ =  0.;
+        conductivity_ =  0.;
+        i = g[i_]*(v-e[i_]);
+        current_ = current_+i;
+        conductivity_ = conductivity_+g[i_];
+        vec_g_[node_index_[i_]] = fma(weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_expsyn::write_ions() {
+}
+
+} // namespace arb
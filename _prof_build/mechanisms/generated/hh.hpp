@@ -0,0 +1,46 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_hh();
+
+inline const ::arb::mechanism_info& mechanism_hh_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+
+        },
+        // parameters
+        {
+            {"gnabar", {spec::parameter, "S / cm2", .12}},
+            {"gkbar", {spec::parameter, "S / cm2", .036}},
+            {"gl", {spec::parameter, "S / cm2", .0003}},
+            {"el", {spec::parameter, "mV", -54.3}}
+        },
+        // state variables
+        {
+            {"m", {spec::state, "", 0}},
+            {"h", {spec::state, "", 0}},
+            {"n", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"na", {false, false, true, false, false, false, 0}},
+            {"k", {false, false, true, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace arb
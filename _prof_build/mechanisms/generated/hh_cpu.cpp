@@ -0,0 +1,224 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_hh: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "hh"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_hh()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"hinf", &hinf},
+            {"gl", &gl},
+            {"gnabar", &gnabar},
+            {"n", &n},
+            {"h", &h},
+            {"m", &m},
+            {"ninf", &ninf},
+            {"gna", &gna},
+            {"el", &el},
+            {"ntau", &ntau},
+            {"gk", &gk},
+            {"minf", &minf},
+            {"mtau", &mtau},
+            {"htau", &htau},
+            {"gkbar", &gkbar}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gl", 0.00029999999999999997},
+            {"gnabar", 0.12},
+            {"el", -54.299999999999997},
+            {"gkbar", 0.035999999999999997}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"n", &n},
+            {"h", &h},
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &ion_na_},
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &ion_na_index_},
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type* hinf;
+    value_type* gl;
+    value_type* gnabar;
+    value_type* n;
+    value_type* h;
+    value_type* m;
+    value_type* ninf;
+    value_type* gna;
+    value_type* el;
+    value_type* ntau;
+    value_type* gk;
+    value_type* minf;
+    value_type* mtau;
+    value_type* htau;
+    value_type* gkbar;
+    ion_state_view ion_na_;
+    iarray ion_na_index_;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+    void rates(int i_, value_type v, value_type celsius);
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_hh();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_hh<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_hh());
+}
+
+void mechanism_cpu_hh::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        rates(i_, v, celsius);
+        m[i_] = minf[i_];
+        h[i_] = hinf[i_];
+        n[i_] = ninf[i_];
+    }
+}
+
+void mechanism_cpu_hh::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_hh");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type v = vec_v_[node_index_[i_]];
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type ll2_, a_0_, b_0_, ll0_, ll3_, b_1_, ll1_, ll5_, ll4_, a_1_, a_2_, b_2_;
+        rates(i_, v, celsius);
+        a_0_ = mtau[i_];
+        b_0_ = minf[i_];
+        ll3_ =  -dt/a_0_;
+        ll0_ = ( 1+ 0.5*ll3_)/( 1- 0.5*ll3_);
+        m[i_] = b_0_+(m[i_]-b_0_)*ll0_;
+        a_1_ = htau[i_];
+        b_1_ = hinf[i_];
+        ll4_ =  -dt/a_1_;
+        ll1_ = ( 1+ 0.5*ll4_)/( 1- 0.5*ll4_);
+        h[i_] = b_1_+(h[i_]-b_1_)*ll1_;
+        a_2_ = ntau[i_];
+        b_2_ = ninf[i_];
+        ll5_ =  -dt/a_2_;
+        ll2_ = ( 1+ 0.5*ll5_)/( 1- 0.5*ll5_);
+        n[i_] = b_2_+(n[i_]-b_2_)*ll2_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_hh::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_hh");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type ek = ion_k_.reversal_potential[ion_k_index_[i_]];
+        value_type ik = 0;
+        value_type ena = ion_na_.reversal_potential[ion_na_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        value_type ina = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type il;
+        current_ =  0.;
+        conductivity_ =  0.;
+        gna[i_] = gnabar[i_]*m[i_]*m[i_]*m[i_]*h[i_];
+        ina = gna[i_]*(v-ena);
+        current_ = current_+ina;
+        conductivity_ = conductivity_+gna[i_];
+        gk[i_] = gkbar[i_]*n[i_]*n[i_]*n[i_]*n[i_];
+        ik = gk[i_]*(v-ek);
+        current_ = current_+ik;
+        conductivity_ = conductivity_+gk[i_];
+        il = gl[i_]*(v-el[i_]);
+        current_ = current_+il;
+        conductivity_ = conductivity_+gl[i_];
+        ion_k_.current_density[ion_k_index_[i_]] = fma(10*weight_[i_], ik, ion_k_.current_density[ion_k_index_[i_]]);
+        ion_na_.current_density[ion_na_index_[i_]] = fma(10*weight_[i_], ina, ion_na_.current_density[ion_na_index_[i_]]);
+        vec_g_[node_index_[i_]] = fma(10*weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(10*weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_hh::write_ions() {
+}
+
+void mechanism_cpu_hh::rates(int i_, value_type v, value_type celsius) {
+    value_type ll3_, ll1_, ll2_, sum, q10, ll0_, beta, alpha;
+    q10 = pow( 3, (celsius- 6.2999999999999998)/ 10);
+    ll2_ =  -(v+ 40);
+    ll0_ =  10*exprelr(ll2_/ 10);
+    alpha =  0.10000000000000001*ll0_;
+    beta =  4*exp( -(v+ 65)/ 18);
+    sum = alpha+beta;
+    mtau[i_] =  1/(q10*sum);
+    minf[i_] = alpha/sum;
+    alpha =  0.070000000000000007*exp( -(v+ 65)/ 20);
+    beta =  1/(exp( -(v+ 35)/ 10)+ 1);
+    sum = alpha+beta;
+    htau[i_] =  1/(q10*sum);
+    hinf[i_] = alpha/sum;
+    ll3_ =  -(v+ 55);
+    ll1_ =  10*exprelr(ll3_/ 10);
+    alpha =  0.01*ll1_;
+    beta =  0.125*exp( -(v+ 65)/ 80);
+    sum = alpha+beta;
+    ntau[i_] =  1/(q10*sum);
+    ninf[i_] = alpha/sum;
+}
+
+} // namespace arb
@@ -0,0 +1,171 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_hh_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* hinf;
+    value_type* gl;
+    value_type* gnabar;
+    value_type* n;
+    value_type* h;
+    value_type* m;
+    value_type* ninf;
+    value_type* gna;
+    value_type* el;
+    value_type* ntau;
+    value_type* gk;
+    value_type* minf;
+    value_type* mtau;
+    value_type* htau;
+    value_type* gkbar;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__device__
+void rates(mechanism_gpu_hh_pp_ params_, int tid_, value_type v, value_type celsius) {
+    value_type ll3_, ll1_, ll2_, sum, q10, ll0_, beta, alpha;
+    q10 = pow( 3, (celsius- 6.2999999999999998)/ 10);
+    ll2_ =  -(v+ 40);
+    ll0_ =  10*exprelr(ll2_/ 10);
+    alpha =  0.10000000000000001*ll0_;
+    beta =  4*exp( -(v+ 65)/ 18);
+    sum = alpha+beta;
+    params_.mtau[tid_] =  1/(q10*sum);
+    params_.minf[tid_] = alpha/sum;
+    alpha =  0.070000000000000007*exp( -(v+ 65)/ 20);
+    beta =  1/(exp( -(v+ 35)/ 10)+ 1);
+    sum = alpha+beta;
+    params_.htau[tid_] =  1/(q10*sum);
+    params_.hinf[tid_] = alpha/sum;
+    ll3_ =  -(v+ 55);
+    ll1_ =  10*exprelr(ll3_/ 10);
+    alpha =  0.01*ll1_;
+    beta =  0.125*exp( -(v+ 65)/ 80);
+    sum = alpha+beta;
+    params_.ntau[tid_] =  1/(q10*sum);
+    params_.ninf[tid_] = alpha/sum;
+}
+
+__global__
+void nrn_init(mechanism_gpu_hh_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        rates(params_, tid_, v, celsius);
+        params_.m[tid_] = params_.minf[tid_];
+        params_.h[tid_] = params_.hinf[tid_];
+        params_.n[tid_] = params_.ninf[tid_];
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_hh_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type ll2_, a_0_, b_0_, ll0_, ll3_, b_1_, ll1_, ll5_, ll4_, a_1_, a_2_, b_2_;
+        rates(params_, tid_, v, celsius);
+        a_0_ = params_.mtau[tid_];
+        b_0_ = params_.minf[tid_];
+        ll3_ =  -dt/a_0_;
+        ll0_ = ( 1+ 0.5*ll3_)/( 1- 0.5*ll3_);
+        params_.m[tid_] = b_0_+(params_.m[tid_]-b_0_)*ll0_;
+        a_1_ = params_.htau[tid_];
+        b_1_ = params_.hinf[tid_];
+        ll4_ =  -dt/a_1_;
+        ll1_ = ( 1+ 0.5*ll4_)/( 1- 0.5*ll4_);
+        params_.h[tid_] = b_1_+(params_.h[tid_]-b_1_)*ll1_;
+        a_2_ = params_.ntau[tid_];
+        b_2_ = params_.ninf[tid_];
+        ll5_ =  -dt/a_2_;
+        ll2_ = ( 1+ 0.5*ll5_)/( 1- 0.5*ll5_);
+        params_.n[tid_] = b_2_+(params_.n[tid_]-b_2_)*ll2_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_hh_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        auto ion_na_index_i_ = params_.ion_na_index_[tid_];
+        auto ion_k_index_i_ = params_.ion_k_index_[tid_];
+        value_type ek = params_.ion_k_.reversal_potential[ion_k_index_i_];
+        value_type ik = 0;
+        value_type ena = params_.ion_na_.reversal_potential[ion_na_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ina = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type il;
+        current_ =  0.;
+        conductivity_ =  0.;
+        params_.gna[tid_] = params_.gnabar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_];
+        ina = params_.gna[tid_]*(v-ena);
+        current_ = current_+ina;
+        conductivity_ = conductivity_+params_.gna[tid_];
+        params_.gk[tid_] = params_.gkbar[tid_]*params_.n[tid_]*params_.n[tid_]*params_.n[tid_]*params_.n[tid_];
+        ik = params_.gk[tid_]*(v-ek);
+        current_ = current_+ik;
+        conductivity_ = conductivity_+params_.gk[tid_];
+        il = params_.gl[tid_]*(v-params_.el[tid_]);
+        current_ = current_+il;
+        conductivity_ = conductivity_+params_.gl[tid_];
+        params_.ion_k_.current_density[ion_k_index_i_] = fma(10*params_.weight_[tid_], ik, params_.ion_k_.current_density[ion_k_index_i_]);
+        params_.ion_na_.current_density[ion_na_index_i_] = fma(10*params_.weight_[tid_], ina, params_.ion_na_.current_density[ion_na_index_i_]);
+        params_.vec_g_[node_index_i_] = fma(10*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_hh_nrn_init_(mechanism_gpu_hh_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_hh_nrn_current_(mechanism_gpu_hh_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_hh_nrn_state_(mechanism_gpu_hh_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_hh_write_ions_(mechanism_gpu_hh_pp_& p) {}
+
+} // namespace arb
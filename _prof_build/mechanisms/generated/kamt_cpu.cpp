@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_kamt: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "kamt"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_kamt()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"vhalfm", &vhalfm},
+            {"a0m", &a0m},
+            {"a0h", &a0h},
+            {"zetam", &zetam},
+            {"vhalfh", &vhalfh},
+            {"zetah", &zetah},
+            {"sha", &sha},
+            {"shi", &shi},
+            {"gmm", &gmm},
+            {"gmh", &gmh}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"gbar", &gbar},
+            {"h", &h},
+            {"q10", &q10},
+            {"hinf", &hinf},
+            {"m", &m},
+            {"minf", &minf},
+            {"mtau", &mtau},
+            {"htau", &htau}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 0.002},
+            {"q10", 3}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h", &h},
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type vhalfm = -45;
+    value_type a0m = 0.040000000000000001;
+    value_type a0h = 0.017999999999999999;
+    value_type zetam = 0.10000000000000001;
+    value_type vhalfh = -70;
+    value_type zetah = 0.20000000000000001;
+    value_type sha = 9.9000000000000004;
+    value_type shi = 5.7000000000000002;
+    value_type gmm = 0.75;
+    value_type gmh = 0.98999999999999999;
+    value_type* gbar;
+    value_type* h;
+    value_type* q10;
+    value_type* hinf;
+    value_type* m;
+    value_type* minf;
+    value_type* mtau;
+    value_type* htau;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+    void trates(int i_, value_type v, value_type celsius);
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_kamt();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_kamt<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_kamt());
+}
+
+void mechanism_cpu_kamt::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        trates(i_, v, celsius);
+        m[i_] = minf[i_];
+        h[i_] = hinf[i_];
+    }
+}
+
+void mechanism_cpu_kamt::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_kamt");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        value_type ll3_, ll1_, a_1_, ll2_, ll0_, b_0_, a_0_, b_1_;
+        trates(i_, v, celsius);
+        a_0_ = mtau[i_];
+        b_0_ = minf[i_];
+        ll2_ =  -dt/a_0_;
+        ll0_ = ( 1+ 0.5*ll2_)/( 1- 0.5*ll2_);
+        m[i_] = b_0_+(m[i_]-b_0_)*ll0_;
+        a_1_ = htau[i_];
+        b_1_ = hinf[i_];
+        ll3_ =  -dt/a_1_;
+        ll1_ = ( 1+ 0.5*ll3_)/( 1- 0.5*ll3_);
+        h[i_] = b_1_+(h[i_]-b_1_)*ll1_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_kamt::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_kamt");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type ek = ion_k_.reversal_potential[ion_k_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        value_type ik = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        current_ =  0.;
+        conductivity_ =  0.;
+        ik = gbar[i_]*m[i_]*h[i_]*(v-ek);
+        current_ = current_+ik;
+        conductivity_ = conductivity_+gbar[i_]*m[i_]*h[i_];
+        ion_k_.current_density[ion_k_index_[i_]] = fma(10*weight_[i_], ik, ion_k_.current_density[ion_k_index_[i_]]);
+        vec_g_[node_index_[i_]] = fma(10*weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(10*weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_kamt::write_ions() {
+}
+
+void mechanism_cpu_kamt::trates(int i_, value_type v, value_type celsius) {
+    value_type ll2_, ll0_, ll3_, ll1_, qt;
+    qt = pow(q10[i_], (celsius- 24)/ 10);
+    minf[i_] =  1/( 1+exp( -(v-sha- 7.5999999999999996)/ 14));
+    ll0_ = exp(zetam*gmm*(v-vhalfm));
+    ll1_ = exp(zetam*(v-vhalfm));
+    mtau[i_] = ll0_/(qt*a0m*( 1+ll1_));
+    hinf[i_] =  1/( 1+exp((v-shi+ 47.399999999999999)/ 6));
+    ll2_ = exp(zetah*gmh*(v-vhalfh));
+    ll3_ = exp(zetah*(v-vhalfh));
+    htau[i_] = ll2_/(qt*a0h*( 1+ll3_));
+}
+
+} // namespace arb
@@ -0,0 +1,123 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+struct mechanism_gpu_kamt_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type vhalfm = -45;
+    value_type a0m = 0.040000000000000001;
+    value_type a0h = 0.017999999999999999;
+    value_type zetam = 0.10000000000000001;
+    value_type vhalfh = -70;
+    value_type zetah = 0.20000000000000001;
+    value_type sha = 9.9000000000000004;
+    value_type shi = 5.7000000000000002;
+    value_type gmm = 0.75;
+    value_type gmh = 0.98999999999999999;
+    value_type* gbar;
+    value_type* h;
+    value_type* q10;
+    value_type* hinf;
+    value_type* m;
+    value_type* minf;
+    value_type* mtau;
+    value_type* htau;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+void mechanism_gpu_kamt_nrn_init_(mechanism_gpu_kamt_pp_&);
+void mechanism_gpu_kamt_nrn_state_(mechanism_gpu_kamt_pp_&);
+void mechanism_gpu_kamt_nrn_current_(mechanism_gpu_kamt_pp_&);
+void mechanism_gpu_kamt_write_ions_(mechanism_gpu_kamt_pp_&);
+
+class mechanism_gpu_kamt: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "kamt"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_kamt()); }
+
+    void nrn_init() override {
+        mechanism_gpu_kamt_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_kamt_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_kamt_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_kamt_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"vhalfm", &pp_.vhalfm},
+            {"a0m", &pp_.a0m},
+            {"a0h", &pp_.a0h},
+            {"zetam", &pp_.zetam},
+            {"vhalfh", &pp_.vhalfh},
+            {"zetah", &pp_.zetah},
+            {"sha", &pp_.sha},
+            {"shi", &pp_.shi},
+            {"gmm", &pp_.gmm},
+            {"gmh", &pp_.gmh}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"gbar", &pp_.gbar},
+            {"h", &pp_.h},
+            {"q10", &pp_.q10},
+            {"hinf", &pp_.hinf},
+            {"m", &pp_.m},
+            {"minf", &pp_.minf},
+            {"mtau", &pp_.mtau},
+            {"htau", &pp_.htau}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 0.002},
+            {"q10", 3}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"h", &pp_.h},
+            {"m", &pp_.m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &pp_.ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &pp_.ion_k_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_kamt_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_kamt();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_kamt<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_kamt());
+}
+
+} // namespace arb
@@ -0,0 +1,46 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_kdrmt();
+
+inline const ::arb::mechanism_info& mechanism_kdrmt_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"a0m", {spec::global, "", 0.0035}},
+            {"zetam", {spec::global, "", 0.055}},
+            {"gmm", {spec::global, "", 0.5}},
+            {"alpm", {spec::global, "", 0}},
+            {"betm", {spec::global, "", 0}}
+        },
+        // parameters
+        {
+            {"gbar", {spec::parameter, "mho / cm2", 0.002}},
+            {"vhalfm", {spec::parameter, "", -50}},
+            {"q10", {spec::parameter, "", 3}}
+        },
+        // state variables
+        {
+            {"m", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"k", {false, false, true, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace arb
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_kdrmt: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "kdrmt"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_kdrmt()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"betm", &betm},
+            {"alpm", &alpm},
+            {"a0m", &a0m},
+            {"zetam", &zetam},
+            {"gmm", &gmm}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"minf", &minf},
+            {"q10", &q10},
+            {"mtau", &mtau},
+            {"m", &m},
+            {"gbar", &gbar},
+            {"vhalfm", &vhalfm}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"q10", 3},
+            {"gbar", 0.002},
+            {"vhalfm", -50}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &m}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"k", &ion_k_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"k", &ion_k_index_}
+        };
+    }
+
+private:
+    value_type betm = 0.;
+    value_type alpm = 0.;
+    value_type a0m = 0.0035000000000000001;
+    value_type zetam = 0.055;
+    value_type gmm = 0.5;
+    value_type* minf;
+    value_type* q10;
+    value_type* mtau;
+    value_type* m;
+    value_type* gbar;
+    value_type* vhalfm;
+    ion_state_view ion_k_;
+    iarray ion_k_index_;
+    void trates(int i_, value_type v, value_type celsius);
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_kdrmt();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_kdrmt<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_kdrmt());
+}
+
+void mechanism_cpu_kdrmt::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        trates(i_, v, celsius);
+        m[i_] = minf[i_];
+    }
+}
+
+void mechanism_cpu_kdrmt::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_kdrmt");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        value_type ll1_, ll0_, b_0_, a_0_;
+        trates(i_, v, celsius);
+        a_0_ = mtau[i_];
+        b_0_ = minf[i_];
+        ll1_ =  -dt/a_0_;
+        ll0_ = ( 1+ 0.5*ll1_)/( 1- 0.5*ll1_);
+        m[i_] = b_0_+(m[i_]-b_0_)*ll0_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_kdrmt::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_kdrmt");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type ek = ion_k_.reversal_potential[ion_k_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        value_type ik = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        current_ =  0.;
+        conductivity_ =  0.;
+        ik = gbar[i_]*m[i_]*(v-ek);
+        current_ = current_+ik;
+        conductivity_ = conductivity_+gbar[i_]*m[i_];
+        ion_k_.current_density[ion_k_index_[i_]] = fma(10*weight_[i_], ik, ion_k_.current_density[ion_k_index_[i_]]);
+        vec_g_[node_index_[i_]] = fma(10*weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(10*weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_kdrmt::write_ions() {
+}
+
+void mechanism_cpu_kdrmt::trates(int i_, value_type v, value_type celsius) {
+    value_type tmp, betm, alpm, qt;
+    qt = pow(q10[i_], (celsius- 24)/ 10);
+    minf[i_] =  1/( 1+exp( -(v- 21)/ 10));
+    tmp = zetam*(v-vhalfm[i_]);
+    alpm = exp(tmp);
+    betm = exp(gmm*tmp);
+    mtau[i_] = betm/(qt*a0m*( 1+alpm));
+}
+
+} // namespace arb
@@ -0,0 +1,126 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_kdrmt_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type betm = 0.;
+    value_type alpm = 0.;
+    value_type a0m = 0.0035000000000000001;
+    value_type zetam = 0.055;
+    value_type gmm = 0.5;
+    value_type* minf;
+    value_type* q10;
+    value_type* mtau;
+    value_type* m;
+    value_type* gbar;
+    value_type* vhalfm;
+    ion_state_view ion_k_;
+    const index_type* ion_k_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__device__
+void trates(mechanism_gpu_kdrmt_pp_ params_, int tid_, value_type v, value_type celsius) {
+    value_type tmp, betm, alpm, qt;
+    qt = pow(params_.q10[tid_], (celsius- 24)/ 10);
+    params_.minf[tid_] =  1/( 1+exp( -(v- 21)/ 10));
+    tmp = params_.zetam*(v-params_.vhalfm[tid_]);
+    alpm = exp(tmp);
+    betm = exp(params_.gmm*tmp);
+    params_.mtau[tid_] = betm/(qt*params_.a0m*( 1+alpm));
+}
+
+__global__
+void nrn_init(mechanism_gpu_kdrmt_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        trates(params_, tid_, v, celsius);
+        params_.m[tid_] = params_.minf[tid_];
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_kdrmt_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ll1_, ll0_, b_0_, a_0_;
+        trates(params_, tid_, v, celsius);
+        a_0_ = params_.mtau[tid_];
+        b_0_ = params_.minf[tid_];
+        ll1_ =  -dt/a_0_;
+        ll0_ = ( 1+ 0.5*ll1_)/( 1- 0.5*ll1_);
+        params_.m[tid_] = b_0_+(params_.m[tid_]-b_0_)*ll0_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_kdrmt_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        auto ion_k_index_i_ = params_.ion_k_index_[tid_];
+        value_type ek = params_.ion_k_.reversal_potential[ion_k_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ik = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        current_ =  0.;
+        conductivity_ =  0.;
+        ik = params_.gbar[tid_]*params_.m[tid_]*(v-ek);
+        current_ = current_+ik;
+        conductivity_ = conductivity_+params_.gbar[tid_]*params_.m[tid_];
+        params_.ion_k_.current_density[ion_k_index_i_] = fma(10*params_.weight_[tid_], ik, params_.ion_k_.current_density[ion_k_index_i_]);
+        params_.vec_g_[node_index_i_] = fma(10*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_kdrmt_nrn_init_(mechanism_gpu_kdrmt_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_kdrmt_nrn_current_(mechanism_gpu_kdrmt_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_kdrmt_nrn_state_(mechanism_gpu_kdrmt_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_kdrmt_write_ions_(mechanism_gpu_kdrmt_pp_& p) {}
+
+} // namespace arb
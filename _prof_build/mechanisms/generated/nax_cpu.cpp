@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_nax: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "nax"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_nax()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"Ra", &Ra},
+            {"tha", &tha},
+            {"qg", &qg},
+            {"mmin", &mmin},
+            {"Rd", &Rd},
+            {"thi1", &thi1},
+            {"Rb", &Rb},
+            {"q10", &q10},
+            {"hmin", &hmin},
+            {"thi2", &thi2},
+            {"qinf", &qinf},
+            {"qd", &qd},
+            {"Rg", &Rg},
+            {"thinf", &thinf},
+            {"qa", &qa}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &m},
+            {"gbar", &gbar},
+            {"thegna", &thegna},
+            {"h", &h},
+            {"sh", &sh},
+            {"hinf", &hinf},
+            {"mtau", &mtau},
+            {"minf", &minf},
+            {"htau", &htau}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 0.01},
+            {"sh", 5}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &m},
+            {"h", &h}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &ion_na_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &ion_na_index_}
+        };
+    }
+
+private:
+    value_type Ra = 0.40000000000000002;
+    value_type tha = -30;
+    value_type qg = 1.5;
+    value_type mmin = 0.02;
+    value_type Rd = 0.029999999999999999;
+    value_type thi1 = -45;
+    value_type Rb = 0.124;
+    value_type q10 = 2;
+    value_type hmin = 0.5;
+    value_type thi2 = -45;
+    value_type qinf = 4;
+    value_type qd = 1.5;
+    value_type Rg = 0.01;
+    value_type thinf = -50;
+    value_type qa = 7.2000000000000002;
+    value_type* m;
+    value_type* gbar;
+    value_type* thegna;
+    value_type* h;
+    value_type* sh;
+    value_type* hinf;
+    value_type* mtau;
+    value_type* minf;
+    value_type* htau;
+    ion_state_view ion_na_;
+    iarray ion_na_index_;
+    void trates(int i_, value_type vm, value_type sh2, value_type celsius);
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_nax();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_nax<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_nax());
+}
+
+void mechanism_cpu_nax::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        trates(i_, v, sh[i_], celsius);
+        m[i_] = minf[i_];
+        h[i_] = hinf[i_];
+    }
+}
+
+void mechanism_cpu_nax::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_nax");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        value_type ll3_, ll1_, a_1_, ll2_, ll0_, b_0_, a_0_, b_1_;
+        trates(i_, v, sh[i_], celsius);
+        a_0_ = mtau[i_];
+        b_0_ = minf[i_];
+        ll2_ =  -dt/a_0_;
+        ll0_ = ( 1+ 0.5*ll2_)/( 1- 0.5*ll2_);
+        m[i_] = b_0_+(m[i_]-b_0_)*ll0_;
+        a_1_ = htau[i_];
+        b_1_ = hinf[i_];
+        ll3_ =  -dt/a_1_;
+        ll1_ = ( 1+ 0.5*ll3_)/( 1- 0.5*ll3_);
+        h[i_] = b_1_+(h[i_]-b_1_)*ll1_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_nax::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_nax");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type ena = ion_na_.reversal_potential[ion_na_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        value_type ina = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        current_ =  0.;
+        conductivity_ =  0.;
+        thegna[i_] = gbar[i_]*m[i_]*m[i_]*m[i_]*h[i_];
+        ina = thegna[i_]*(v-ena);
+        current_ = current_+ina;
+        conductivity_ = conductivity_+thegna[i_];
+        ion_na_.current_density[ion_na_index_[i_]] = fma(10*weight_[i_], ina, ion_na_.current_density[ion_na_index_[i_]]);
+        vec_g_[node_index_[i_]] = fma(10*weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(10*weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_nax::write_ions() {
+}
+
+void mechanism_cpu_nax::trates(int i_, value_type vm, value_type sh2, value_type celsius) {
+    value_type ll4_, ll5_, ll3_, ll1_, ll2_, ll0_, qt, b, a;
+    qt = pow(q10, (celsius- 24)/ 10);
+    ll0_ = tha+sh2;
+    a = Ra*qa*exprelr( -(vm-ll0_)/qa);
+    ll1_ =  -vm;
+    ll2_ =  -tha-sh2;
+    b = Rb*qa*exprelr( -(ll1_-ll2_)/qa);
+    mtau[i_] = max( 1/(a+b)/qt, mmin);
+    minf[i_] = a/(a+b);
+    ll3_ = thi1+sh2;
+    a = Rd*qd*exprelr( -(vm-ll3_)/qd);
+    ll4_ =  -vm;
+    ll5_ =  -thi2-sh2;
+    b = Rg*qg*exprelr( -(ll4_-ll5_)/qg);
+    htau[i_] = max( 1/(a+b)/qt, hmin);
+    hinf[i_] =  1/( 1+exp((vm-thinf-sh2)/qinf));
+}
+
+} // namespace arb
@@ -0,0 +1,135 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+struct mechanism_gpu_nax_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type Ra = 0.40000000000000002;
+    value_type tha = -30;
+    value_type qg = 1.5;
+    value_type mmin = 0.02;
+    value_type Rd = 0.029999999999999999;
+    value_type thi1 = -45;
+    value_type Rb = 0.124;
+    value_type q10 = 2;
+    value_type hmin = 0.5;
+    value_type thi2 = -45;
+    value_type qinf = 4;
+    value_type qd = 1.5;
+    value_type Rg = 0.01;
+    value_type thinf = -50;
+    value_type qa = 7.2000000000000002;
+    value_type* m;
+    value_type* gbar;
+    value_type* thegna;
+    value_type* h;
+    value_type* sh;
+    value_type* hinf;
+    value_type* mtau;
+    value_type* minf;
+    value_type* htau;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+};
+
+void mechanism_gpu_nax_nrn_init_(mechanism_gpu_nax_pp_&);
+void mechanism_gpu_nax_nrn_state_(mechanism_gpu_nax_pp_&);
+void mechanism_gpu_nax_nrn_current_(mechanism_gpu_nax_pp_&);
+void mechanism_gpu_nax_write_ions_(mechanism_gpu_nax_pp_&);
+
+class mechanism_gpu_nax: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "nax"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_nax()); }
+
+    void nrn_init() override {
+        mechanism_gpu_nax_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_nax_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_nax_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_nax_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"Ra", &pp_.Ra},
+            {"tha", &pp_.tha},
+            {"qg", &pp_.qg},
+            {"mmin", &pp_.mmin},
+            {"Rd", &pp_.Rd},
+            {"thi1", &pp_.thi1},
+            {"Rb", &pp_.Rb},
+            {"q10", &pp_.q10},
+            {"hmin", &pp_.hmin},
+            {"thi2", &pp_.thi2},
+            {"qinf", &pp_.qinf},
+            {"qd", &pp_.qd},
+            {"Rg", &pp_.Rg},
+            {"thinf", &pp_.thinf},
+            {"qa", &pp_.qa}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &pp_.m},
+            {"gbar", &pp_.gbar},
+            {"thegna", &pp_.thegna},
+            {"h", &pp_.h},
+            {"sh", &pp_.sh},
+            {"hinf", &pp_.hinf},
+            {"mtau", &pp_.mtau},
+            {"minf", &pp_.minf},
+            {"htau", &pp_.htau}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"gbar", 0.01},
+            {"sh", 5}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &pp_.m},
+            {"h", &pp_.h}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"na", &pp_.ion_na_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"na", &pp_.ion_na_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_nax_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_nax();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_nax<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_nax());
+}
+
+} // namespace arb
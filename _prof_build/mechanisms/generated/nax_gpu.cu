@@ -0,0 +1,155 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_nax_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type Ra = 0.40000000000000002;
+    value_type tha = -30;
+    value_type qg = 1.5;
+    value_type mmin = 0.02;
+    value_type Rd = 0.029999999999999999;
+    value_type thi1 = -45;
+    value_type Rb = 0.124;
+    value_type q10 = 2;
+    value_type hmin = 0.5;
+    value_type thi2 = -45;
+    value_type qinf = 4;
+    value_type qd = 1.5;
+    value_type Rg = 0.01;
+    value_type thinf = -50;
+    value_type qa = 7.2000000000000002;
+    value_type* m;
+    value_type* gbar;
+    value_type* thegna;
+    value_type* h;
+    value_type* sh;
+    value_type* hinf;
+    value_type* mtau;
+    value_type* minf;
+    value_type* htau;
+    ion_state_view ion_na_;
+    const index_type* ion_na_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__device__
+void trates(mechanism_gpu_nax_pp_ params_, int tid_, value_type vm, value_type sh2, value_type celsius) {
+    value_type ll4_, ll5_, ll3_, ll1_, ll2_, ll0_, qt, b, a;
+    qt = pow(params_.q10, (celsius- 24)/ 10);
+    ll0_ = params_.tha+sh2;
+    a = params_.Ra*params_.qa*exprelr( -(vm-ll0_)/params_.qa);
+    ll1_ =  -vm;
+    ll2_ =  -params_.tha-sh2;
+    b = params_.Rb*params_.qa*exprelr( -(ll1_-ll2_)/params_.qa);
+    params_.mtau[tid_] = max( 1/(a+b)/qt, params_.mmin);
+    params_.minf[tid_] = a/(a+b);
+    ll3_ = params_.thi1+sh2;
+    a = params_.Rd*params_.qd*exprelr( -(vm-ll3_)/params_.qd);
+    ll4_ =  -vm;
+    ll5_ =  -params_.thi2-sh2;
+    b = params_.Rg*params_.qg*exprelr( -(ll4_-ll5_)/params_.qg);
+    params_.htau[tid_] = max( 1/(a+b)/qt, params_.hmin);
+    params_.hinf[tid_] =  1/( 1+exp((vm-params_.thinf-sh2)/params_.qinf));
+}
+
+__global__
+void nrn_init(mechanism_gpu_nax_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        trates(params_, tid_, v, params_.sh[tid_], celsius);
+        params_.m[tid_] = params_.minf[tid_];
+        params_.h[tid_] = params_.hinf[tid_];
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_nax_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ll3_, ll1_, a_1_, ll2_, ll0_, b_0_, a_0_, b_1_;
+        trates(params_, tid_, v, params_.sh[tid_], celsius);
+        a_0_ = params_.mtau[tid_];
+        b_0_ = params_.minf[tid_];
+        ll2_ =  -dt/a_0_;
+        ll0_ = ( 1+ 0.5*ll2_)/( 1- 0.5*ll2_);
+        params_.m[tid_] = b_0_+(params_.m[tid_]-b_0_)*ll0_;
+        a_1_ = params_.htau[tid_];
+        b_1_ = params_.hinf[tid_];
+        ll3_ =  -dt/a_1_;
+        ll1_ = ( 1+ 0.5*ll3_)/( 1- 0.5*ll3_);
+        params_.h[tid_] = b_1_+(params_.h[tid_]-b_1_)*ll1_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_nax_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        auto ion_na_index_i_ = params_.ion_na_index_[tid_];
+        value_type ena = params_.ion_na_.reversal_potential[ion_na_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ina = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        current_ =  0.;
+        conductivity_ =  0.;
+        params_.thegna[tid_] = params_.gbar[tid_]*params_.m[tid_]*params_.m[tid_]*params_.m[tid_]*params_.h[tid_];
+        ina = params_.thegna[tid_]*(v-ena);
+        current_ = current_+ina;
+        conductivity_ = conductivity_+params_.thegna[tid_];
+        params_.ion_na_.current_density[ion_na_index_i_] = fma(10*params_.weight_[tid_], ina, params_.ion_na_.current_density[ion_na_index_i_]);
+        params_.vec_g_[node_index_i_] = fma(10*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_nax_nrn_init_(mechanism_gpu_nax_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_nax_nrn_current_(mechanism_gpu_nax_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_nax_nrn_state_(mechanism_gpu_nax_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_nax_write_ions_(mechanism_gpu_nax_pp_& p) {}
+
+} // namespace arb
@@ -0,0 +1,41 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_nernst();
+
+inline const ::arb::mechanism_info& mechanism_nernst_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"R", {spec::global, "joule / kelvin / mole", 8.31446261815324}},
+            {"F", {spec::global, "coulomb / mole", 96485.3321233100184}}
+        },
+        // parameters
+        {
+
+        },
+        // state variables
+        {
+
+        },
+        // ion dependencies
+        {
+            {"x", {false, false, true, true, true, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        1
+    };
+
+    return info;
+}
+
+} // namespace arb
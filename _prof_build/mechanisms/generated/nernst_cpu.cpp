@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_nernst: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "nernst"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::point; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_nernst()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"F", &F},
+            {"R", &R}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"coeff", &coeff}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"x", &ion_x_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"x", &ion_x_index_}
+        };
+    }
+
+private:
+    value_type F = 96485.332123310014;
+    value_type R = 8.3144626181532395;
+    value_type* coeff;
+    ion_state_view ion_x_;
+    iarray ion_x_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_nernst();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_nernst<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_nernst());
+}
+
+void mechanism_cpu_nernst::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type zx = ion_x_.ionic_charge[0];
+        value_type celsius = temperature_degC_[node_index_[i_]];
+        coeff[i_] = R*(celsius+ 273.14999999999998)/(zx*F)* 1000;
+    }
+}
+
+void mechanism_cpu_nernst::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_nernst");
+        ::arb::profile::profiler_enter(id);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_nernst::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_nernst");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type xi = ion_x_.internal_concentration[ion_x_index_[i_]];
+        value_type xo = ion_x_.external_concentration[ion_x_index_[i_]];
+        value_type ex = 0;
+        ex = coeff[i_]*log(xo/xi);
+        ion_x_.reversal_potential[ion_x_index_[i_]] = ex;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_nernst::write_ions() {
+}
+
+} // namespace arb
@@ -0,0 +1,89 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+struct mechanism_gpu_nernst_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type F = 96485.332123310014;
+    value_type R = 8.3144626181532395;
+    value_type* coeff;
+    ion_state_view ion_x_;
+    const index_type* ion_x_index_;
+};
+
+void mechanism_gpu_nernst_nrn_init_(mechanism_gpu_nernst_pp_&);
+void mechanism_gpu_nernst_nrn_state_(mechanism_gpu_nernst_pp_&);
+void mechanism_gpu_nernst_nrn_current_(mechanism_gpu_nernst_pp_&);
+void mechanism_gpu_nernst_write_ions_(mechanism_gpu_nernst_pp_&);
+
+class mechanism_gpu_nernst: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "nernst"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::point; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_nernst()); }
+
+    void nrn_init() override {
+        mechanism_gpu_nernst_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_nernst_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_nernst_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_nernst_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"F", &pp_.F},
+            {"R", &pp_.R}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"coeff", &pp_.coeff}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"x", &pp_.ion_x_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"x", &pp_.ion_x_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_nernst_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_nernst();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_nernst<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_nernst());
+}
+
+} // namespace arb
@@ -0,0 +1,73 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_nernst_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type F = 96485.332123310014;
+    value_type R = 8.3144626181532395;
+    value_type* coeff;
+    ion_state_view ion_x_;
+    const index_type* ion_x_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_nernst_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type zx = params_.ion_x_.ionic_charge[0];
+        value_type celsius = params_.temperature_degC_[node_index_i_];
+        params_.coeff[tid_] = params_.R*(celsius+ 273.14999999999998)/(zx*params_.F)* 1000;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_nernst_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_x_index_i_ = params_.ion_x_index_[tid_];
+        value_type xi = params_.ion_x_.internal_concentration[ion_x_index_i_];
+        value_type xo = params_.ion_x_.external_concentration[ion_x_index_i_];
+        value_type ex = 0;
+        ex = params_.coeff[tid_]*log(xo/xi);
+        params_.ion_x_.reversal_potential[ion_x_index_i_] = ex;
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_nernst_nrn_init_(mechanism_gpu_nernst_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_nernst_nrn_current_(mechanism_gpu_nernst_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_nernst_nrn_state_(mechanism_gpu_nernst_pp_& p) {}
+
+void mechanism_gpu_nernst_write_ions_(mechanism_gpu_nernst_pp_& p) {}
+
+} // namespace arb
@@ -0,0 +1,41 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_pas();
+
+inline const ::arb::mechanism_info& mechanism_pas_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+
+        },
+        // parameters
+        {
+            {"g", {spec::parameter, "S / cm2", .001}},
+            {"e", {spec::parameter, "mV", -65}}
+        },
+        // state variables
+        {
+
+        },
+        // ion dependencies
+        {
+
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        1
+    };
+
+    return info;
+}
+
+} // namespace arb
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_pas: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "pas"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_pas()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_field_table field_table() override {
+        return {
+            {"g", &g},
+            {"e", &e}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+            {"g", 0.001},
+            {"e", -65}
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+        };
+    }
+
+private:
+    value_type* g;
+    value_type* e;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_pas();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_pas<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_pas());
+}
+
+void mechanism_cpu_pas::nrn_init() {
+}
+
+void mechanism_cpu_pas::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_pas");
+        ::arb::profile::profiler_enter(id);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_pas::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_pas");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type v = vec_v_[node_index_[i_]];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type i;
+        current_ =  0.;
+        conductivity_ =  0.;
+        i = g[i_]*(v-e[i_]);
+        current_ = current_+i;
+        conductivity_ = conductivity_+g[i_];
+        vec_g_[node_index_[i_]] = fma(10*weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(10*weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_pas::write_ions() {
+}
+
+} // namespace arb
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_pas_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type* g;
+    value_type* e;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_current(mechanism_gpu_pas_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type i;
+        current_ =  0.;
+        conductivity_ =  0.;
+        i = params_.g[tid_]*(v-params_.e[tid_]);
+        current_ = current_+i;
+        conductivity_ = conductivity_+params_.g[tid_];
+        params_.vec_g_[node_index_i_] = fma(10*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_pas_nrn_init_(mechanism_gpu_pas_pp_& p) {}
+
+void mechanism_gpu_pas_nrn_current_(mechanism_gpu_pas_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_pas_nrn_state_(mechanism_gpu_pas_pp_& p) {}
+
+void mechanism_gpu_pas_write_ions_(mechanism_gpu_pas_pp_& p) {}
+
+} // namespace arb
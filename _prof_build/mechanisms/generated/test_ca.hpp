@@ -0,0 +1,42 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_test_ca();
+
+inline const ::arb::mechanism_info& mechanism_test_ca_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"decay", {spec::global, "ms", 80}},
+            {"cai0", {spec::global, "mM", 1e-4}},
+            {"factor", {spec::global, "", 2.59e-2}}
+        },
+        // parameters
+        {
+
+        },
+        // state variables
+        {
+            {"cai", {spec::state, "mM", 0}}
+        },
+        // ion dependencies
+        {
+            {"ca", {true, false, false, false, false, true, 2}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace arb
@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_test_ca: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "test_ca"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_test_ca()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"decay", &decay},
+            {"cai0", &cai0},
+            {"factor", &factor}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"cai", &cai}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"cai", &cai}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"ca", &ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"ca", &ion_ca_index_}
+        };
+    }
+
+private:
+    value_type decay = 80;
+    value_type cai0 = 0.0001;
+    value_type factor = 0.025899999999999999;
+    value_type* cai;
+    ion_state_view ion_ca_;
+    iarray ion_ca_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_test_ca();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_test_ca<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_test_ca());
+}
+
+void mechanism_cpu_test_ca::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        cai[i_] = cai0;
+    }
+}
+
+void mechanism_cpu_test_ca::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_testca");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type ica = 0.10000000000000001*ion_ca_.current_density[ion_ca_index_[i_]];
+        value_type ll1_, ll0_, ba_0_, a_0_;
+        a_0_ =  -1/decay;
+        ba_0_ = (cai0/decay-factor*ica)/a_0_;
+        ll1_ = a_0_*dt;
+        ll0_ = ( 1+ 0.5*ll1_)/( 1- 0.5*ll1_);
+        cai[i_] =  -ba_0_+(cai[i_]+ba_0_)*ll0_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_test_ca::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_testca");
+        ::arb::profile::profiler_enter(id);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_test_ca::write_ions() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type cai_shadowed_ = 0;
+        cai_shadowed_ = cai[i_];
+        ion_ca_.internal_concentration[ion_ca_index_[i_]] = fma(weight_[i_], cai_shadowed_, ion_ca_.internal_concentration[ion_ca_index_[i_]]);
+    }
+}
+
+} // namespace arb
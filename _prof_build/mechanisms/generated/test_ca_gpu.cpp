@@ -0,0 +1,92 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+struct mechanism_gpu_test_ca_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type decay = 80;
+    value_type cai0 = 0.0001;
+    value_type factor = 0.025899999999999999;
+    value_type* cai;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+void mechanism_gpu_test_ca_nrn_init_(mechanism_gpu_test_ca_pp_&);
+void mechanism_gpu_test_ca_nrn_state_(mechanism_gpu_test_ca_pp_&);
+void mechanism_gpu_test_ca_nrn_current_(mechanism_gpu_test_ca_pp_&);
+void mechanism_gpu_test_ca_write_ions_(mechanism_gpu_test_ca_pp_&);
+
+class mechanism_gpu_test_ca: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "test_ca"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_test_ca()); }
+
+    void nrn_init() override {
+        mechanism_gpu_test_ca_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_test_ca_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_test_ca_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_test_ca_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"decay", &pp_.decay},
+            {"cai0", &pp_.cai0},
+            {"factor", &pp_.factor}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"cai", &pp_.cai}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"cai", &pp_.cai}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"ca", &pp_.ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"ca", &pp_.ion_ca_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_test_ca_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_test_ca();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_test_ca<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_test_ca());
+}
+
+} // namespace arb
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_test_ca_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type decay = 80;
+    value_type cai0 = 0.0001;
+    value_type factor = 0.025899999999999999;
+    value_type* cai;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_test_ca_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        params_.cai[tid_] = params_.cai0;
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_test_ca_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_ca_index_i_ = params_.ion_ca_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type ica = 0.10000000000000001*params_.ion_ca_.current_density[ion_ca_index_i_];
+        value_type ll1_, ll0_, ba_0_, a_0_;
+        a_0_ =  -1/params_.decay;
+        ba_0_ = (params_.cai0/params_.decay-params_.factor*ica)/a_0_;
+        ll1_ = a_0_*dt;
+        ll0_ = ( 1+ 0.5*ll1_)/( 1- 0.5*ll1_);
+        params_.cai[tid_] =  -ba_0_+(params_.cai[tid_]+ba_0_)*ll0_;
+    }
+}
+
+__global__
+void write_ions(mechanism_gpu_test_ca_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_ca_index_i_ = params_.ion_ca_index_[tid_];
+        value_type cai_shadowed_ = 0;
+        cai_shadowed_ = params_.cai[tid_];
+        params_.ion_ca_.internal_concentration[ion_ca_index_i_] = fma(params_.weight_[tid_], cai_shadowed_, params_.ion_ca_.internal_concentration[ion_ca_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_test_ca_nrn_init_(mechanism_gpu_test_ca_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_test_ca_nrn_current_(mechanism_gpu_test_ca_pp_& p) {}
+
+void mechanism_gpu_test_ca_nrn_state_(mechanism_gpu_test_ca_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_test_ca_write_ions_(mechanism_gpu_test_ca_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    write_ions<<<grid_dim, block_dim>>>(p);
+}
+
+} // namespace arb
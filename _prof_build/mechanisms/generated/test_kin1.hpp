@@ -0,0 +1,41 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_test_kin1();
+
+inline const ::arb::mechanism_info& mechanism_test_kin1_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"tau", {spec::global, "ms", 10}}
+        },
+        // parameters
+        {
+
+        },
+        // state variables
+        {
+            {"a", {spec::state, "mA / cm2", 0}},
+            {"b", {spec::state, "mA / cm2", 0}}
+        },
+        // ion dependencies
+        {
+
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        1
+    };
+
+    return info;
+}
+
+} // namespace arb
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_test_kin1: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "test_kin1"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_test_kin1()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"tau", &tau}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"a", &a},
+            {"b", &b}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"a", &a},
+            {"b", &b}
+        };
+    }
+
+private:
+    value_type tau = 10;
+    value_type* a;
+    value_type* b;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_test_kin1();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_test_kin1<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_test_kin1());
+}
+
+void mechanism_cpu_test_kin1::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        a[i_] =  0.01;
+        b[i_] =  0.;
+    }
+}
+
+void mechanism_cpu_test_kin1::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_testkin1");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type t_3_, t_0_, a_2_, t_2_, a_1_, t_1_, a_3_, a_0_;
+        a_0_ =  1- -1*( 0.66666666666666663/tau)*dt;
+        a_1_ =  -( -1* -( 0.33333333333333331/tau)*dt);
+        a_2_ =  -( 0.66666666666666663/tau*dt);
+        a_3_ =  1- -( 0.33333333333333331/tau)*dt;
+        t_0_ = a_2_*a_1_-a_0_*a_3_;
+        t_1_ = a_2_*a[i_]-a_0_*b[i_];
+        t_2_ = t_0_*a_2_;
+        t_3_ = t_0_*b[i_]-a_3_*t_1_;
+        b[i_] = t_1_/t_0_;
+        a[i_] = t_3_/t_2_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_test_kin1::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_testkin1");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type il;
+        current_ =  0.;
+        conductivity_ =  0.;
+        il = a[i_];
+        current_ = current_+il;
+        vec_g_[node_index_[i_]] = fma(10*weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(10*weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_test_kin1::write_ions() {
+}
+
+} // namespace arb
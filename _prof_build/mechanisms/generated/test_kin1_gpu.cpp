@@ -0,0 +1,79 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+struct mechanism_gpu_test_kin1_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type tau = 10;
+    value_type* a;
+    value_type* b;
+};
+
+void mechanism_gpu_test_kin1_nrn_init_(mechanism_gpu_test_kin1_pp_&);
+void mechanism_gpu_test_kin1_nrn_state_(mechanism_gpu_test_kin1_pp_&);
+void mechanism_gpu_test_kin1_nrn_current_(mechanism_gpu_test_kin1_pp_&);
+void mechanism_gpu_test_kin1_write_ions_(mechanism_gpu_test_kin1_pp_&);
+
+class mechanism_gpu_test_kin1: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "test_kin1"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_test_kin1()); }
+
+    void nrn_init() override {
+        mechanism_gpu_test_kin1_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_test_kin1_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_test_kin1_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_test_kin1_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"tau", &pp_.tau}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"a", &pp_.a},
+            {"b", &pp_.b}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"a", &pp_.a},
+            {"b", &pp_.b}
+        };
+    }
+
+private:
+    mechanism_gpu_test_kin1_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_test_kin1();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_test_kin1<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_test_kin1());
+}
+
+} // namespace arb
@@ -0,0 +1,99 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_test_kin1_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type tau = 10;
+    value_type* a;
+    value_type* b;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_test_kin1_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        params_.a[tid_] =  0.01;
+        params_.b[tid_] =  0.;
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_test_kin1_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type t_3_, t_0_, a_2_, t_2_, a_1_, t_1_, a_3_, a_0_;
+        a_0_ =  1- -1*( 0.66666666666666663/params_.tau)*dt;
+        a_1_ =  -( -1* -( 0.33333333333333331/params_.tau)*dt);
+        a_2_ =  -( 0.66666666666666663/params_.tau*dt);
+        a_3_ =  1- -( 0.33333333333333331/params_.tau)*dt;
+        t_0_ = a_2_*a_1_-a_0_*a_3_;
+        t_1_ = a_2_*params_.a[tid_]-a_0_*params_.b[tid_];
+        t_2_ = t_0_*a_2_;
+        t_3_ = t_0_*params_.b[tid_]-a_3_*t_1_;
+        params_.b[tid_] = t_1_/t_0_;
+        params_.a[tid_] = t_3_/t_2_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_test_kin1_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type il;
+        current_ =  0.;
+        conductivity_ =  0.;
+        il = params_.a[tid_];
+        current_ = current_+il;
+        params_.vec_g_[node_index_i_] = fma(10*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_test_kin1_nrn_init_(mechanism_gpu_test_kin1_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_test_kin1_nrn_current_(mechanism_gpu_test_kin1_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_test_kin1_nrn_state_(mechanism_gpu_test_kin1_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_test_kin1_write_ions_(mechanism_gpu_test_kin1_pp_& p) {}
+
+} // namespace arb
@@ -0,0 +1,46 @@
+#pragma once
+#include <memory>
+
+#include <arbor/mechanism.hpp>
+#include <arbor/mechinfo.hpp>
+
+namespace arb {
+
+template <typename Backend>
+::arb::concrete_mech_ptr<Backend> make_mechanism_test_kinlva();
+
+inline const ::arb::mechanism_info& mechanism_test_kinlva_info() {
+    using spec = ::arb::mechanism_field_spec;
+    static ::arb::mechanism_info info = {
+        // globals
+        {
+            {"gbar", {spec::global, "S / cm2", 0.0002}},
+            {"gl", {spec::global, "S / cm2", 0.0001}},
+            {"eca", {spec::global, "mV", 120}},
+            {"el", {spec::global, "mV", -65}}
+        },
+        // parameters
+        {
+
+        },
+        // state variables
+        {
+            {"m", {spec::state, "", 0}},
+            {"h", {spec::state, "", 0}},
+            {"s", {spec::state, "", 0}},
+            {"d", {spec::state, "", 0}}
+        },
+        // ion dependencies
+        {
+            {"ca", {false, false, false, false, false, false, 0}}
+        },
+        // fingerprint
+        "<placeholder>",
+        // linear, homogeneous mechanism
+        0
+    };
+
+    return info;
+}
+
+} // namespace arb
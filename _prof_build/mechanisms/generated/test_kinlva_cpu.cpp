@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <backends/multicore/mechanism.hpp>
+#include <arbor/math.hpp>
+#include <arbor/profile/profiler.hpp>
+
+namespace arb {
+
+using backend = ::arb::multicore::backend;
+using base = ::arb::multicore::mechanism;
+using value_type = base::value_type;
+using size_type = base::size_type;
+using index_type = base::index_type;
+using ::arb::math::exprelr;
+using ::std::abs;
+using ::std::cos;
+using ::std::exp;
+using ::std::log;
+using ::std::max;
+using ::std::min;
+using ::std::pow;
+using ::std::sin;
+
+class mechanism_cpu_test_kinlva: public base {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+    std::string internal_name() const override { return "test_kinlva"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_cpu_test_kinlva()); }
+
+    void nrn_init() override;
+    void nrn_state() override;
+    void nrn_current() override;
+    void write_ions() override;
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    mechanism_global_table global_table() override {
+        return {
+            {"el", &el},
+            {"eca", &eca},
+            {"gl", &gl},
+            {"gbar", &gbar}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &m},
+            {"s", &s},
+            {"h", &h},
+            {"d", &d}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &m},
+            {"s", &s},
+            {"h", &h},
+            {"d", &d}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"ca", &ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"ca", &ion_ca_index_}
+        };
+    }
+
+private:
+    value_type el = -65;
+    value_type eca = 120;
+    value_type gl = 0.0001;
+    value_type gbar = 0.00020000000000000001;
+    value_type* m;
+    value_type* s;
+    value_type* h;
+    value_type* d;
+    ion_state_view ion_ca_;
+    iarray ion_ca_index_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_test_kinlva();
+template <> ::arb::concrete_mech_ptr<backend> make_mechanism_test_kinlva<backend>() {
+    return ::arb::concrete_mech_ptr<backend>(new mechanism_cpu_test_kinlva());
+}
+
+void mechanism_cpu_test_kinlva::nrn_init() {
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type v = vec_v_[node_index_[i_]];
+        value_type vrest, k;
+        vrest =  -65;
+        k = pow( 0.25+exp((v+ 83.5)/ 6.2999999999999998),  0.5)- 0.5;
+        m[i_] =  1/( 1+exp( -(vrest+ 63)/ 7.7999999999999998));
+        h[i_] =  1/( 1+k+pow(k,  2));
+        d[i_] = h[i_]*pow(k,  2);
+        s[i_] =  1-h[i_]-d[i_];
+    }
+}
+
+void mechanism_cpu_test_kinlva::nrn_state() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_state_testkinlva");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type dt = vec_dt_[node_index_[i_]];
+        value_type v = vec_v_[node_index_[i_]];
+        value_type t_8_, beta1, alpha1, alpha2, dsh_q10, t_1_, t_7_, beta2, ll0_, ba_0_, mi, taum, ll1_, a_4_, m_q10, a_2_, k, a_6_, t_4_, a_0_, a_1_, a_3_, a_5_, t_0_, t_2_, t_3_, t_5_, t_6_;
+        m_q10 =  5;
+        mi =  1/( 1+exp( -(v+ 63)/ 7.7999999999999998));
+        taum = ( 1.7+exp( -(v+ 28.800000000000001)/ 13.5))*mi;
+        a_0_ = m_q10* -1/taum;
+        ba_0_ = m_q10*mi/taum/a_0_;
+        ll1_ = a_0_*dt;
+        ll0_ = ( 1+ 0.5*ll1_)/( 1- 0.5*ll1_);
+        m[i_] =  -ba_0_+(m[i_]+ba_0_)*ll0_;
+        dsh_q10 =  3;
+        k = pow( 0.25+exp((v+ 83.5)/ 6.2999999999999998),  0.5)- 0.5;
+        alpha1 = dsh_q10*exp( -(v+ 160.30000000000001)/ 17.800000000000001);
+        beta1 = alpha1*k;
+        alpha2 = dsh_q10*( 1+exp((v+ 37.399999999999999)/ 30))/ 240/( 1+k);
+        beta2 = alpha2*k;
+        a_0_ =  1- -1*alpha2*dt;
+        a_1_ =  -( -1* -beta2*dt);
+        a_2_ =  1- -beta1*dt;
+        a_3_ =  -(alpha1*dt);
+        a_4_ =  -(alpha2*dt);
+        a_5_ =  -( -1* -beta1*dt);
+        a_6_ =  1-( -1*alpha1+ -beta2)*dt;
+        t_0_ = a_2_*a_4_;
+        t_1_ = a_2_*a_6_-a_5_*a_3_;
+        t_2_ = a_2_*s[i_]-a_5_*h[i_];
+        t_3_ = t_0_*a_1_-a_0_*t_1_;
+        t_4_ = t_0_*d[i_]-a_0_*t_2_;
+        t_5_ = t_3_*a_2_;
+        t_6_ = t_3_*h[i_]-a_3_*t_4_;
+        t_7_ = t_3_*t_0_;
+        t_8_ = t_3_*t_2_-t_1_*t_4_;
+        s[i_] = t_4_/t_3_;
+        h[i_] = t_6_/t_5_;
+        d[i_] = t_8_/t_7_;
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_test_kinlva::nrn_current() {
+    {
+        static auto id = ::arb::profile::profiler_region_id("advance_integrate_current_testkinlva");
+        ::arb::profile::profiler_enter(id);
+    }
+    int n_ = width_;
+    for (int i_ = 0; i_ < n_; ++i_) {
+        value_type v = vec_v_[node_index_[i_]];
+        value_type ica = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type il;
+        current_ =  0.;
+        conductivity_ =  0.;
+        ica = gbar*pow(m[i_],  3)*h[i_]*(v-eca);
+        current_ = current_+ica;
+        conductivity_ = conductivity_+gbar*pow(m[i_],  3)*h[i_];
+        il = gl*(v-el);
+        current_ = current_+il;
+        conductivity_ = conductivity_+gl;
+        ion_ca_.current_density[ion_ca_index_[i_]] = fma(10*weight_[i_], ica, ion_ca_.current_density[ion_ca_index_[i_]]);
+        vec_g_[node_index_[i_]] = fma(10*weight_[i_], conductivity_, vec_g_[node_index_[i_]]);
+        vec_i_[node_index_[i_]] = fma(10*weight_[i_], current_, vec_i_[node_index_[i_]]);
+    }
+    ::arb::profile::profiler_leave();
+}
+
+void mechanism_cpu_test_kinlva::write_ions() {
+}
+
+} // namespace arb
@@ -0,0 +1,103 @@
+#include <backends/gpu/mechanism.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+struct mechanism_gpu_test_kinlva_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type el = -65;
+    value_type eca = 120;
+    value_type gl = 0.0001;
+    value_type gbar = 0.00020000000000000001;
+    value_type* m;
+    value_type* s;
+    value_type* h;
+    value_type* d;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+void mechanism_gpu_test_kinlva_nrn_init_(mechanism_gpu_test_kinlva_pp_&);
+void mechanism_gpu_test_kinlva_nrn_state_(mechanism_gpu_test_kinlva_pp_&);
+void mechanism_gpu_test_kinlva_nrn_current_(mechanism_gpu_test_kinlva_pp_&);
+void mechanism_gpu_test_kinlva_write_ions_(mechanism_gpu_test_kinlva_pp_&);
+
+class mechanism_gpu_test_kinlva: public ::arb::gpu::mechanism {
+public:
+    const ::arb::mechanism_fingerprint& fingerprint() const override {
+        static ::arb::mechanism_fingerprint hash = "<placeholder>";
+        return hash;
+    }
+
+    std::string internal_name() const override { return "test_kinlva"; }
+    ::arb::mechanismKind kind() const override { return ::arb::mechanismKind::density; }
+    ::arb::mechanism_ptr clone() const override { return ::arb::mechanism_ptr(new mechanism_gpu_test_kinlva()); }
+
+    void nrn_init() override {
+        mechanism_gpu_test_kinlva_nrn_init_(pp_);
+    }
+
+    void nrn_state() override {
+        mechanism_gpu_test_kinlva_nrn_state_(pp_);
+    }
+
+    void nrn_current() override {
+        mechanism_gpu_test_kinlva_nrn_current_(pp_);
+    }
+
+    void write_ions() override {
+        mechanism_gpu_test_kinlva_write_ions_(pp_);
+    }
+
+protected:
+    std::size_t object_sizeof() const override { return sizeof(*this); }
+    ::arb::gpu::mechanism_ppack_base* ppack_ptr() { return &pp_; }
+
+    mechanism_global_table global_table() override {
+        return {
+            {"el", &pp_.el},
+            {"eca", &pp_.eca},
+            {"gl", &pp_.gl},
+            {"gbar", &pp_.gbar}
+        };
+    }
+    mechanism_field_table field_table() override {
+        return {
+            {"m", &pp_.m},
+            {"s", &pp_.s},
+            {"h", &pp_.h},
+            {"d", &pp_.d}
+        };
+    }
+    mechanism_field_default_table field_default_table() override {
+        return {
+        };
+    }
+    mechanism_state_table state_table() override {
+        return {
+            {"m", &pp_.m},
+            {"s", &pp_.s},
+            {"h", &pp_.h},
+            {"d", &pp_.d}
+        };
+    }
+    mechanism_ion_state_table ion_state_table() override {
+        return {
+            {"ca", &pp_.ion_ca_}
+        };
+    }
+    mechanism_ion_index_table ion_index_table() override {
+        return {
+            {"ca", &pp_.ion_ca_index_}
+        };
+    }
+
+private:
+    mechanism_gpu_test_kinlva_pp_ pp_;
+};
+
+template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_test_kinlva();
+template <> ::arb::concrete_mech_ptr<::arb::gpu::backend> make_mechanism_test_kinlva<::arb::gpu::backend>() {
+    return ::arb::concrete_mech_ptr<::arb::gpu::backend>(new mechanism_gpu_test_kinlva());
+}
+
+} // namespace arb
@@ -0,0 +1,145 @@
+#include <iostream>
+#include <backends/event.hpp>
+#include <backends/multi_event_stream_state.hpp>
+#include <backends/gpu/cuda_common.hpp>
+#include <backends/gpu/math_cu.hpp>
+#include <backends/gpu/mechanism_ppack_base.hpp>
+
+namespace arb {
+
+using value_type = ::arb::gpu::mechanism_ppack_base::value_type;
+using index_type = ::arb::gpu::mechanism_ppack_base::index_type;
+
+struct mechanism_gpu_test_kinlva_pp_: ::arb::gpu::mechanism_ppack_base {
+    value_type el = -65;
+    value_type eca = 120;
+    value_type gl = 0.0001;
+    value_type gbar = 0.00020000000000000001;
+    value_type* m;
+    value_type* s;
+    value_type* h;
+    value_type* d;
+    ion_state_view ion_ca_;
+    const index_type* ion_ca_index_;
+};
+
+namespace {
+
+using ::arb::gpu::exprelr;
+using ::arb::gpu::min;
+using ::arb::gpu::max;
+
+__global__
+void nrn_init(mechanism_gpu_test_kinlva_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type vrest, k;
+        vrest =  -65;
+        k = pow( 0.25+exp((v+ 83.5)/ 6.2999999999999998),  0.5)- 0.5;
+        params_.m[tid_] =  1/( 1+exp( -(vrest+ 63)/ 7.7999999999999998));
+        params_.h[tid_] =  1/( 1+k+pow(k,  2));
+        params_.d[tid_] = params_.h[tid_]*pow(k,  2);
+        params_.s[tid_] =  1-params_.h[tid_]-params_.d[tid_];
+    }
+}
+
+__global__
+void nrn_state(mechanism_gpu_test_kinlva_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type dt = params_.vec_dt_[node_index_i_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type t_8_, beta1, alpha1, alpha2, dsh_q10, t_1_, t_7_, beta2, ll0_, ba_0_, mi, taum, ll1_, a_4_, m_q10, a_2_, k, a_6_, t_4_, a_0_, a_1_, a_3_, a_5_, t_0_, t_2_, t_3_, t_5_, t_6_;
+        m_q10 =  5;
+        mi =  1/( 1+exp( -(v+ 63)/ 7.7999999999999998));
+        taum = ( 1.7+exp( -(v+ 28.800000000000001)/ 13.5))*mi;
+        a_0_ = m_q10* -1/taum;
+        ba_0_ = m_q10*mi/taum/a_0_;
+        ll1_ = a_0_*dt;
+        ll0_ = ( 1+ 0.5*ll1_)/( 1- 0.5*ll1_);
+        params_.m[tid_] =  -ba_0_+(params_.m[tid_]+ba_0_)*ll0_;
+        dsh_q10 =  3;
+        k = pow( 0.25+exp((v+ 83.5)/ 6.2999999999999998),  0.5)- 0.5;
+        alpha1 = dsh_q10*exp( -(v+ 160.30000000000001)/ 17.800000000000001);
+        beta1 = alpha1*k;
+        alpha2 = dsh_q10*( 1+exp((v+ 37.399999999999999)/ 30))/ 240/( 1+k);
+        beta2 = alpha2*k;
+        a_0_ =  1- -1*alpha2*dt;
+        a_1_ =  -( -1* -beta2*dt);
+        a_2_ =  1- -beta1*dt;
+        a_3_ =  -(alpha1*dt);
+        a_4_ =  -(alpha2*dt);
+        a_5_ =  -( -1* -beta1*dt);
+        a_6_ =  1-( -1*alpha1+ -beta2)*dt;
+        t_0_ = a_2_*a_4_;
+        t_1_ = a_2_*a_6_-a_5_*a_3_;
+        t_2_ = a_2_*params_.s[tid_]-a_5_*params_.h[tid_];
+        t_3_ = t_0_*a_1_-a_0_*t_1_;
+        t_4_ = t_0_*params_.d[tid_]-a_0_*t_2_;
+        t_5_ = t_3_*a_2_;
+        t_6_ = t_3_*params_.h[tid_]-a_3_*t_4_;
+        t_7_ = t_3_*t_0_;
+        t_8_ = t_3_*t_2_-t_1_*t_4_;
+        params_.s[tid_] = t_4_/t_3_;
+        params_.h[tid_] = t_6_/t_5_;
+        params_.d[tid_] = t_8_/t_7_;
+    }
+}
+
+__global__
+void nrn_current(mechanism_gpu_test_kinlva_pp_ params_) {
+    int n_ = params_.width_;
+    int tid_ = threadIdx.x + blockDim.x*blockIdx.x;
+    if (tid_<n_) {
+        auto ion_ca_index_i_ = params_.ion_ca_index_[tid_];
+        auto node_index_i_ = params_.node_index_[tid_];
+        value_type v = params_.vec_v_[node_index_i_];
+        value_type ica = 0;
+        value_type conductivity_ = 0;
+        value_type current_ = 0;
+        value_type il;
+        current_ =  0.;
+        conductivity_ =  0.;
+        ica = params_.gbar*pow(params_.m[tid_],  3)*params_.h[tid_]*(v-params_.eca);
+        current_ = current_+ica;
+        conductivity_ = conductivity_+params_.gbar*pow(params_.m[tid_],  3)*params_.h[tid_];
+        il = params_.gl*(v-params_.el);
+        current_ = current_+il;
+        conductivity_ = conductivity_+params_.gl;
+        params_.ion_ca_.current_density[ion_ca_index_i_] = fma(10*params_.weight_[tid_], ica, params_.ion_ca_.current_density[ion_ca_index_i_]);
+        params_.vec_g_[node_index_i_] = fma(10*params_.weight_[tid_], conductivity_, params_.vec_g_[node_index_i_]);
+        params_.vec_i_[node_index_i_] = fma(10*params_.weight_[tid_], current_, params_.vec_i_[node_index_i_]);
+    }
+}
+
+} // namspace
+
+void mechanism_gpu_test_kinlva_nrn_init_(mechanism_gpu_test_kinlva_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_init<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_test_kinlva_nrn_current_(mechanism_gpu_test_kinlva_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_current<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_test_kinlva_nrn_state_(mechanism_gpu_test_kinlva_pp_& p) {
+    auto n = p.width_;
+    unsigned block_dim = 128;
+    unsigned grid_dim = ::arb::gpu::impl::block_count(n, block_dim);
+    nrn_state<<<grid_dim, block_dim>>>(p);
+}
+
+void mechanism_gpu_test_kinlva_write_ions_(mechanism_gpu_test_kinlva_pp_& p) {}
+
+} // namespace arb
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "../lib/libmodcc.a"
+  "../lib/libmodcc.pdb"
+  "CMakeFiles/libmodcc.dir/astmanip.cpp.o"
+  "CMakeFiles/libmodcc.dir/astmanip.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/blocks.cpp.o"
+  "CMakeFiles/libmodcc.dir/blocks.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/errorvisitor.cpp.o"
+  "CMakeFiles/libmodcc.dir/errorvisitor.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/expression.cpp.o"
+  "CMakeFiles/libmodcc.dir/expression.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/functionexpander.cpp.o"
+  "CMakeFiles/libmodcc.dir/functionexpander.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/functioninliner.cpp.o"
+  "CMakeFiles/libmodcc.dir/functioninliner.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/io/prefixbuf.cpp.o"
+  "CMakeFiles/libmodcc.dir/io/prefixbuf.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/kineticrewriter.cpp.o"
+  "CMakeFiles/libmodcc.dir/kineticrewriter.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/lexer.cpp.o"
+  "CMakeFiles/libmodcc.dir/lexer.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/linearrewriter.cpp.o"
+  "CMakeFiles/libmodcc.dir/linearrewriter.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/module.cpp.o"
+  "CMakeFiles/libmodcc.dir/module.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/parser.cpp.o"
+  "CMakeFiles/libmodcc.dir/parser.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/printer/cexpr_emit.cpp.o"
+  "CMakeFiles/libmodcc.dir/printer/cexpr_emit.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/printer/cprinter.cpp.o"
+  "CMakeFiles/libmodcc.dir/printer/cprinter.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/printer/cudaprinter.cpp.o"
+  "CMakeFiles/libmodcc.dir/printer/cudaprinter.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/printer/infoprinter.cpp.o"
+  "CMakeFiles/libmodcc.dir/printer/infoprinter.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/printer/printerutil.cpp.o"
+  "CMakeFiles/libmodcc.dir/printer/printerutil.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/solvers.cpp.o"
+  "CMakeFiles/libmodcc.dir/solvers.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/symdiff.cpp.o"
+  "CMakeFiles/libmodcc.dir/symdiff.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/symge.cpp.o"
+  "CMakeFiles/libmodcc.dir/symge.cpp.o.d"
+  "CMakeFiles/libmodcc.dir/token.cpp.o"
+  "CMakeFiles/libmodcc.dir/token.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libmodcc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
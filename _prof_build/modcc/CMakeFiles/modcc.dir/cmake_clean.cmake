@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/modcc"
+  "../bin/modcc.pdb"
+  "CMakeFiles/modcc.dir/modcc.cpp.o"
+  "CMakeFiles/modcc.dir/modcc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/modcc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
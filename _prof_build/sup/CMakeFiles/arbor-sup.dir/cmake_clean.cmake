@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../lib/libarborsup.a"
+  "../lib/libarborsup.pdb"
+  "CMakeFiles/arbor-sup.dir/glob_basic.cpp.o"
+  "CMakeFiles/arbor-sup.dir/glob_basic.cpp.o.d"
+  "CMakeFiles/arbor-sup.dir/glob_posix.cpp.o"
+  "CMakeFiles/arbor-sup.dir/glob_posix.cpp.o.d"
+  "CMakeFiles/arbor-sup.dir/ioutil.cpp.o"
+  "CMakeFiles/arbor-sup.dir/ioutil.cpp.o.d"
+  "CMakeFiles/arbor-sup.dir/json_meter.cpp.o"
+  "CMakeFiles/arbor-sup.dir/json_meter.cpp.o.d"
+  "CMakeFiles/arbor-sup.dir/path.cpp.o"
+  "CMakeFiles/arbor-sup.dir/path.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arbor-sup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../lib/libgtest.a"
+  "../lib/libgtest.pdb"
+  "CMakeFiles/gtest.dir/gtest-all.cpp.o"
+  "CMakeFiles/gtest.dir/gtest-all.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/accumulate_functor_values"
+  "../../bin/accumulate_functor_values.pdb"
+  "CMakeFiles/accumulate_functor_values.dir/accumulate_functor_values.cpp.o"
+  "CMakeFiles/accumulate_functor_values.dir/accumulate_functor_values.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/accumulate_functor_values.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
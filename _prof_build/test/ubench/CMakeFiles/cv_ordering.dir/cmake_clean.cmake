@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cv_ordering"
+  "../../bin/cv_ordering.pdb"
+  "CMakeFiles/cv_ordering.dir/cv_ordering.cpp.o"
+  "CMakeFiles/cv_ordering.dir/cv_ordering.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cv_ordering.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
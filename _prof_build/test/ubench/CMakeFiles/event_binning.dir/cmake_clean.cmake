@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/event_binning"
+  "../../bin/event_binning.pdb"
+  "CMakeFiles/event_binning.dir/event_binning.cpp.o"
+  "CMakeFiles/event_binning.dir/event_binning.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/event_binning.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/event_setup"
+  "../../bin/event_setup.pdb"
+  "CMakeFiles/event_setup.dir/event_setup.cpp.o"
+  "CMakeFiles/event_setup.dir/event_setup.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/event_setup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
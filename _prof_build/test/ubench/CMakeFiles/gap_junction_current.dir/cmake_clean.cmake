@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/gap_junction_current"
+  "../../bin/gap_junction_current.pdb"
+  "CMakeFiles/gap_junction_current.dir/gap_junction_current.cpp.o"
+  "CMakeFiles/gap_junction_current.dir/gap_junction_current.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gap_junction_current.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
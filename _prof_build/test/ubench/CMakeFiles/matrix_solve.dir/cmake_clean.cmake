@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/matrix_solve"
+  "../../bin/matrix_solve.pdb"
+  "CMakeFiles/matrix_solve.dir/matrix_solve.cpp.o"
+  "CMakeFiles/matrix_solve.dir/matrix_solve.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matrix_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mech_vec"
+  "../../bin/mech_vec.pdb"
+  "CMakeFiles/mech_vec.dir/mech_vec.cpp.o"
+  "CMakeFiles/mech_vec.dir/mech_vec.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mech_vec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
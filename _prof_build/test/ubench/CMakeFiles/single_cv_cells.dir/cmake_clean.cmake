@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/single_cv_cells"
+  "../../bin/single_cv_cells.pdb"
+  "CMakeFiles/single_cv_cells.dir/single_cv_cells.cpp.o"
+  "CMakeFiles/single_cv_cells.dir/single_cv_cells.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/single_cv_cells.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
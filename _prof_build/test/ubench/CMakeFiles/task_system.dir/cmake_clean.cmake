@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/task_system"
+  "../../bin/task_system.pdb"
+  "CMakeFiles/task_system.dir/task_system.cpp.o"
+  "CMakeFiles/task_system.dir/task_system.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task_system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/threshold_watcher"
+  "../../bin/threshold_watcher.pdb"
+  "CMakeFiles/threshold_watcher.dir/threshold_watcher.cpp.o"
+  "CMakeFiles/threshold_watcher.dir/threshold_watcher.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threshold_watcher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
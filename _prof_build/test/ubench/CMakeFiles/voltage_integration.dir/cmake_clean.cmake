@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/voltage_integration"
+  "../../bin/voltage_integration.pdb"
+  "CMakeFiles/voltage_integration.dir/voltage_integration.cpp.o"
+  "CMakeFiles/voltage_integration.dir/voltage_integration.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/voltage_integration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
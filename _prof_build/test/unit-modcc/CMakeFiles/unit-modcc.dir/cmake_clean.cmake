@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "../../bin/unit-modcc"
+  "../../bin/unit-modcc.pdb"
+  "CMakeFiles/unit-modcc.dir/common.cpp.o"
+  "CMakeFiles/unit-modcc.dir/common.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/driver.cpp.o"
+  "CMakeFiles/unit-modcc.dir/driver.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/expr_expand.cpp.o"
+  "CMakeFiles/unit-modcc.dir/expr_expand.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_kinetic_rewriter.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_kinetic_rewriter.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_lexer.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_lexer.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_module.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_module.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_msparse.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_msparse.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_parser.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_parser.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_prefixbuf.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_prefixbuf.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_printers.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_printers.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_removelocals.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_removelocals.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_simd_backend.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_simd_backend.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_symdiff.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_symdiff.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_symge.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_symge.cpp.o.d"
+  "CMakeFiles/unit-modcc.dir/test_visitors.cpp.o"
+  "CMakeFiles/unit-modcc.dir/test_visitors.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-modcc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,95 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_prof_build/test/unit/mechanisms/celsius_test_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/celsius_test_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/celsius_test_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/celsius_test.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/diam_test_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/diam_test_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/diam_test_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/diam_test.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/fixed_ica_current_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/fixed_ica_current_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/fixed_ica_current_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/fixed_ica_current.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/linear_ca_conc_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/linear_ca_conc_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/linear_ca_conc_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/linear_ca_conc.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/point_ica_current_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/point_ica_current_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/point_ica_current_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/point_ica_current.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/read_eX_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/read_eX_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/read_eX_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/read_eX.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_compartment_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_compartment_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_compartment_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_conserve_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_conserve_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_conserve_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_conserve.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_diff_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_diff_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_diff_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_steadystate_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_steadystate_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_steadystate_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test0_kin_steadystate.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_compartment_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_compartment_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_compartment_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_conserve_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_conserve_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_conserve_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_conserve.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_diff_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_diff_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_diff_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_steadystate_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_steadystate_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_steadystate_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test1_kin_steadystate.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test2_kin_diff_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test2_kin_diff_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test2_kin_diff_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test2_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test3_kin_diff_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test3_kin_diff_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test3_kin_diff_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test3_kin_diff.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test4_kin_compartment_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test4_kin_compartment_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test4_kin_compartment_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test4_kin_compartment.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_ca_read_valence_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_ca_read_valence_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_ca_read_valence_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test_ca_read_valence.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_cl_valence_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_cl_valence_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_cl_valence_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test_cl_valence.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_shuffle_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_shuffle_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_shuffle_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_init_shuffle.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_state_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_state_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/test_linear_state_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/test_linear_state.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/write_eX_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/write_eX_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/write_eX_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/write_eX.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/write_multiple_eX_cpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/write_multiple_eX_gpu.cpp" "/root/repo/_prof_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  "/root/repo/_prof_build/test/unit/mechanisms/write_multiple_eX_gpu.cu" "/root/repo/_prof_build/test/unit/mechanisms/write_multiple_eX.hpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,104 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_test_mods"
+  "mechanisms/celsius_test.hpp"
+  "mechanisms/celsius_test_cpu.cpp"
+  "mechanisms/celsius_test_gpu.cpp"
+  "mechanisms/celsius_test_gpu.cu"
+  "mechanisms/diam_test.hpp"
+  "mechanisms/diam_test_cpu.cpp"
+  "mechanisms/diam_test_gpu.cpp"
+  "mechanisms/diam_test_gpu.cu"
+  "mechanisms/fixed_ica_current.hpp"
+  "mechanisms/fixed_ica_current_cpu.cpp"
+  "mechanisms/fixed_ica_current_gpu.cpp"
+  "mechanisms/fixed_ica_current_gpu.cu"
+  "mechanisms/linear_ca_conc.hpp"
+  "mechanisms/linear_ca_conc_cpu.cpp"
+  "mechanisms/linear_ca_conc_gpu.cpp"
+  "mechanisms/linear_ca_conc_gpu.cu"
+  "mechanisms/point_ica_current.hpp"
+  "mechanisms/point_ica_current_cpu.cpp"
+  "mechanisms/point_ica_current_gpu.cpp"
+  "mechanisms/point_ica_current_gpu.cu"
+  "mechanisms/read_eX.hpp"
+  "mechanisms/read_eX_cpu.cpp"
+  "mechanisms/read_eX_gpu.cpp"
+  "mechanisms/read_eX_gpu.cu"
+  "mechanisms/test0_kin_compartment.hpp"
+  "mechanisms/test0_kin_compartment_cpu.cpp"
+  "mechanisms/test0_kin_compartment_gpu.cpp"
+  "mechanisms/test0_kin_compartment_gpu.cu"
+  "mechanisms/test0_kin_conserve.hpp"
+  "mechanisms/test0_kin_conserve_cpu.cpp"
+  "mechanisms/test0_kin_conserve_gpu.cpp"
+  "mechanisms/test0_kin_conserve_gpu.cu"
+  "mechanisms/test0_kin_diff.hpp"
+  "mechanisms/test0_kin_diff_cpu.cpp"
+  "mechanisms/test0_kin_diff_gpu.cpp"
+  "mechanisms/test0_kin_diff_gpu.cu"
+  "mechanisms/test0_kin_steadystate.hpp"
+  "mechanisms/test0_kin_steadystate_cpu.cpp"
+  "mechanisms/test0_kin_steadystate_gpu.cpp"
+  "mechanisms/test0_kin_steadystate_gpu.cu"
+  "mechanisms/test1_kin_compartment.hpp"
+  "mechanisms/test1_kin_compartment_cpu.cpp"
+  "mechanisms/test1_kin_compartment_gpu.cpp"
+  "mechanisms/test1_kin_compartment_gpu.cu"
+  "mechanisms/test1_kin_conserve.hpp"
+  "mechanisms/test1_kin_conserve_cpu.cpp"
+  "mechanisms/test1_kin_conserve_gpu.cpp"
+  "mechanisms/test1_kin_conserve_gpu.cu"
+  "mechanisms/test1_kin_diff.hpp"
+  "mechanisms/test1_kin_diff_cpu.cpp"
+  "mechanisms/test1_kin_diff_gpu.cpp"
+  "mechanisms/test1_kin_diff_gpu.cu"
+  "mechanisms/test1_kin_steadystate.hpp"
+  "mechanisms/test1_kin_steadystate_cpu.cpp"
+  "mechanisms/test1_kin_steadystate_gpu.cpp"
+  "mechanisms/test1_kin_steadystate_gpu.cu"
+  "mechanisms/test2_kin_diff.hpp"
+  "mechanisms/test2_kin_diff_cpu.cpp"
+  "mechanisms/test2_kin_diff_gpu.cpp"
+  "mechanisms/test2_kin_diff_gpu.cu"
+  "mechanisms/test3_kin_diff.hpp"
+  "mechanisms/test3_kin_diff_cpu.cpp"
+  "mechanisms/test3_kin_diff_gpu.cpp"
+  "mechanisms/test3_kin_diff_gpu.cu"
+  "mechanisms/test4_kin_compartment.hpp"
+  "mechanisms/test4_kin_compartment_cpu.cpp"
+  "mechanisms/test4_kin_compartment_gpu.cpp"
+  "mechanisms/test4_kin_compartment_gpu.cu"
+  "mechanisms/test_ca_read_valence.hpp"
+  "mechanisms/test_ca_read_valence_cpu.cpp"
+  "mechanisms/test_ca_read_valence_gpu.cpp"
+  "mechanisms/test_ca_read_valence_gpu.cu"
+  "mechanisms/test_cl_valence.hpp"
+  "mechanisms/test_cl_valence_cpu.cpp"
+  "mechanisms/test_cl_valence_gpu.cpp"
+  "mechanisms/test_cl_valence_gpu.cu"
+  "mechanisms/test_linear_init.hpp"
+  "mechanisms/test_linear_init_cpu.cpp"
+  "mechanisms/test_linear_init_gpu.cpp"
+  "mechanisms/test_linear_init_gpu.cu"
+  "mechanisms/test_linear_init_shuffle.hpp"
+  "mechanisms/test_linear_init_shuffle_cpu.cpp"
+  "mechanisms/test_linear_init_shuffle_gpu.cpp"
+  "mechanisms/test_linear_init_shuffle_gpu.cu"
+  "mechanisms/test_linear_state.hpp"
+  "mechanisms/test_linear_state_cpu.cpp"
+  "mechanisms/test_linear_state_gpu.cpp"
+  "mechanisms/test_linear_state_gpu.cu"
+  "mechanisms/write_eX.hpp"
+  "mechanisms/write_eX_cpu.cpp"
+  "mechanisms/write_eX_gpu.cpp"
+  "mechanisms/write_eX_gpu.cu"
+  "mechanisms/write_multiple_eX.hpp"
+  "mechanisms/write_multiple_eX_cpu.cpp"
+  "mechanisms/write_multiple_eX_gpu.cpp"
+  "mechanisms/write_multiple_eX_gpu.cu"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_test_mods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
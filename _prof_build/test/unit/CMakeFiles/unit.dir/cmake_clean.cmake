@@ -0,0 +1,293 @@
+file(REMOVE_RECURSE
+  "../../bin/unit"
+  "../../bin/unit.pdb"
+  "CMakeFiles/unit.dir/instrument_malloc.cpp.o"
+  "CMakeFiles/unit.dir/instrument_malloc.cpp.o.d"
+  "CMakeFiles/unit.dir/mech_private_field_access.cpp.o"
+  "CMakeFiles/unit.dir/mech_private_field_access.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/celsius_test_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/celsius_test_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/diam_test_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/diam_test_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/fixed_ica_current_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/fixed_ica_current_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/linear_ca_conc_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/linear_ca_conc_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/point_ica_current_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/point_ica_current_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/read_eX_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/read_eX_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test0_kin_compartment_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test0_kin_compartment_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test0_kin_conserve_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test0_kin_conserve_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test0_kin_diff_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test0_kin_diff_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test0_kin_steadystate_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test0_kin_steadystate_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test1_kin_compartment_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test1_kin_compartment_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test1_kin_conserve_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test1_kin_conserve_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test1_kin_diff_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test1_kin_diff_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test1_kin_steadystate_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test1_kin_steadystate_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test2_kin_diff_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test2_kin_diff_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test3_kin_diff_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test3_kin_diff_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test4_kin_compartment_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test4_kin_compartment_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test_ca_read_valence_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test_ca_read_valence_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test_cl_valence_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test_cl_valence_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test_linear_init_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test_linear_init_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test_linear_init_shuffle_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test_linear_init_shuffle_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/test_linear_state_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/test_linear_state_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/write_eX_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/write_eX_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/mechanisms/write_multiple_eX_cpu.cpp.o"
+  "CMakeFiles/unit.dir/mechanisms/write_multiple_eX_cpu.cpp.o.d"
+  "CMakeFiles/unit.dir/stats.cpp.o"
+  "CMakeFiles/unit.dir/stats.cpp.o.d"
+  "CMakeFiles/unit.dir/test.cpp.o"
+  "CMakeFiles/unit.dir/test.cpp.o.d"
+  "CMakeFiles/unit.dir/test_algorithms.cpp.o"
+  "CMakeFiles/unit.dir/test_algorithms.cpp.o.d"
+  "CMakeFiles/unit.dir/test_any.cpp.o"
+  "CMakeFiles/unit.dir/test_any.cpp.o.d"
+  "CMakeFiles/unit.dir/test_backend.cpp.o"
+  "CMakeFiles/unit.dir/test_backend.cpp.o.d"
+  "CMakeFiles/unit.dir/test_cable_cell.cpp.o"
+  "CMakeFiles/unit.dir/test_cable_cell.cpp.o.d"
+  "CMakeFiles/unit.dir/test_compartments.cpp.o"
+  "CMakeFiles/unit.dir/test_compartments.cpp.o.d"
+  "CMakeFiles/unit.dir/test_counter.cpp.o"
+  "CMakeFiles/unit.dir/test_counter.cpp.o.d"
+  "CMakeFiles/unit.dir/test_cv_policy.cpp.o"
+  "CMakeFiles/unit.dir/test_cv_policy.cpp.o.d"
+  "CMakeFiles/unit.dir/test_cycle.cpp.o"
+  "CMakeFiles/unit.dir/test_cycle.cpp.o.d"
+  "CMakeFiles/unit.dir/test_domain_decomposition.cpp.o"
+  "CMakeFiles/unit.dir/test_domain_decomposition.cpp.o.d"
+  "CMakeFiles/unit.dir/test_double_buffer.cpp.o"
+  "CMakeFiles/unit.dir/test_double_buffer.cpp.o.d"
+  "CMakeFiles/unit.dir/test_dry_run_context.cpp.o"
+  "CMakeFiles/unit.dir/test_dry_run_context.cpp.o.d"
+  "CMakeFiles/unit.dir/test_either.cpp.o"
+  "CMakeFiles/unit.dir/test_either.cpp.o.d"
+  "CMakeFiles/unit.dir/test_em_morphology.cpp.o"
+  "CMakeFiles/unit.dir/test_em_morphology.cpp.o.d"
+  "CMakeFiles/unit.dir/test_event_binner.cpp.o"
+  "CMakeFiles/unit.dir/test_event_binner.cpp.o.d"
+  "CMakeFiles/unit.dir/test_event_delivery.cpp.o"
+  "CMakeFiles/unit.dir/test_event_delivery.cpp.o.d"
+  "CMakeFiles/unit.dir/test_event_generators.cpp.o"
+  "CMakeFiles/unit.dir/test_event_generators.cpp.o.d"
+  "CMakeFiles/unit.dir/test_event_queue.cpp.o"
+  "CMakeFiles/unit.dir/test_event_queue.cpp.o.d"
+  "CMakeFiles/unit.dir/test_filter.cpp.o"
+  "CMakeFiles/unit.dir/test_filter.cpp.o.d"
+  "CMakeFiles/unit.dir/test_fvm_layout.cpp.o"
+  "CMakeFiles/unit.dir/test_fvm_layout.cpp.o.d"
+  "CMakeFiles/unit.dir/test_fvm_lowered.cpp.o"
+  "CMakeFiles/unit.dir/test_fvm_lowered.cpp.o.d"
+  "CMakeFiles/unit.dir/test_glob_basic.cpp.o"
+  "CMakeFiles/unit.dir/test_glob_basic.cpp.o.d"
+  "CMakeFiles/unit.dir/test_kinetic_linear.cpp.o"
+  "CMakeFiles/unit.dir/test_kinetic_linear.cpp.o.d"
+  "CMakeFiles/unit.dir/test_lexcmp.cpp.o"
+  "CMakeFiles/unit.dir/test_lexcmp.cpp.o.d"
+  "CMakeFiles/unit.dir/test_lif_cell_group.cpp.o"
+  "CMakeFiles/unit.dir/test_lif_cell_group.cpp.o.d"
+  "CMakeFiles/unit.dir/test_local_context.cpp.o"
+  "CMakeFiles/unit.dir/test_local_context.cpp.o.d"
+  "CMakeFiles/unit.dir/test_maputil.cpp.o"
+  "CMakeFiles/unit.dir/test_maputil.cpp.o.d"
+  "CMakeFiles/unit.dir/test_mask_stream.cpp.o"
+  "CMakeFiles/unit.dir/test_mask_stream.cpp.o.d"
+  "CMakeFiles/unit.dir/test_math.cpp.o"
+  "CMakeFiles/unit.dir/test_math.cpp.o.d"
+  "CMakeFiles/unit.dir/test_matrix.cpp.o"
+  "CMakeFiles/unit.dir/test_matrix.cpp.o.d"
+  "CMakeFiles/unit.dir/test_mc_cell_group.cpp.o"
+  "CMakeFiles/unit.dir/test_mc_cell_group.cpp.o.d"
+  "CMakeFiles/unit.dir/test_mech_temp_diam.cpp.o"
+  "CMakeFiles/unit.dir/test_mech_temp_diam.cpp.o.d"
+  "CMakeFiles/unit.dir/test_mechanisms.cpp.o"
+  "CMakeFiles/unit.dir/test_mechanisms.cpp.o.d"
+  "CMakeFiles/unit.dir/test_mechcat.cpp.o"
+  "CMakeFiles/unit.dir/test_mechcat.cpp.o.d"
+  "CMakeFiles/unit.dir/test_mechinfo.cpp.o"
+  "CMakeFiles/unit.dir/test_mechinfo.cpp.o.d"
+  "CMakeFiles/unit.dir/test_merge_events.cpp.o"
+  "CMakeFiles/unit.dir/test_merge_events.cpp.o.d"
+  "CMakeFiles/unit.dir/test_morphology.cpp.o"
+  "CMakeFiles/unit.dir/test_morphology.cpp.o.d"
+  "CMakeFiles/unit.dir/test_multi_event_stream.cpp.o"
+  "CMakeFiles/unit.dir/test_multi_event_stream.cpp.o.d"
+  "CMakeFiles/unit.dir/test_optional.cpp.o"
+  "CMakeFiles/unit.dir/test_optional.cpp.o.d"
+  "CMakeFiles/unit.dir/test_padded.cpp.o"
+  "CMakeFiles/unit.dir/test_padded.cpp.o.d"
+  "CMakeFiles/unit.dir/test_partition.cpp.o"
+  "CMakeFiles/unit.dir/test_partition.cpp.o.d"
+  "CMakeFiles/unit.dir/test_partition_by_constraint.cpp.o"
+  "CMakeFiles/unit.dir/test_partition_by_constraint.cpp.o.d"
+  "CMakeFiles/unit.dir/test_path.cpp.o"
+  "CMakeFiles/unit.dir/test_path.cpp.o.d"
+  "CMakeFiles/unit.dir/test_point.cpp.o"
+  "CMakeFiles/unit.dir/test_point.cpp.o.d"
+  "CMakeFiles/unit.dir/test_probe.cpp.o"
+  "CMakeFiles/unit.dir/test_probe.cpp.o.d"
+  "CMakeFiles/unit.dir/test_range.cpp.o"
+  "CMakeFiles/unit.dir/test_range.cpp.o.d"
+  "CMakeFiles/unit.dir/test_schedule.cpp.o"
+  "CMakeFiles/unit.dir/test_schedule.cpp.o.d"
+  "CMakeFiles/unit.dir/test_scope_exit.cpp.o"
+  "CMakeFiles/unit.dir/test_scope_exit.cpp.o.d"
+  "CMakeFiles/unit.dir/test_segment.cpp.o"
+  "CMakeFiles/unit.dir/test_segment.cpp.o.d"
+  "CMakeFiles/unit.dir/test_simd.cpp.o"
+  "CMakeFiles/unit.dir/test_simd.cpp.o.d"
+  "CMakeFiles/unit.dir/test_span.cpp.o"
+  "CMakeFiles/unit.dir/test_span.cpp.o.d"
+  "CMakeFiles/unit.dir/test_spike_source.cpp.o"
+  "CMakeFiles/unit.dir/test_spike_source.cpp.o.d"
+  "CMakeFiles/unit.dir/test_spike_store.cpp.o"
+  "CMakeFiles/unit.dir/test_spike_store.cpp.o.d"
+  "CMakeFiles/unit.dir/test_spikes.cpp.o"
+  "CMakeFiles/unit.dir/test_spikes.cpp.o.d"
+  "CMakeFiles/unit.dir/test_stats.cpp.o"
+  "CMakeFiles/unit.dir/test_stats.cpp.o.d"
+  "CMakeFiles/unit.dir/test_strprintf.cpp.o"
+  "CMakeFiles/unit.dir/test_strprintf.cpp.o.d"
+  "CMakeFiles/unit.dir/test_swcio.cpp.o"
+  "CMakeFiles/unit.dir/test_swcio.cpp.o.d"
+  "CMakeFiles/unit.dir/test_synapses.cpp.o"
+  "CMakeFiles/unit.dir/test_synapses.cpp.o.d"
+  "CMakeFiles/unit.dir/test_thread.cpp.o"
+  "CMakeFiles/unit.dir/test_thread.cpp.o.d"
+  "CMakeFiles/unit.dir/test_threading_exceptions.cpp.o"
+  "CMakeFiles/unit.dir/test_threading_exceptions.cpp.o.d"
+  "CMakeFiles/unit.dir/test_transform.cpp.o"
+  "CMakeFiles/unit.dir/test_transform.cpp.o.d"
+  "CMakeFiles/unit.dir/test_tree.cpp.o"
+  "CMakeFiles/unit.dir/test_tree.cpp.o.d"
+  "CMakeFiles/unit.dir/test_uninitialized.cpp.o"
+  "CMakeFiles/unit.dir/test_uninitialized.cpp.o.d"
+  "CMakeFiles/unit.dir/test_unique_any.cpp.o"
+  "CMakeFiles/unit.dir/test_unique_any.cpp.o.d"
+  "CMakeFiles/unit.dir/test_vector.cpp.o"
+  "CMakeFiles/unit.dir/test_vector.cpp.o.d"
+  "CMakeFiles/unit.dir/test_version.cpp.o"
+  "CMakeFiles/unit.dir/test_version.cpp.o.d"
+  "CMakeFiles/unit.dir/unit_test_catalogue.cpp.o"
+  "CMakeFiles/unit.dir/unit_test_catalogue.cpp.o.d"
+  "mechanisms/celsius_test.hpp"
+  "mechanisms/celsius_test_cpu.cpp"
+  "mechanisms/celsius_test_gpu.cpp"
+  "mechanisms/celsius_test_gpu.cu"
+  "mechanisms/diam_test.hpp"
+  "mechanisms/diam_test_cpu.cpp"
+  "mechanisms/diam_test_gpu.cpp"
+  "mechanisms/diam_test_gpu.cu"
+  "mechanisms/fixed_ica_current.hpp"
+  "mechanisms/fixed_ica_current_cpu.cpp"
+  "mechanisms/fixed_ica_current_gpu.cpp"
+  "mechanisms/fixed_ica_current_gpu.cu"
+  "mechanisms/linear_ca_conc.hpp"
+  "mechanisms/linear_ca_conc_cpu.cpp"
+  "mechanisms/linear_ca_conc_gpu.cpp"
+  "mechanisms/linear_ca_conc_gpu.cu"
+  "mechanisms/point_ica_current.hpp"
+  "mechanisms/point_ica_current_cpu.cpp"
+  "mechanisms/point_ica_current_gpu.cpp"
+  "mechanisms/point_ica_current_gpu.cu"
+  "mechanisms/read_eX.hpp"
+  "mechanisms/read_eX_cpu.cpp"
+  "mechanisms/read_eX_gpu.cpp"
+  "mechanisms/read_eX_gpu.cu"
+  "mechanisms/test0_kin_compartment.hpp"
+  "mechanisms/test0_kin_compartment_cpu.cpp"
+  "mechanisms/test0_kin_compartment_gpu.cpp"
+  "mechanisms/test0_kin_compartment_gpu.cu"
+  "mechanisms/test0_kin_conserve.hpp"
+  "mechanisms/test0_kin_conserve_cpu.cpp"
+  "mechanisms/test0_kin_conserve_gpu.cpp"
+  "mechanisms/test0_kin_conserve_gpu.cu"
+  "mechanisms/test0_kin_diff.hpp"
+  "mechanisms/test0_kin_diff_cpu.cpp"
+  "mechanisms/test0_kin_diff_gpu.cpp"
+  "mechanisms/test0_kin_diff_gpu.cu"
+  "mechanisms/test0_kin_steadystate.hpp"
+  "mechanisms/test0_kin_steadystate_cpu.cpp"
+  "mechanisms/test0_kin_steadystate_gpu.cpp"
+  "mechanisms/test0_kin_steadystate_gpu.cu"
+  "mechanisms/test1_kin_compartment.hpp"
+  "mechanisms/test1_kin_compartment_cpu.cpp"
+  "mechanisms/test1_kin_compartment_gpu.cpp"
+  "mechanisms/test1_kin_compartment_gpu.cu"
+  "mechanisms/test1_kin_conserve.hpp"
+  "mechanisms/test1_kin_conserve_cpu.cpp"
+  "mechanisms/test1_kin_conserve_gpu.cpp"
+  "mechanisms/test1_kin_conserve_gpu.cu"
+  "mechanisms/test1_kin_diff.hpp"
+  "mechanisms/test1_kin_diff_cpu.cpp"
+  "mechanisms/test1_kin_diff_gpu.cpp"
+  "mechanisms/test1_kin_diff_gpu.cu"
+  "mechanisms/test1_kin_steadystate.hpp"
+  "mechanisms/test1_kin_steadystate_cpu.cpp"
+  "mechanisms/test1_kin_steadystate_gpu.cpp"
+  "mechanisms/test1_kin_steadystate_gpu.cu"
+  "mechanisms/test2_kin_diff.hpp"
+  "mechanisms/test2_kin_diff_cpu.cpp"
+  "mechanisms/test2_kin_diff_gpu.cpp"
+  "mechanisms/test2_kin_diff_gpu.cu"
+  "mechanisms/test3_kin_diff.hpp"
+  "mechanisms/test3_kin_diff_cpu.cpp"
+  "mechanisms/test3_kin_diff_gpu.cpp"
+  "mechanisms/test3_kin_diff_gpu.cu"
+  "mechanisms/test4_kin_compartment.hpp"
+  "mechanisms/test4_kin_compartment_cpu.cpp"
+  "mechanisms/test4_kin_compartment_gpu.cpp"
+  "mechanisms/test4_kin_compartment_gpu.cu"
+  "mechanisms/test_ca_read_valence.hpp"
+  "mechanisms/test_ca_read_valence_cpu.cpp"
+  "mechanisms/test_ca_read_valence_gpu.cpp"
+  "mechanisms/test_ca_read_valence_gpu.cu"
+  "mechanisms/test_cl_valence.hpp"
+  "mechanisms/test_cl_valence_cpu.cpp"
+  "mechanisms/test_cl_valence_gpu.cpp"
+  "mechanisms/test_cl_valence_gpu.cu"
+  "mechanisms/test_linear_init.hpp"
+  "mechanisms/test_linear_init_cpu.cpp"
+  "mechanisms/test_linear_init_gpu.cpp"
+  "mechanisms/test_linear_init_gpu.cu"
+  "mechanisms/test_linear_init_shuffle.hpp"
+  "mechanisms/test_linear_init_shuffle_cpu.cpp"
+  "mechanisms/test_linear_init_shuffle_gpu.cpp"
+  "mechanisms/test_linear_init_shuffle_gpu.cu"
+  "mechanisms/test_linear_state.hpp"
+  "mechanisms/test_linear_state_cpu.cpp"
+  "mechanisms/test_linear_state_gpu.cpp"
+  "mechanisms/test_linear_state_gpu.cu"
+  "mechanisms/write_eX.hpp"
+  "mechanisms/write_eX_cpu.cpp"
+  "mechanisms/write_eX_gpu.cpp"
+  "mechanisms/write_eX_gpu.cu"
+  "mechanisms/write_multiple_eX.hpp"
+  "mechanisms/write_multiple_eX_cpu.cpp"
+  "mechanisms/write_multiple_eX_gpu.cpp"
+  "mechanisms/write_multiple_eX_gpu.cu"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
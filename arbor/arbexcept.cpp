@@ -26,8 +26,13 @@ bad_probe_id::bad_probe_id(cell_member_type probe_id):
     probe_id(probe_id)
 {}
 
+bad_probe_reduction::bad_probe_reduction(cell_member_type probe_id):
+    arbor_exception(pprintf("reduction probe {} requires at least two ascending histogram bin edges", probe_id)),
+    probe_id(probe_id)
+{}
+
 gj_unsupported_domain_decomposition::gj_unsupported_domain_decomposition(cell_gid_type gid_0, cell_gid_type gid_1):
-    arbor_exception(pprintf("No support for gap junctions across domain decomposition groups for gid {} and {}", gid_0, gid_1)),
+    arbor_exception(pprintf("No support for the gap junction from gid {} to gid {} across cell groups unless it is listed on both cells", gid_0, gid_1)),
     gid_0(gid_0),
     gid_1(gid_1)
 {}
@@ -49,13 +49,15 @@ inline deliverable_event_data event_data(const deliverable_event& ev) {
 }
 
 
-// Sample events (scalar values)
+// Sample events (one or more contiguous values)
 
 using probe_handle = const fvm_value_type*;
 
 struct raw_probe_info {
-    probe_handle handle;      // where the to-be-probed value sits
-    sample_size_type offset;  // offset into array to store raw probed value
+    probe_handle handle;            // where the to-be-probed value(s) sit
+    sample_size_type offset;        // offset into array to store sample time
+    sample_size_type value_offset;  // offset into array to store raw probed value(s)
+    sample_size_type width;         // number of values per sample
 };
 
 struct sample_event {
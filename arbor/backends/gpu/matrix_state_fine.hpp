@@ -8,6 +8,7 @@
 #include <arbor/common_types.hpp>
 
 #include "algorithms.hpp"
+#include "execution_context.hpp"
 #include "memory/memory.hpp"
 #include "util/partition.hpp"
 #include "util/rangeutil.hpp"
@@ -135,6 +136,17 @@ public:
 
     matrix_state_fine() = default;
 
+    // The execution context is not used by the GPU solver.
+    matrix_state_fine(const std::vector<size_type>& p,
+                 const std::vector<size_type>& cell_cv_divs,
+                 const std::vector<value_type>& cap,
+                 const std::vector<value_type>& face_conductance,
+                 const std::vector<value_type>& area,
+                 const std::vector<size_type>& cell_intdom,
+                 const execution_context&):
+        matrix_state_fine(p, cell_cv_divs, cap, face_conductance, area, cell_intdom)
+    {}
+
     // constructor for fine-grained matrix.
     matrix_state_fine(const std::vector<size_type>& p,
                  const std::vector<size_type>& cell_cv_divs,
@@ -457,6 +469,11 @@ public:
     }
 
     void solve() {
+        solve(solution_);
+    }
+
+    // Solve, writing the unpermuted solution to `to`.
+    void solve(array& to) {
         solve_matrix_fine(
             rhs.data(), d.data(), u.data(),
             levels.data(), levels_start.data(),
@@ -465,7 +482,7 @@ public:
             num_cells_in_block.size(), max_branches_per_level);
 
         // unpermute the solution
-        packed_to_flat(rhs, solution_);
+        packed_to_flat(rhs, to);
     }
 
     const_view solution() const {
@@ -138,6 +138,12 @@ struct matrix_state_flat {
                           cell_cv_divs.data(), num_matrices());
     }
 
+    // The solve is in place: copy the solution to `to`.
+    void solve(array& to) {
+        solve();
+        memory::copy(rhs, to);
+    }
+
     std::size_t size() const {
         return parent_index.size();
     }
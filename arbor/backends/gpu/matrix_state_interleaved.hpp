@@ -4,6 +4,7 @@
 #include <arbor/fvm_types.hpp>
 #include <arbor/math.hpp>
 
+#include "execution_context.hpp"
 #include "memory/memory.hpp"
 #include "util/span.hpp"
 #include "util/partition.hpp"
@@ -138,6 +139,17 @@ struct matrix_state_interleaved {
     // default constructor
     matrix_state_interleaved() = default;
 
+    // The execution context is not used by the GPU solver.
+    matrix_state_interleaved(const std::vector<index_type>& p,
+                 const std::vector<index_type>& cell_cv_divs,
+                 const std::vector<value_type>& cv_cap,
+                 const std::vector<value_type>& face_cond,
+                 const std::vector<value_type>& area,
+                 const std::vector<index_type>& cell_intdom,
+                 const execution_context&):
+        matrix_state_interleaved(p, cell_cv_divs, cv_cap, face_cond, area, cell_intdom)
+    {}
+
     // Construct matrix state for a set of matrices defined by parent_index p
     // The matrix solver stores the matrix in an "interleaved" structure for
     // optimal solution, which requires a significant amount of precomputing
@@ -280,6 +292,11 @@ struct matrix_state_interleaved {
     }
 
     void solve() {
+        solve(solution_);
+    }
+
+    // Solve, writing the un-interleaved solution to `to`.
+    void solve(array& to) {
         // Perform the Hines solve.
         solve_matrix_interleaved(
              rhs.data(), d.data(), u.data(), parent_index.data(), matrix_sizes.data(),
@@ -287,7 +304,7 @@ struct matrix_state_interleaved {
 
         // Copy the solution from interleaved to front end storage.
         interleaved_to_flat
-            (rhs.data(), solution_.data(), matrix_sizes.data(), matrix_index.data(),
+            (rhs.data(), to.data(), matrix_sizes.data(), matrix_index.data(),
              padded_matrix_size(), num_matrices());
     }
 
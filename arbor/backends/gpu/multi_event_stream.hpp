@@ -63,18 +63,18 @@ protected:
     {}
 
     // The list of events must be sorted sorted first by index and then by time.
-    template <typename Event>
-    void init(const std::vector<Event>& staged) {
+    template <typename Event, typename EvSeq>
+    void init(const EvSeq& staged) {
         using ::arb::event_time;
         using ::arb::event_index;
 
-        if (staged.size()>std::numeric_limits<size_type>::max()) {
+        if (util::size(staged)>std::numeric_limits<size_type>::max()) {
             throw arbor_internal_error("gpu/multi_event_stream: too many events for size type");
         }
 
         arb_assert(util::is_sorted_by(staged, [](const Event& ev) { return event_index(ev); }));
 
-        std::size_t n_ev = staged.size();
+        std::size_t n_ev = util::size(staged);
         tmp_ev_time_.clear();
         tmp_ev_time_.reserve(n_ev);
 
@@ -132,13 +132,14 @@ public:
     explicit multi_event_stream(size_type n_stream):
         multi_event_stream_base(n_stream) {}
 
-    // Initialize event streams from a vector of events, sorted first by index
+    // Initialize event streams from a sequence of events, sorted first by index
     // and then by time.
-    void init(const std::vector<Event>& staged) {
-        multi_event_stream_base::init(staged);
+    template <typename EvSeq>
+    void init(const EvSeq& staged) {
+        multi_event_stream_base::init<Event>(staged);
 
         tmp_ev_data_.clear();
-        tmp_ev_data_.reserve(staged.size());
+        tmp_ev_data_.reserve(util::size(staged));
 
         using ::arb::event_data;
         util::assign_by(tmp_ev_data_, staged, [](const Event& ev) { return event_data(ev); });
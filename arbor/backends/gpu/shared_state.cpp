@@ -1,6 +1,8 @@
 #include <cstddef>
 #include <vector>
 
+#include <arbor/arbexcept.hpp>
+#include <arbor/assert.hpp>
 #include <arbor/constants.hpp>
 #include <arbor/fvm_types.hpp>
 
@@ -32,7 +34,13 @@ void set_dt_impl(
     const fvm_value_type* time_to, const fvm_value_type* time, const fvm_index_type* cv_to_intdom);
 
 void add_gj_current_impl(
-    fvm_size_type n_gj, const fvm_gap_junction* gj, const fvm_value_type* v, fvm_value_type* i);
+    fvm_size_type n_gj, const fvm_gap_junction* gj, const fvm_value_type* v, fvm_value_type* i, fvm_value_type* g);
+
+void add_gj_halo_current_impl(
+    fvm_size_type n, const fvm_index_type* cv, const fvm_value_type* weight, const fvm_value_type* voltage,
+    const fvm_value_type* peer_voltage, fvm_value_type* current_density, fvm_value_type* conductivity);
+
+void gather_impl(std::size_t n, fvm_value_type* x, const fvm_value_type* y, const fvm_index_type* index);
 
 void take_samples_impl(
     const multi_event_stream_state<raw_probe_info>& s,
@@ -40,6 +48,8 @@ void take_samples_impl(
 
 void add_scalar(std::size_t n, fvm_value_type* data, fvm_value_type v);
 
+void extrapolate_voltage_impl(std::size_t n, fvm_value_type* voltage, const fvm_value_type* voltage_half);
+
 // GPU-side minmax: consider CUDA kernel replacement.
 std::pair<fvm_value_type, fvm_value_type> minmax_value_impl(fvm_size_type n, const fvm_value_type* v) {
     auto v_copy = memory::on_host(memory::const_device_view<fvm_value_type>(v, n));
@@ -54,6 +64,8 @@ ion_state::ion_state(
     const std::vector<fvm_value_type>& init_iconc,
     const std::vector<fvm_value_type>& init_econc,
     const std::vector<fvm_value_type>& init_erev,
+    bool write_Xi,
+    bool write_Xo,
     unsigned // alignment/padding ignored.
 ):
     node_index_(make_const_view(cv)),
@@ -64,7 +76,9 @@ ion_state::ion_state(
     init_Xi_(make_const_view(init_iconc)),
     init_Xo_(make_const_view(init_econc)),
     init_eX_(make_const_view(init_erev)),
-    charge(1u, charge)
+    charge(1u, charge),
+    write_Xi_(write_Xi),
+    write_Xo_(write_Xo)
 {
     arb_assert(node_index_.size()==init_Xi_.size());
     arb_assert(node_index_.size()==init_Xo_.size());
@@ -72,8 +86,12 @@ ion_state::ion_state(
 }
 
 void ion_state::init_concentration() {
-    memory::copy(init_Xi_, Xi_);
-    memory::copy(init_Xo_, Xo_);
+    if (write_Xi_) {
+        memory::copy(init_Xi_, Xi_);
+    }
+    if (write_Xo_) {
+        memory::copy(init_Xo_, Xo_);
+    }
 }
 
 void ion_state::zero_current() {
@@ -82,7 +100,8 @@ void ion_state::zero_current() {
 
 void ion_state::reset() {
     zero_current();
-    init_concentration();
+    memory::copy(init_Xi_, Xi_);
+    memory::copy(init_Xo_, Xo_);
     memory::copy(init_eX_, eX_);
 }
 
@@ -123,11 +142,13 @@ void shared_state::add_ion(
     const std::vector<fvm_index_type>& cv,
     const std::vector<fvm_value_type>& init_iconc,
     const std::vector<fvm_value_type>& init_econc,
-    const std::vector<fvm_value_type>& init_erev)
+    const std::vector<fvm_value_type>& init_erev,
+    bool iconc_written,
+    bool econc_written)
 {
     ion_data.emplace(std::piecewise_construct,
         std::forward_as_tuple(ion_name),
-        std::forward_as_tuple(charge, cv, init_iconc, init_econc, init_erev, 1u));
+        std::forward_as_tuple(charge, cv, init_iconc, init_econc, init_erev, iconc_written, econc_written, 1u));
 }
 
 void shared_state::reset() {
@@ -136,6 +157,7 @@ void shared_state::reset() {
     memory::fill(conductivity, 0);
     memory::fill(time, 0);
     memory::fill(time_to, 0);
+    gather_impl(gj_halo_cv.size(), gj_halo_voltage.data(), init_voltage.data(), gj_halo_cv.data());
 
     for (auto& i: ion_data) {
         i.second.reset();
@@ -160,12 +182,70 @@ void shared_state::update_time_to(fvm_value_type dt_step, fvm_value_type tmax) {
     update_time_to_impl(n_intdom, time_to.data(), time.data(), dt_step, tmax);
 }
 
+void shared_state::configure_adaptive_dt(
+    fvm_value_type,
+    fvm_value_type,
+    const std::vector<fvm_index_type>&,
+    const std::vector<fvm_value_type>&)
+{
+    throw arbor_exception("gpu/shared_state: adaptive time steps are not supported on the gpu back-end");
+}
+
+void shared_state::update_time_to_adaptive(fvm_value_type, fvm_value_type) {
+    throw arbor_internal_error("gpu/shared_state: adaptive time steps are not supported on the gpu back-end");
+}
+
+void shared_state::update_dt_step(fvm_value_type) {
+    throw arbor_internal_error("gpu/shared_state: adaptive time steps are not supported on the gpu back-end");
+}
+
+void shared_state::configure_crank_nicolson() {
+    voltage_half = array(n_cv);
+    memory::copy(init_voltage, voltage_half);
+}
+
+void shared_state::extrapolate_voltage() {
+    extrapolate_voltage_impl(n_cv, voltage.data(), voltage_half.data());
+}
+
 void shared_state::set_dt() {
     set_dt_impl(n_intdom, n_cv, dt_intdom.data(), dt_cv.data(), time_to.data(), time.data(), cv_to_intdom.data());
 }
 
 void shared_state::add_gj_current() {
-    add_gj_current_impl(n_gj, gap_junctions.data(), voltage.data(), current_density.data());
+    add_gj_current_impl(n_gj, gap_junctions.data(), voltage.data(), current_density.data(), conductivity.data());
+    add_gj_halo_current_impl(gj_halo_cv.size(), gj_halo_cv.data(), gj_halo_weight.data(), voltage.data(),
+        gj_halo_voltage.data(), current_density.data(), conductivity.data());
+}
+
+void shared_state::configure_gj_halo(const std::vector<fvm_gap_junction>& halo_gj, const std::vector<fvm_index_type>& export_cv) {
+    std::vector<fvm_index_type> cv;
+    std::vector<fvm_value_type> weight;
+    for (const auto& gj: halo_gj) {
+        cv.push_back(gj.loc.first);
+        weight.push_back(gj.weight);
+    }
+
+    gj_halo_cv = iarray(make_const_view(cv));
+    gj_halo_weight = array(make_const_view(weight));
+    gj_halo_voltage = array(cv.size());
+    gather_impl(cv.size(), gj_halo_voltage.data(), init_voltage.data(), gj_halo_cv.data());
+
+    gj_export_cv = iarray(make_const_view(export_cv));
+    gj_export_voltage = array(export_cv.size());
+}
+
+void shared_state::export_gj_halo(std::vector<fvm_value_type>& values) const {
+    // Gather on the device, so that only the exported voltages are copied.
+    gather_impl(gj_export_voltage.size(), gj_export_voltage.data(), voltage.data(), gj_export_cv.data());
+
+    auto host_values = memory::on_host(gj_export_voltage);
+    values.insert(values.end(), host_values.begin(), host_values.end());
+}
+
+void shared_state::import_gj_halo(const std::vector<fvm_value_type>& values) {
+    arb_assert(values.size()==gj_halo_voltage.size());
+    memory::copy(make_const_view(values), gj_halo_voltage);
 }
 
 std::pair<fvm_value_type, fvm_value_type> shared_state::time_bounds() const {
@@ -176,6 +256,13 @@ std::pair<fvm_value_type, fvm_value_type> shared_state::voltage_bounds() const {
     return minmax_value_impl(n_cv, voltage.data());
 }
 
+std::vector<probe_handle> shared_state::configure_reductions(const std::vector<fvm_probe_reduction>& reductions) {
+    if (!reductions.empty()) {
+        throw arbor_exception("gpu/shared_state: reduction probes are not supported on the gpu back-end");
+    }
+    return {};
+}
+
 void shared_state::take_samples(const sample_event_stream::state& s, array& sample_time, array& sample_value) {
     take_samples_impl(s, time.data(), sample_time.data(), sample_value.data());
 }
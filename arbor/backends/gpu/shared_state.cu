@@ -23,13 +23,25 @@ __global__ void update_time_to_impl(unsigned n, T* time_to, const T* time, T dt,
 }
 
 template <typename T, typename I>
-__global__ void add_gj_current_impl(unsigned n, const T* gj_info, const I* voltage, I* current_density) {
+__global__ void add_gj_current_impl(unsigned n, const T* gj_info, const I* voltage, I* current_density, I* conductivity) {
     unsigned i = threadIdx.x+blockIdx.x*blockDim.x;
     if (i<n) {
         auto gj = gj_info[i];
         auto curr = gj.weight * (voltage[gj.loc.second] - voltage[gj.loc.first]); // nA
 
         cuda_atomic_sub(current_density + gj.loc.first, curr);
+        cuda_atomic_add(conductivity + gj.loc.first, gj.weight);
+    }
+}
+
+template <typename T, typename I>
+__global__ void add_gj_halo_current_impl(unsigned n, const I* cv, const T* weight, const T* voltage, const T* peer_voltage, T* current_density, T* conductivity) {
+    unsigned i = threadIdx.x+blockIdx.x*blockDim.x;
+    if (i<n) {
+        auto curr = weight[i] * (peer_voltage[i] - voltage[cv[i]]); // nA
+
+        cuda_atomic_sub(current_density + cv[i], curr);
+        cuda_atomic_add(conductivity + cv[i], weight[i]);
     }
 }
 
@@ -51,6 +63,15 @@ __global__ void vec_minus(unsigned n, T* x, const T* y, const T* z) {
     }
 }
 
+// Crank–Nicolson extrapolation: v[i] = 2*v_half[i] - v[i]
+template <typename T>
+__global__ void extrapolate_voltage(unsigned n, T* v, const T* v_half) {
+    unsigned i = threadIdx.x+blockIdx.x*blockDim.x;
+    if (i<n) {
+        v[i] = 2*v_half[i]-v[i];
+    }
+}
+
 // Vector gather: x[i] = y[index[i]]
 template <typename T, typename I>
 __global__ void gather(unsigned n, T* x, const T* y, const I* index) {
@@ -70,7 +91,9 @@ __global__ void take_samples_impl(
         auto end = s.ev_data+s.end_offset[i];
         for (auto p = begin; p!=end; ++p) {
             sample_time[p->offset] = time[i];
-            sample_value[p->offset] = *p->handle;
+            for (int j = 0; j<p->width; ++j) {
+                sample_value[p->value_offset+j] = p->handle[j];
+            }
         }
     }
 }
@@ -87,6 +110,14 @@ void add_scalar(std::size_t n, fvm_value_type* data, fvm_value_type v) {
     kernel::add_scalar<<<nblock, block_dim>>>(n, data, v);
 }
 
+void extrapolate_voltage_impl(std::size_t n, fvm_value_type* voltage, const fvm_value_type* voltage_half) {
+    if (!n) return;
+
+    constexpr int block_dim = 128;
+    const int nblock = block_count(n, block_dim);
+    kernel::extrapolate_voltage<<<nblock, block_dim>>>(n, voltage, voltage_half);
+}
+
 void update_time_to_impl(
     std::size_t n, fvm_value_type* time_to, const fvm_value_type* time,
     fvm_value_type dt, fvm_value_type tmax)
@@ -113,13 +144,32 @@ void set_dt_impl(
 }
 
 void add_gj_current_impl(
-    fvm_size_type n_gj, const fvm_gap_junction* gj_info, const fvm_value_type* voltage, fvm_value_type* current_density)
+    fvm_size_type n_gj, const fvm_gap_junction* gj_info, const fvm_value_type* voltage, fvm_value_type* current_density, fvm_value_type* conductivity)
 {
     if (!n_gj) return;
 
     constexpr int block_dim = 128;
     int nblock = block_count(n_gj, block_dim);
-    kernel::add_gj_current_impl<<<nblock, block_dim>>>(n_gj, gj_info, voltage, current_density);
+    kernel::add_gj_current_impl<<<nblock, block_dim>>>(n_gj, gj_info, voltage, current_density, conductivity);
+}
+
+void add_gj_halo_current_impl(
+    fvm_size_type n, const fvm_index_type* cv, const fvm_value_type* weight, const fvm_value_type* voltage,
+    const fvm_value_type* peer_voltage, fvm_value_type* current_density, fvm_value_type* conductivity)
+{
+    if (!n) return;
+
+    constexpr int block_dim = 128;
+    int nblock = block_count(n, block_dim);
+    kernel::add_gj_halo_current_impl<<<nblock, block_dim>>>(n, cv, weight, voltage, peer_voltage, current_density, conductivity);
+}
+
+void gather_impl(std::size_t n, fvm_value_type* x, const fvm_value_type* y, const fvm_index_type* index) {
+    if (!n) return;
+
+    constexpr int block_dim = 128;
+    int nblock = block_count(n, block_dim);
+    kernel::gather<<<nblock, block_dim>>>(n, x, y, index);
 }
 
 void take_samples_impl(
@@ -7,6 +7,9 @@
 
 #include <arbor/fvm_types.hpp>
 
+#include "backends/event.hpp"
+#include "backends/probe_reduction.hpp"
+
 #include "backends/gpu/gpu_store_types.hpp"
 
 namespace arb {
@@ -37,6 +40,9 @@ struct ion_state {
 
     array charge;       // charge of ionic species (global, length 1)
 
+    bool write_Xi_ = true; // Is Xi_ written by any mechanism?
+    bool write_Xo_ = true; // Is Xo_ written by any mechanism?
+
     ion_state() = default;
 
     ion_state(
@@ -45,17 +51,21 @@ struct ion_state {
         const std::vector<fvm_value_type>& init_Xi,
         const std::vector<fvm_value_type>& init_Xo,
         const std::vector<fvm_value_type>& init_eX,
+        bool write_Xi,
+        bool write_Xo,
         unsigned align
     );
 
-    // Set ion concentrations to weighted proportion of default concentrations.
+    // Set ion concentrations that are written by mechanisms to weighted
+    // proportion of default concentrations; the others keep their initial
+    // values.
     void init_concentration();
 
     // Set ionic current density to zero.
     void zero_current();
 
-    // Zero currents, reset concentrations, and reset reversal potential from
-    // initial values.
+    // Zero currents, reset all concentrations, and reset reversal potential
+    // from initial values.
     void reset();
 };
 
@@ -78,6 +88,15 @@ struct shared_state {
     array temperature_degC;  // Maps CV to local temperature (read only) [°C].
     array diam_um;           // Maps CV to local diameter (read only) [µm].
 
+    array voltage_half;      // Maps CV index to midpoint voltage of a Crank–Nicolson step [mV].
+
+    // Gap junctions with peers in other cell groups, set by configure_gj_halo().
+    iarray gj_halo_cv;       // Maps halo GJ index to local CV.
+    array gj_halo_weight;    // Maps halo GJ index to conductance per area of the local CV [kS/m²].
+    array gj_halo_voltage;   // Maps halo GJ index to peer voltage, set by import_gj_halo() [mV].
+    iarray gj_export_cv;     // CVs of the GJ sites whose voltage is exported to other cell groups.
+    mutable array gj_export_voltage; // Voltage of the exported GJ sites, gathered for the copy to host [mV].
+
     std::unordered_map<std::string, ion_state> ion_data;
 
     deliverable_event_stream deliverable_events;
@@ -100,7 +119,9 @@ struct shared_state {
         const std::vector<fvm_index_type>& cv,
         const std::vector<fvm_value_type>& init_iconc,
         const std::vector<fvm_value_type>& init_econc,
-        const std::vector<fvm_value_type>& init_erev);
+        const std::vector<fvm_value_type>& init_erev,
+        bool iconc_written,
+        bool econc_written);
 
     void zero_currents();
 
@@ -109,12 +130,41 @@ struct shared_state {
     // Set time_to to earliest of time+dt_step and tmax.
     void update_time_to(fvm_value_type dt_step, fvm_value_type tmax);
 
+    // Adaptive time steps are not supported on the gpu back-end:
+    // configure_adaptive_dt() throws, and the step updates are never called.
+    void configure_adaptive_dt(
+        fvm_value_type tolerance,
+        fvm_value_type dt_max,
+        const std::vector<fvm_index_type>& breakpoint_divs,
+        const std::vector<fvm_value_type>& breakpoints);
+    void update_time_to_adaptive(fvm_value_type dt_min, fvm_value_type tmax);
+    void update_dt_step(fvm_value_type dt_min);
+
+    // Allocate the midpoint voltage of the Crank–Nicolson scheme.
+    void configure_crank_nicolson();
+
+    // Complete a Crank–Nicolson step: voltage = 2*voltage_half - voltage.
+    void extrapolate_voltage();
+
     // Set the per-intdom and per-compartment dt from time_to - time.
     void set_dt();
 
-    // Update gap_junction state
+    // Add the current of each gap junction to its local CV, and its
+    // conductance to the CV's conductivity.
     void add_gj_current();
 
+    // Set up gap junctions with peers in other cell groups, given with the
+    // index of the peer voltage in place of the peer CV, and the CVs of the
+    // gap junction sites whose voltage other cell groups import.
+    void configure_gj_halo(const std::vector<fvm_gap_junction>& halo_gj, const std::vector<fvm_index_type>& export_cv);
+
+    // Append the voltage of each exported gap junction site to values.
+    void export_gj_halo(std::vector<fvm_value_type>& values) const;
+
+    // Set the peer voltage of each halo gap junction. Until the first
+    // import after reset, the peer voltage is that of the local CV.
+    void import_gj_halo(const std::vector<fvm_value_type>& values);
+
     // Return minimum and maximum time value [ms] across cells.
     std::pair<fvm_value_type, fvm_value_type> time_bounds() const;
 
@@ -122,6 +172,10 @@ struct shared_state {
     // (Used for solution bounds checking.)
     std::pair<fvm_value_type, fvm_value_type> voltage_bounds() const;
 
+    // Reduction probes are not supported on the gpu back-end: throws
+    // if any reductions are requested.
+    std::vector<probe_handle> configure_reductions(const std::vector<fvm_probe_reduction>& reductions);
+
     // Take samples according to marked events in a sample_event_stream.
     void take_samples(
         const sample_event_stream::state& s,
@@ -73,12 +73,13 @@ void test_thresholds_impl(
 
 __global__
 extern void reset_crossed_impl(
-    int size, fvm_index_type* is_crossed,
+    int size, fvm_index_type* is_crossed, fvm_value_type* prev_values,
     const fvm_index_type* cv_index, const fvm_value_type* values, const fvm_value_type* thresholds)
 {
     int i = threadIdx.x + blockIdx.x*blockDim.x;
     if (i<size) {
-        is_crossed[i] = values[cv_index[i]] >= thresholds[i];
+        prev_values[i] = values[cv_index[i]];
+        is_crossed[i] = prev_values[i] >= thresholds[i];
     }
 }
 
@@ -100,13 +101,13 @@ void test_thresholds_impl(
 }
 
 void reset_crossed_impl(
-    int size, fvm_index_type* is_crossed,
+    int size, fvm_index_type* is_crossed, fvm_value_type* prev_values,
     const fvm_index_type* cv_index, const fvm_value_type* values, const fvm_value_type* thresholds)
 {
     if (size>0) {
         constexpr int block_dim = 128;
         const int grid_dim = impl::block_count(size, block_dim);
-        kernel::reset_crossed_impl<<<grid_dim, block_dim>>>(size, is_crossed, cv_index, values, thresholds);
+        kernel::reset_crossed_impl<<<grid_dim, block_dim>>>(size, is_crossed, prev_values, cv_index, values, thresholds);
     }
 }
 
@@ -29,7 +29,7 @@ void test_thresholds_impl(
 
 void reset_crossed_impl(
     int size,
-    fvm_index_type* is_crossed,
+    fvm_index_type* is_crossed, fvm_value_type* prev_values,
     const fvm_index_type* cv_index, const fvm_value_type* values, const fvm_value_type* thresholds);
 
 
@@ -59,7 +59,7 @@ public:
         cv_index_(memory::make_const_view(cv_index)),
         is_crossed_(cv_index.size()),
         thresholds_(memory::make_const_view(thresholds)),
-        v_prev_(memory::const_host_view<fvm_value_type>(values, cv_index.size())),
+        v_prev_(cv_index.size()),
         // TODO: allocates enough space for 10 spikes per watch.
         // A more robust approach might be needed to avoid overflows.
         stack_(10*size(), ctx.gpu)
@@ -80,7 +80,7 @@ public:
     void reset() {
         clear_crossings();
         if (size()>0) {
-            reset_crossed_impl((int)size(), is_crossed_.data(), cv_index_.data(), values_, thresholds_.data());
+            reset_crossed_impl((int)size(), is_crossed_.data(), v_prev_.data(), cv_index_.data(), values_, thresholds_.data());
         }
     }
 
@@ -4,7 +4,7 @@
 #include <vector>
 
 #include "backends/event.hpp"
-#include "backends/multicore/matrix_state.hpp"
+#include "backends/multicore/matrix_state_dispatch.hpp"
 #include "backends/multicore/multi_event_stream.hpp"
 #include "backends/multicore/multicore_common.hpp"
 #include "backends/multicore/shared_state.hpp"
@@ -36,7 +36,7 @@ struct backend {
         return util::range_pointer_view(v);
     }
 
-    using matrix_state = arb::multicore::matrix_state<value_type, index_type>;
+    using matrix_state = arb::multicore::matrix_state_dispatch<value_type, index_type>;
     using threshold_watcher = arb::multicore::threshold_watcher;
 
     using deliverable_event_stream = arb::multicore::deliverable_event_stream;
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+
+#include <arbor/simd/simd.hpp>
+
 #include <util/partition.hpp>
 #include <util/span.hpp>
 
@@ -18,6 +22,13 @@ public:
     using const_view = const array&;
 
     using iarray = padded_vector<index_type>;
+
+    static constexpr unsigned simd_width = simd::simd_abi::native_width<value_type>::value;
+
+    using simd_value = simd::simd<value_type, simd_width>;
+    using simd_index = simd::simd<index_type, simd_width>;
+    using simd_mask = typename simd_value::simd_mask;
+
     iarray parent_index;
     iarray cell_cv_divs;
 
@@ -30,6 +41,7 @@ public:
     array cv_area;             // [μm^2]
 
     iarray cell_to_intdom;
+    iarray cv_to_intdom;
 
     // the invariant part of the matrix diagonal
     array invariant_d;         // [μS]
@@ -63,6 +75,16 @@ public:
             invariant_d[i] += gij;
             invariant_d[p[i]] += gij;
         }
+
+        cv_to_intdom = iarray(n);
+        for (auto c: util::make_span(cell_to_intdom.size())) {
+            for (auto i: util::make_span(cell_cv_divs[c], cell_cv_divs[c+1])) {
+                cv_to_intdom[i] = cell_to_intdom[c];
+            }
+        }
+
+        index_type n_intdom = cell_to_intdom.empty()? 0: 1+*std::max_element(cell_to_intdom.begin(), cell_to_intdom.end());
+        oodt_intdom_ = array(n_intdom);
     }
 
     const_view solution() const {
@@ -79,35 +101,63 @@ public:
     //   current density [A.m^-2]  (per control volume)
     //   conductivity    [kS.m^-2] (per control volume)
     void assemble(const_view dt_intdom, const_view voltage, const_view current, const_view conductivity) {
-        auto cell_cv_part = util::partition_view(cell_cv_divs);
-        const index_type ncells = cell_cv_part.size();
+        constexpr index_type W = simd_width;
 
-        // loop over submatrices
-        for (auto m: util::make_span(0, ncells)) {
-            auto dt = dt_intdom[cell_to_intdom[m]];
+        // A zero factor marks an integration domain that is not advanced.
+        for (auto i: util::make_span(oodt_intdom_.size())) {
+            auto dt = dt_intdom[i];
+            oodt_intdom_[i] = dt>0? 1e-3/dt: 0; // [1/µs]
+        }
 
-            if (dt>0) {
-                value_type oodt_factor = 1e-3/dt; // [1/µs]
-                for (auto i: util::make_span(cell_cv_part[m])) {
-                    auto area_factor = 1e-3*cv_area[i]; // [1e-9·m²]
+        const index_type n = size();
+        const index_type n_simd = n-n%W;
 
-                    auto gi = oodt_factor*cv_capacitance[i] + area_factor*conductivity[i]; // [μS]
+        for (index_type i = 0; i<n_simd; i += W) {
+            simd_value oodt_factor(simd::indirect(oodt_intdom_.data(), simd_index(cv_to_intdom.data()+i)));
+            simd_mask frozen = oodt_factor==simd_value(value_type(0));
 
-                    d[i] = gi + invariant_d[i];
-                    // convert current to units nA
-                    rhs[i] = gi*voltage[i] - area_factor*current[i];
-                }
+            simd_value v(voltage.data()+i);
+            simd_value area_factor = simd_value(1e-3)*simd_value(cv_area.data()+i); // [1e-9·m²]
+            simd_value gi = oodt_factor*simd_value(cv_capacitance.data()+i) + area_factor*simd_value(conductivity.data()+i); // [μS]
+
+            simd_value di = gi + simd_value(invariant_d.data()+i);
+            // convert current to units nA
+            simd_value ri = gi*v - area_factor*simd_value(current.data()+i);
+
+            simd::where(frozen, di) = value_type(0);
+            simd::where(frozen, ri) = v;
+
+            di.copy_to(d.data()+i);
+            ri.copy_to(rhs.data()+i);
+        }
+
+        for (auto i: util::make_span(n_simd, n)) {
+            auto oodt_factor = oodt_intdom_[cv_to_intdom[i]];
+
+            if (oodt_factor>0) {
+                auto area_factor = 1e-3*cv_area[i]; // [1e-9·m²]
+
+                auto gi = oodt_factor*cv_capacitance[i] + area_factor*conductivity[i]; // [μS]
+
+                d[i] = gi + invariant_d[i];
+                // convert current to units nA
+                rhs[i] = gi*voltage[i] - area_factor*current[i];
             }
             else {
-                for (auto i: util::make_span(cell_cv_part[m])) {
-                    d[i] = 0;
-                    rhs[i] = voltage[i];
-                }
+                d[i] = 0;
+                rhs[i] = voltage[i];
             }
         }
     }
 
+    // Solve in place: the solution is left in rhs.
     void solve() {
+        solve(rhs);
+    }
+
+    // Solve, writing the solution to `to`, which may be rhs. The forward
+    // sweep writes to `to` directly.
+    void solve(array& to) {
         // loop over submatrices
         for (auto cv_span: util::partition_view(cell_cv_divs)) {
             auto first = cv_span.first;
@@ -120,18 +170,22 @@ public:
                     d[parent_index[i]]   -= factor * u[i];
                     rhs[parent_index[i]] -= factor * rhs[i];
                 }
-                rhs[first] /= d[first];
+                to[first] = rhs[first] / d[first];
 
                 // forward sweep
                 for(auto i=first+1; i<last; ++i) {
-                    rhs[i] -= u[i] * rhs[parent_index[i]];
-                    rhs[i] /= d[i];
+                    to[i] = (rhs[i] - u[i] * to[parent_index[i]]) / d[i];
                 }
             }
+            else if (&to!=&rhs) {
+                std::copy(rhs.begin()+first, rhs.begin()+last, to.begin()+first);
+            }
         }
     }
 
 private:
+    // Per integration domain: 1e-3/dt, or zero if dt is not positive.
+    array oodt_intdom_;
 
     std::size_t size() const {
         return parent_index.size();
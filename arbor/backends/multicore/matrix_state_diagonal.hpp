@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <arbor/assert.hpp>
+#include <arbor/simd/simd.hpp>
+
+#include "util/span.hpp"
+
+#include "multicore_common.hpp"
+
+namespace arb {
+namespace multicore {
+
+// Matrix state for the multicore back end for groups in which every cell
+// has a single CV.
+//
+// The matrix is then diagonal: CV i is cell i, and there are no parent
+// indices or face conductances. Assembly solves each row as it goes, in one
+// vectorized pass over the CVs, and the solve only copies the solution out.
+// When the integration domains are the cells themselves, as without gap
+// junctions, the dt of each CV is read without indirection.
+
+template <typename T, typename I>
+struct matrix_state_diagonal {
+public:
+    using value_type = T;
+    using index_type = I;
+
+    using array = padded_vector<value_type>;
+    using const_view = const array&;
+
+    using iarray = padded_vector<index_type>;
+
+    static constexpr unsigned simd_width = simd::simd_abi::native_width<value_type>::value;
+
+    using simd_value = simd::simd<value_type, simd_width>;
+    using simd_index = simd::simd<index_type, simd_width>;
+    using simd_mask = typename simd_value::simd_mask;
+
+    array rhs;   // solution after assembly [mV]
+
+    array cv_capacitance;      // [pF]
+    array cv_area;             // [μm^2]
+
+    iarray cv_to_intdom;
+    bool intdom_identity = true;   // CV i is in integration domain i.
+
+    matrix_state_diagonal() = default;
+
+    matrix_state_diagonal(const std::vector<index_type>& p,
+                 const std::vector<index_type>& cell_cv_divs,
+                 const std::vector<value_type>& cap,
+                 const std::vector<value_type>&,
+                 const std::vector<value_type>& area,
+                 const std::vector<index_type>& cell_to_intdom):
+        rhs(p.size(), 0),
+        cv_capacitance(cap.begin(), cap.end()),
+        cv_area(area.begin(), area.end()),
+        cv_to_intdom(cell_to_intdom.begin(), cell_to_intdom.end())
+    {
+        arb_assert(cap.size() == p.size());
+        arb_assert(cell_cv_divs.size() == p.size()+1);
+        arb_assert(cell_cv_divs.back() == (index_type)p.size());
+
+        for (auto i: util::make_span(cell_to_intdom.size())) {
+            intdom_identity &= cell_to_intdom[i]==index_type(i);
+        }
+    }
+
+    const_view solution() const {
+        return rhs;
+    }
+
+    // Assemble and solve the matrix given dt, voltage and current, leaving
+    // the solution in rhs.
+    //   dt_intdom       [ms]      (per integration domain)
+    //   voltage         [mV]      (per control volume)
+    //   current density [A.m^-2]  (per control volume)
+    //   conductivity    [kS.m^-2] (per control volume)
+    // Frozen CVs, with dt zero, keep their voltage.
+    void assemble(const_view dt_intdom, const_view voltage, const_view current, const_view conductivity) {
+        constexpr index_type W = simd_width;
+
+        const index_type n = size();
+        const index_type n_simd = n-n%W;
+
+        for (index_type i = 0; i<n_simd; i += W) {
+            simd_value dt = intdom_identity?
+                simd_value(dt_intdom.data()+i):
+                simd_value(simd::indirect(dt_intdom.data(), simd_index(cv_to_intdom.data()+i)));
+            simd_mask frozen = dt<=simd_value(value_type(0));
+            simd::where(frozen, dt) = value_type(1);
+
+            simd_value v(voltage.data()+i);
+            simd_value area_factor = simd_value(1e-3)*simd_value(cv_area.data()+i); // [1e-9·m²]
+            simd_value gi = simd_value(1e-3)/dt*simd_value(cv_capacitance.data()+i) + area_factor*simd_value(conductivity.data()+i); // [μS]
+
+            // x = (gi·v - area_factor·i)/gi, with the current in nA
+            simd_value xi = v - area_factor*simd_value(current.data()+i)/gi;
+
+            simd::where(frozen, xi) = v;
+            xi.copy_to(rhs.data()+i);
+        }
+
+        for (auto i: util::make_span(n_simd, n)) {
+            auto dt = dt_intdom[cv_to_intdom[i]];
+
+            if (dt>0) {
+                auto area_factor = 1e-3*cv_area[i]; // [1e-9·m²]
+                auto gi = 1e-3/dt*cv_capacitance[i] + area_factor*conductivity[i]; // [μS]
+
+                // x = (gi·v - area_factor·i)/gi, with the current in nA
+                rhs[i] = voltage[i] - area_factor*current[i]/gi;
+            }
+            else {
+                rhs[i] = voltage[i];
+            }
+        }
+    }
+
+    // The solution is already in rhs.
+    void solve() {}
+
+    // Copy the solution to `to`.
+    void solve(array& to) {
+        if (&to!=&rhs) {
+            std::copy(rhs.begin(), rhs.end(), to.begin());
+        }
+    }
+
+private:
+    std::size_t size() const {
+        return rhs.size();
+    }
+};
+
+} // namespace multicore
+} // namespace arb
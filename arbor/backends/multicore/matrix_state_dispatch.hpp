@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "execution_context.hpp"
+#include "util/partition.hpp"
+
+#include "matrix_state.hpp"
+#include "matrix_state_diagonal.hpp"
+#include "matrix_state_fine.hpp"
+#include "matrix_state_interleaved.hpp"
+#include "multicore_common.hpp"
+
+namespace arb {
+namespace multicore {
+
+enum class matrix_solver {
+    flat,           // scalar solve, one cell at a time
+    interleaved,    // SIMD solve over blocks of interleaved cells
+    fine,           // threaded solve over the branches of each level
+    diagonal        // SIMD update of groups of single-CV cells
+};
+
+// Matrix state for the multicore back end that picks a solver for the cells
+// of a group: the diagonal solver when every cell has a single CV, the
+// branch-parallel solver when the group holds a cell large
+// enough to be worth splitting over threads, the SIMD-interleaved solver
+// when the cells of the group fill its blocks well, and the scalar solver
+// otherwise.
+
+template <typename T, typename I>
+struct matrix_state_dispatch {
+public:
+    using value_type = T;
+    using index_type = I;
+
+    using flat_state = matrix_state<value_type, index_type>;
+    using interleaved_state = matrix_state_interleaved<value_type, index_type>;
+    using fine_state = matrix_state_fine<value_type, index_type>;
+    using diagonal_state = matrix_state_diagonal<value_type, index_type>;
+
+    using array = padded_vector<value_type>;
+    using const_view = const array&;
+
+    // Interleave only if there are enough cells to fill one block, at least
+    // min_occupancy of the interleaved storage holds CVs, and the cells are
+    // small enough on average that the sweeps are not limited by memory
+    // bandwidth (see the matrix_solve micro benchmark).
+    static constexpr double min_occupancy = 0.75;
+    static constexpr std::size_t max_mean_cell_size = 256;
+
+    // Use the branch-parallel solver if there is more than one thread and
+    // the largest cell has at least this many CVs.
+    static constexpr std::size_t min_fine_cell_size = 8192;
+
+    static matrix_solver select_solver(const std::vector<index_type>& cell_cv_divs, unsigned n_thread) {
+        constexpr unsigned width = interleaved_state::block_width;
+
+        std::size_t n_cell = cell_cv_divs.size()-1;
+        std::size_t n_cv = cell_cv_divs.back();
+
+        std::size_t max_cell_size = 0;
+        for (auto cv_span: util::partition_view(cell_cv_divs)) {
+            max_cell_size = std::max<std::size_t>(max_cell_size, cv_span.second-cv_span.first);
+        }
+
+        if (n_cv==n_cell) {
+            return matrix_solver::diagonal;
+        }
+        if (n_thread>1 && max_cell_size>=min_fine_cell_size) {
+            return matrix_solver::fine;
+        }
+        if (width>1 && n_cell>=width && n_cv<=max_mean_cell_size*n_cell &&
+            n_cv>=min_occupancy*interleaved_storage_size(cell_cv_divs, width))
+        {
+            return matrix_solver::interleaved;
+        }
+        return matrix_solver::flat;
+    }
+
+    matrix_state_dispatch() = default;
+
+    // Without an execution context there are no threads for the
+    // branch-parallel solver.
+    matrix_state_dispatch(const std::vector<index_type>& p,
+                 const std::vector<index_type>& cell_cv_divs,
+                 const std::vector<value_type>& cap,
+                 const std::vector<value_type>& cond,
+                 const std::vector<value_type>& area,
+                 const std::vector<index_type>& cell_to_intdom):
+        solver_(select_solver(cell_cv_divs, 1))
+    {
+        if (solver_==matrix_solver::interleaved) {
+            interleaved = interleaved_state(p, cell_cv_divs, cap, cond, area, cell_to_intdom);
+        }
+        else if (solver_==matrix_solver::diagonal) {
+            diagonal = diagonal_state(p, cell_cv_divs, cap, cond, area, cell_to_intdom);
+        }
+        else {
+            flat = flat_state(p, cell_cv_divs, cap, cond, area, cell_to_intdom);
+        }
+    }
+
+    matrix_state_dispatch(const std::vector<index_type>& p,
+                 const std::vector<index_type>& cell_cv_divs,
+                 const std::vector<value_type>& cap,
+                 const std::vector<value_type>& cond,
+                 const std::vector<value_type>& area,
+                 const std::vector<index_type>& cell_to_intdom,
+                 const execution_context& context):
+        solver_(select_solver(cell_cv_divs, context.thread_pool->get_num_threads()))
+    {
+        switch (solver_) {
+        case matrix_solver::flat:
+            flat = flat_state(p, cell_cv_divs, cap, cond, area, cell_to_intdom);
+            break;
+        case matrix_solver::interleaved:
+            interleaved = interleaved_state(p, cell_cv_divs, cap, cond, area, cell_to_intdom);
+            break;
+        case matrix_solver::fine:
+            fine = fine_state(p, cell_cv_divs, cap, cond, area, cell_to_intdom, context);
+            break;
+        case matrix_solver::diagonal:
+            diagonal = diagonal_state(p, cell_cv_divs, cap, cond, area, cell_to_intdom);
+            break;
+        }
+    }
+
+    matrix_solver solver() const {
+        return solver_;
+    }
+
+    const_view solution() const {
+        switch (solver_) {
+        case matrix_solver::interleaved:
+            return interleaved.solution();
+        case matrix_solver::fine:
+            return fine.solution();
+        case matrix_solver::diagonal:
+            return diagonal.solution();
+        default:
+            return flat.solution();
+        }
+    }
+
+    void assemble(const_view dt_intdom, const_view voltage, const_view current, const_view conductivity) {
+        switch (solver_) {
+        case matrix_solver::flat:
+            flat.assemble(dt_intdom, voltage, current, conductivity);
+            break;
+        case matrix_solver::interleaved:
+            interleaved.assemble(dt_intdom, voltage, current, conductivity);
+            break;
+        case matrix_solver::fine:
+            fine.assemble(dt_intdom, voltage, current, conductivity);
+            break;
+        case matrix_solver::diagonal:
+            diagonal.assemble(dt_intdom, voltage, current, conductivity);
+            break;
+        }
+    }
+
+    void solve() {
+        switch (solver_) {
+        case matrix_solver::flat:
+            flat.solve();
+            break;
+        case matrix_solver::interleaved:
+            interleaved.solve();
+            break;
+        case matrix_solver::fine:
+            fine.solve();
+            break;
+        case matrix_solver::diagonal:
+            diagonal.solve();
+            break;
+        }
+    }
+
+    void solve(array& to) {
+        switch (solver_) {
+        case matrix_solver::flat:
+            flat.solve(to);
+            break;
+        case matrix_solver::interleaved:
+            interleaved.solve(to);
+            break;
+        case matrix_solver::fine:
+            fine.solve(to);
+            break;
+        case matrix_solver::diagonal:
+            diagonal.solve(to);
+            break;
+        }
+    }
+
+private:
+    matrix_solver solver_ = matrix_solver::flat;
+
+public:
+    // Only the state of the selected solver is initialized.
+    flat_state flat;
+    interleaved_state interleaved;
+    fine_state fine;
+    diagonal_state diagonal;
+};
+
+} // namespace multicore
+} // namespace arb
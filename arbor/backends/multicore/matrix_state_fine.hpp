@@ -0,0 +1,340 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <arbor/assert.hpp>
+
+#include "backends/gpu/forest.hpp"
+#include "execution_context.hpp"
+#include "threading/threading.hpp"
+#include "tree.hpp"
+#include "util/rangeutil.hpp"
+#include "util/span.hpp"
+
+#include "multicore_common.hpp"
+
+namespace arb {
+namespace multicore {
+
+// Hines matrix state for the multicore back end that solves large cells in
+// parallel over their branches.
+//
+// The CVs of each cell are renumbered with the branch decomposition of
+// gpu::forest, so that every branch is a contiguous run of CVs in which each
+// CV is the parent of the next. Branches are grouped into levels by their
+// depth in the branch tree of their cell. The backward sweep visits the
+// levels from the leaves to the root, and the forward sweep from the root to
+// the leaves; the branches of a level are divided into tasks that run on the
+// thread pool.
+
+template <typename T, typename I>
+struct matrix_state_fine {
+public:
+    using value_type = T;
+    using index_type = I;
+
+    using array = padded_vector<value_type>;
+    using const_view = const array&;
+
+    using iarray = padded_vector<index_type>;
+
+    // Tasks are made of whole branches, with at least this many CVs per task
+    // where possible.
+    static constexpr index_type min_task_size = 512;
+
+    // Number of CVs assembled or copied per task.
+    static constexpr index_type chunk_size = 4096;
+
+    struct branch {
+        index_type first;   // first CV of the branch, in solver order
+        index_type last;    // one past the last CV of the branch
+        index_type parent;  // parent CV of the first CV, or -1 for a root branch
+        index_type cell;    // cell of the branch
+    };
+
+    // Branches in order of level, with the partition of branches into tasks
+    // and the partition of tasks into levels.
+    std::vector<branch> branches;
+    std::vector<index_type> task_divs;
+    std::vector<index_type> level_divs;
+
+    // Solver CV i is CV perm[i] in the external (flat) order. The root of
+    // each cell keeps its index.
+    iarray perm;
+    iarray cell_cv_divs;
+    iarray cv_to_intdom;       // in solver order
+
+    array d;     // [μS]
+    array u;     // [μS]
+    array rhs;   // [nA]
+
+    array cv_capacitance;      // [pF]
+    array cv_area;             // [μm^2]
+
+    // the invariant part of the matrix diagonal
+    array invariant_d;         // [μS]
+
+    // Solution in external order, updated by solve() without a target.
+    array solution_;
+
+    task_system_handle thread_pool;
+
+    matrix_state_fine() = default;
+
+    matrix_state_fine(const std::vector<index_type>& p,
+                 const std::vector<index_type>& cell_cv_divs,
+                 const std::vector<value_type>& cap,
+                 const std::vector<value_type>& cond,
+                 const std::vector<value_type>& area,
+                 const std::vector<index_type>& cell_to_intdom,
+                 const execution_context& context):
+        cell_cv_divs(cell_cv_divs.begin(), cell_cv_divs.end()),
+        thread_pool(context.thread_pool)
+    {
+        using util::make_span;
+
+        arb_assert(cap.size() == p.size());
+        arb_assert(cond.size() == p.size());
+        arb_assert(cell_cv_divs.back() == (index_type)p.size());
+
+        const auto n_cv = p.size();
+        const auto n_cell = cell_cv_divs.size()-1;
+
+        gpu::forest trees(
+            std::vector<gpu::size_type>(p.begin(), p.end()),
+            std::vector<gpu::size_type>(cell_cv_divs.begin(), cell_cv_divs.end()));
+
+        perm = iarray(trees.permutation().begin(), trees.permutation().end());
+
+        // Parent of each CV in solver order, -1 at the roots.
+        std::vector<index_type> solver_p(n_cv, -1);
+
+        std::vector<std::vector<branch>> levels;
+        cv_to_intdom = iarray(n_cv);
+        for (auto c: make_span(n_cell)) {
+            const index_type first = cell_cv_divs[c];
+            arb_assert(perm[first] == first);
+
+            const tree& fine_tree = trees.compartment_tree(c);
+            const auto& starts = trees.branch_offsets(c);
+            const auto& lengths = trees.branch_lengths(c);
+            auto depths = depth_from_root(trees.branch_tree(c));
+
+            for (auto i: make_span(fine_tree.num_segments())) {
+                auto parent = fine_tree.parent(i);
+                if (parent!=tree::no_parent) {
+                    solver_p[first+i] = first+parent;
+                    arb_assert(perm[first+parent] == p[perm[first+i]]);
+                }
+                cv_to_intdom[first+i] = cell_to_intdom[c];
+            }
+
+            for (auto b: make_span(depths.size())) {
+                if (depths[b]>=levels.size()) {
+                    levels.resize(depths[b]+1);
+                }
+                index_type start = first+starts[b];
+                levels[depths[b]].push_back({start, start+index_type(lengths[b]), solver_p[start], index_type(c)});
+            }
+        }
+
+        // Within a level, take the longest branches first, and group
+        // branches into tasks in that order.
+        const index_type n_thread = thread_pool? thread_pool->get_num_threads(): 1;
+
+        task_divs.push_back(0);
+        level_divs.push_back(0);
+        for (auto& level: levels) {
+            util::stable_sort_by(level, [](const branch& b) { return b.first-b.last; });
+
+            index_type level_size = 0;
+            for (auto& b: level) level_size += b.last-b.first;
+            index_type task_size = level_size/(2*n_thread);
+            if (task_size<min_task_size) task_size = min_task_size;
+
+            index_type size = 0;
+            for (auto& b: level) {
+                branches.push_back(b);
+                size += b.last-b.first;
+                if (size>=task_size) {
+                    task_divs.push_back(branches.size());
+                    size = 0;
+                }
+            }
+            if (size) {
+                task_divs.push_back(branches.size());
+            }
+            level_divs.push_back(task_divs.size()-1);
+        }
+
+        // Matrix coefficients in solver order.
+        u = array(n_cv, 0);
+        invariant_d = array(n_cv, 0);
+        cv_capacitance = array(n_cv);
+        cv_area = array(n_cv);
+        for (auto i: make_span(n_cv)) {
+            auto j = perm[i];
+            cv_capacitance[i] = cap[j];
+            cv_area[i] = area[j];
+
+            if (solver_p[i]>=0) {
+                auto gij = cond[j];
+
+                u[i] = -gij;
+                invariant_d[i] += gij;
+                invariant_d[solver_p[i]] += gij;
+            }
+        }
+
+        d = array(n_cv, 0);
+        rhs = array(n_cv, 0);
+        solution_ = array(n_cv, 0);
+
+        parent_d_ = array(branches.size(), 0);
+        parent_rhs_ = array(branches.size(), 0);
+        cell_active_ = std::vector<char>(n_cell, 0);
+    }
+
+    const_view solution() const {
+        return solution_;
+    }
+
+    unsigned num_levels() const {
+        return level_divs.size()-1;
+    }
+
+    // Assemble the matrix
+    // Afterwards the diagonal and RHS will have been set given dt, voltage and current.
+    //   dt_intdom       [ms]      (per integration domain)
+    //   voltage         [mV]      (per control volume)
+    //   current density [A.m^-2]  (per control volume)
+    //   conductivity    [kS.m^-2] (per control volume)
+    void assemble(const_view dt_intdom, const_view voltage, const_view current, const_view conductivity) {
+        for_each_chunk([&](index_type begin, index_type end) {
+            for (auto i: util::make_span(begin, end)) {
+                auto j = perm[i];
+                auto dt = dt_intdom[cv_to_intdom[i]];
+
+                if (dt>0) {
+                    value_type oodt_factor = 1e-3/dt; // [1/µs]
+                    auto area_factor = 1e-3*cv_area[i]; // [1e-9·m²]
+
+                    auto gi = oodt_factor*cv_capacitance[i] + area_factor*conductivity[j]; // [μS]
+
+                    d[i] = gi + invariant_d[i];
+                    // convert current to units nA
+                    rhs[i] = gi*voltage[j] - area_factor*current[j];
+                }
+                else {
+                    d[i] = 0;
+                    rhs[i] = voltage[j];
+                }
+            }
+        });
+    }
+
+    void solve() {
+        solve(solution_);
+    }
+
+    // Solve, writing the solution in external order to `to`.
+    void solve(array& to) {
+        // Cells with a zero diagonal are left as-is.
+        for (auto c: util::make_span(cell_active_.size())) {
+            cell_active_[c] = d[cell_cv_divs[c]]!=0;
+        }
+
+        // backward sweep
+        for (auto l = num_levels(); l-->0; ) {
+            for_each_branch(l, [&](index_type k) {
+                const auto& b = branches[k];
+                if (!cell_active_[b.cell]) return;
+
+                for (auto i = b.last-1; i>b.first; --i) {
+                    auto factor = u[i] / d[i];
+                    d[i-1]   -= factor * u[i];
+                    rhs[i-1] -= factor * rhs[i];
+                }
+
+                // Sibling branches share a parent CV: defer the update.
+                if (b.parent>=0) {
+                    auto factor = u[b.first] / d[b.first];
+                    parent_d_[k]   = factor * u[b.first];
+                    parent_rhs_[k] = factor * rhs[b.first];
+                }
+            });
+
+            for (auto k: util::make_span(task_divs[level_divs[l]], task_divs[level_divs[l+1]])) {
+                const auto& b = branches[k];
+                if (b.parent>=0 && cell_active_[b.cell]) {
+                    d[b.parent]   -= parent_d_[k];
+                    rhs[b.parent] -= parent_rhs_[k];
+                }
+            }
+        }
+
+        // forward sweep
+        for (auto l: util::make_span(num_levels())) {
+            for_each_branch(l, [&](index_type k) {
+                const auto& b = branches[k];
+                if (!cell_active_[b.cell]) return;
+
+                if (b.parent>=0) {
+                    rhs[b.first] -= u[b.first] * rhs[b.parent];
+                }
+                rhs[b.first] /= d[b.first];
+
+                for (auto i = b.first+1; i<b.last; ++i) {
+                    rhs[i] -= u[i] * rhs[i-1];
+                    rhs[i] /= d[i];
+                }
+            });
+        }
+
+        // Copy the solution to external order.
+        for_each_chunk([&](index_type begin, index_type end) {
+            for (auto i: util::make_span(begin, end)) {
+                to[perm[i]] = rhs[i];
+            }
+        });
+    }
+
+private:
+    // Contributions of the first CV of each branch to its parent CV,
+    // accumulated after each level of the backward sweep.
+    array parent_d_;
+    array parent_rhs_;
+
+    std::vector<char> cell_active_;
+
+    template <typename F>
+    void for_each_branch(unsigned level, F f) {
+        auto run_task = [&](index_type t) {
+            for (auto k: util::make_span(task_divs[t], task_divs[t+1])) {
+                f(k);
+            }
+        };
+
+        index_type t_begin = level_divs[level];
+        index_type t_end = level_divs[level+1];
+        if (t_end-t_begin==1) {
+            run_task(t_begin);
+        }
+        else {
+            threading::parallel_for::apply(t_begin, t_end, thread_pool.get(), run_task);
+        }
+    }
+
+    template <typename F>
+    void for_each_chunk(F f) {
+        index_type n = perm.size();
+        index_type n_chunk = (n+chunk_size-1)/chunk_size;
+
+        threading::parallel_for::apply(0, n_chunk, thread_pool.get(),
+            [&](index_type c) { f(c*chunk_size, std::min(n, (c+1)*chunk_size)); });
+    }
+};
+
+} // namespace multicore
+} // namespace arb
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <arbor/assert.hpp>
+#include <arbor/simd/simd.hpp>
+
+#include "util/partition.hpp"
+#include "util/rangeutil.hpp"
+#include "util/span.hpp"
+
+#include "multicore_common.hpp"
+
+namespace arb {
+namespace multicore {
+
+// Number of CV slots in block-interleaved storage for the cells described
+// by cell_cv_divs, when cells are sorted by size and grouped into blocks
+// of `width` cells.
+template <typename I>
+std::size_t interleaved_storage_size(const std::vector<I>& cell_cv_divs, unsigned width) {
+    std::vector<I> sizes;
+    for (auto cv_span: util::partition_view(cell_cv_divs)) {
+        sizes.push_back(cv_span.second-cv_span.first);
+    }
+    util::sort(sizes, [](I a, I b) { return a>b; });
+
+    std::size_t n = 0;
+    for (std::size_t i = 0; i<sizes.size(); i += width) {
+        n += width*sizes[i];
+    }
+    return n;
+}
+
+// Hines matrix state for the multicore back end in which cells are solved
+// in lockstep, `Width` cells at a time, with the arb::simd types.
+//
+// Cells are sorted by descending size and grouped into blocks of Width
+// cells. The CVs of a block are stored interleaved: slot base+i*Width+lane
+// holds CV i of the cell in that lane, where base is the start of the block.
+// Each block is padded to the size of its largest cell; padding slots hold
+// an identity row that decouples them from the rest of the matrix.
+
+template <typename T, typename I, unsigned Width = simd::simd_abi::native_width<T>::value>
+struct matrix_state_interleaved {
+public:
+    using value_type = T;
+    using index_type = I;
+
+    using array = padded_vector<value_type>;
+    using const_view = const array&;
+
+    using iarray = padded_vector<index_type>;
+
+    static constexpr unsigned block_width = Width;
+
+    using simd_value = simd::simd<value_type, Width>;
+    using simd_index = simd::simd<index_type, Width>;
+    using simd_mask = typename simd_value::simd_mask;
+
+    // Partition of interleaved storage by block.
+    iarray block_divs;
+
+    // Per interleaved slot: the CV index in flat storage (the first CV of
+    // the cell or 0 for padding) and the slot of the parent CV.
+    iarray cv_index;
+    iarray parent_index;
+
+    // Per block lane: the cell size (zero for empty lanes) and the
+    // integration domain of the cell.
+    array lane_size;
+    iarray lane_intdom;
+
+    array d;     // [μS]
+    array u;     // [μS]
+    array rhs;   // [nA]
+
+    array cv_capacitance;      // [pF]
+    array cv_area;             // [μm^2]
+
+    // the invariant part of the matrix diagonal
+    array invariant_d;         // [μS]
+
+    // Solution in flat CV order, updated by solve() without a target.
+    array solution_;
+
+    matrix_state_interleaved() = default;
+
+    matrix_state_interleaved(const std::vector<index_type>& p,
+                 const std::vector<index_type>& cell_cv_divs,
+                 const std::vector<value_type>& cap,
+                 const std::vector<value_type>& cond,
+                 const std::vector<value_type>& area,
+                 const std::vector<index_type>& cell_to_intdom)
+    {
+        arb_assert(cap.size() == p.size());
+        arb_assert(cond.size() == p.size());
+        arb_assert(cell_cv_divs.back() == (index_type)p.size());
+
+        using util::make_span;
+        constexpr unsigned W = Width;
+
+        // Sort cells by descending size.
+        std::vector<index_type> sizes;
+        for (auto cv_span: util::partition_view(cell_cv_divs)) {
+            sizes.push_back(cv_span.second-cv_span.first);
+        }
+        const unsigned n_cell = sizes.size();
+        const unsigned n_block = (n_cell+W-1)/W;
+
+        std::vector<index_type> perm(n_cell);
+        std::iota(perm.begin(), perm.end(), 0);
+        util::stable_sort_by(perm, [&sizes](index_type i) { return -sizes[i]; });
+
+        block_divs = iarray(n_block+1, 0);
+        for (auto b: make_span(n_block)) {
+            block_divs[b+1] = block_divs[b] + W*sizes[perm[b*W]];
+        }
+        const std::size_t n_slot = block_divs.back();
+
+        // Invariant part of the diagonal and upper diagonal in flat order.
+        std::vector<value_type> flat_u(p.size(), 0), flat_invariant_d(p.size(), 0);
+        for (auto i: make_span(1u, p.size())) {
+            auto gij = cond[i];
+
+            flat_u[i] = -gij;
+            flat_invariant_d[i] += gij;
+            flat_invariant_d[p[i]] += gij;
+        }
+
+        cv_index = iarray(n_slot, 0);
+        parent_index = iarray(n_slot);
+        lane_size = array(n_block*W, 0);
+        lane_intdom = iarray(n_block*W, 0);
+
+        u = array(n_slot, 0);
+        invariant_d = array(n_slot, 1);
+        cv_capacitance = array(n_slot, 0);
+        cv_area = array(n_slot, 0);
+
+        for (auto b: make_span(n_block)) {
+            index_type base = block_divs[b];
+            index_type n_row = (block_divs[b+1]-base)/W;
+
+            for (auto lane: make_span(W)) {
+                // Padding rows are rooted at the first row of their lane.
+                for (auto i: make_span(n_row)) {
+                    parent_index[base+i*W+lane] = base+lane;
+                }
+
+                auto c = b*W+lane;
+                if (c>=n_cell) continue;
+
+                auto cell = perm[c];
+                auto first = cell_cv_divs[cell];
+                auto size = sizes[cell];
+
+                lane_size[c] = size;
+                lane_intdom[c] = cell_to_intdom[cell];
+
+                for (auto i: make_span(n_row)) {
+                    auto k = base+i*W+lane;
+                    if (i>=size) {
+                        cv_index[k] = first;
+                        continue;
+                    }
+
+                    auto cv = first+i;
+                    cv_index[k] = cv;
+                    parent_index[k] = base+(p[cv]-first)*W+lane;
+                    u[k] = flat_u[cv];
+                    invariant_d[k] = flat_invariant_d[cv];
+                    cv_capacitance[k] = cap[cv];
+                    cv_area[k] = area[cv];
+                }
+            }
+        }
+
+        d = array(n_slot, 0);
+        rhs = array(n_slot, 0);
+        solution_ = array(p.size(), 0);
+    }
+
+    const_view solution() const {
+        return solution_;
+    }
+
+    // Assemble the matrix
+    // Afterwards the diagonal and RHS will have been set given dt, voltage and current.
+    //   dt_intdom       [ms]      (per integration domain)
+    //   voltage         [mV]      (per control volume)
+    //   current density [A.m^-2]  (per control volume)
+    //   conductivity    [kS.m^-2] (per control volume)
+    void assemble(const_view dt_intdom, const_view voltage, const_view current, const_view conductivity) {
+        constexpr index_type W = Width;
+
+        for (auto b: util::make_span(num_blocks())) {
+            simd_index intdom(lane_intdom.data()+b*W);
+            simd_value dt(simd::indirect(dt_intdom.data(), intdom));
+            simd_mask frozen = dt<=simd_value(value_type(0));
+
+            simd::where(frozen, dt) = value_type(1);
+            simd_value oodt_factor = simd_value(1e-3)/dt; // [1/µs]
+
+            for (auto k = block_divs[b]; k<block_divs[b+1]; k += W) {
+                simd_index cv(cv_index.data()+k);
+                simd_value v(simd::indirect(voltage.data(), cv));
+                simd_value i(simd::indirect(current.data(), cv));
+                simd_value g(simd::indirect(conductivity.data(), cv));
+
+                simd_value area_factor = simd_value(1e-3)*simd_value(cv_area.data()+k); // [1e-9·m²]
+                simd_value gi = oodt_factor*simd_value(cv_capacitance.data()+k) + area_factor*g; // [μS]
+
+                simd_value dk = gi + simd_value(invariant_d.data()+k);
+                // convert current to units nA
+                simd_value rk = gi*v - area_factor*i;
+
+                simd::where(frozen, dk) = value_type(0);
+                simd::where(frozen, rk) = v;
+
+                dk.copy_to(d.data()+k);
+                rk.copy_to(rhs.data()+k);
+            }
+        }
+    }
+
+    void solve() {
+        solve(solution_);
+    }
+
+    // Solve, writing the solution in flat CV order to `to`.
+    void solve(array& to) {
+        constexpr index_type W = Width;
+
+        for (auto b: util::make_span(num_blocks())) {
+            const index_type first = block_divs[b];
+            const index_type last = block_divs[b+1];
+
+            // Lanes with a zero diagonal are left as-is.
+            simd_mask active = simd_value(d.data()+first)!=simd_value(value_type(0));
+
+            // backward sweep
+            for (auto k = last-W; k>first; k -= W) {
+                simd_index p(parent_index.data()+k);
+                simd_value uk(u.data()+k);
+                simd_value factor = uk/simd_value(d.data()+k);
+
+                simd_value dp(simd::indirect(d.data(), p));
+                simd_value rp(simd::indirect(rhs.data(), p));
+
+                simd::where(active, dp) = dp - factor*uk;
+                simd::where(active, rp) = rp - factor*simd_value(rhs.data()+k);
+
+                dp.copy_to(simd::indirect(d.data(), p));
+                rp.copy_to(simd::indirect(rhs.data(), p));
+            }
+
+            simd_value r0(rhs.data()+first);
+            simd::where(active, r0) = r0/simd_value(d.data()+first);
+            r0.copy_to(rhs.data()+first);
+
+            // forward sweep
+            for (auto k = first+W; k<last; k += W) {
+                simd_index p(parent_index.data()+k);
+                simd_value rp(simd::indirect(rhs.data(), p));
+                simd_value rk(rhs.data()+k);
+
+                simd::where(active, rk) = (rk - simd_value(u.data()+k)*rp)/simd_value(d.data()+k);
+                rk.copy_to(rhs.data()+k);
+            }
+
+            // Copy the solution to flat order, skipping padding.
+            simd_value size(lane_size.data()+b*W);
+            for (auto k = first; k<last; k += W) {
+                simd_mask in_cell = simd_value(value_type((k-first)/W))<size;
+                simd_index cv(cv_index.data()+k);
+                simd_value rk(rhs.data()+k);
+
+                simd::where(in_cell, rk).copy_to(simd::indirect(to.data(), cv));
+            }
+        }
+    }
+
+private:
+    unsigned num_blocks() const {
+        return block_divs.empty()? 0: block_divs.size()-1;
+    }
+};
+
+} // namespace multicore
+} // namespace arb
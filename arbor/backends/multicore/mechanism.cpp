@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,9 +13,12 @@
 #include <arbor/util/optional.hpp>
 
 #include "util/index_into.hpp"
+#include "util/indirect.hpp"
 #include "util/maputil.hpp"
 #include "util/padded_alloc.hpp"
 #include "util/range.hpp"
+#include "util/rangeutil.hpp"
+#include "util/span.hpp"
 
 #include "backends/multicore/mechanism.hpp"
 #include "backends/multicore/multicore_common.hpp"
@@ -27,8 +31,6 @@ namespace multicore {
 using util::make_range;
 using util::value_by_key;
 
-constexpr unsigned simd_width = S::simd_abi::native_width<fvm_value_type>::value;
-
 
 // Copy elements from source sequence into destination sequence,
 // and fill the remaining elements of the destination sequence
@@ -50,6 +52,33 @@ void copy_extend(const Source& source, Dest&& dest, const Fill& fill) {
     std::fill(tail, end(dest), fill);
 }
 
+// Set the first width elements of a field of padded width from values given
+// in layout order, where instance_index maps layout order to storage order
+// (or is empty, if they are the same), and fill the tail with the last value.
+
+template <typename V>
+void assign_field(util::range<V*> field, const std::vector<fvm_value_type>& values, const std::vector<fvm_index_type>& instance_index) {
+    if (instance_index.empty()) {
+        copy_extend(values, field, values.back());
+    }
+    else {
+        auto width = values.size();
+        for (auto i: util::count_along(values)) {
+            field[instance_index[i]] = values[i];
+        }
+        std::fill(field.begin()+width, field.end(), field[width-1]);
+    }
+}
+
+static mechanism_index_constraints count_constraints(const constraint_partition& part) {
+    mechanism_index_constraints n;
+    n.contiguous = part.contiguous.size();
+    n.constant = part.constant.size();
+    n.independent = part.independent.size();
+    n.none = part.none.size();
+    return n;
+}
+
 // The derived class (typically generated code from modcc) holds pointers that need
 // to be set to point inside the shared state, or into the allocated parameter/variable
 // data block.
@@ -126,22 +155,55 @@ void mechanism::instantiate(unsigned id, backend::shared_state& shared, const me
 
     // Allocate and initialize state and parameter vectors with default values.
 
+    // Range parameters start out uniform, with their default value: they are
+    // given an array only if set_parameter() sets differing values.
+
     auto fields = field_table();
+    auto uniform = uniform_table();
     std::size_t n_field = fields.size();
+    std::size_t n_uniform = uniform.size();
+
+    uniform_data_ = array(n_uniform, NAN, pad);
+    parameter_data_.assign(n_uniform, array());
 
     // (First sub-array of data_ is used for width_, below.)
-    data_ = array((1+n_field)*width_padded_, NAN, pad);
-    for (std::size_t i = 0; i<n_field; ++i) {
+    data_ = array((1+n_field-n_uniform)*width_padded_, NAN, pad);
+    for (std::size_t i = 0, j = 1; i<n_field; ++i) {
         // Take reference to corresponding derived (generated) mechanism value pointer member.
         fvm_value_type*& field_ptr = *(fields[i].second);
-        field_ptr = data_.data()+(i+1)*width_padded_;
-
-        if (auto opt_value = value_by_key(field_default_table(), fields[i].first)) {
-            std::fill(field_ptr, field_ptr+width_padded_, *opt_value);
+        auto opt_value = value_by_key(field_default_table(), fields[i].first);
+
+        auto u = std::find_if(uniform.begin(), uniform.end(), [&](const uniform_entry& e) { return !std::strcmp(e.first, fields[i].first); });
+        if (u!=uniform.end()) {
+            field_ptr = uniform_data_.data()+(u-uniform.begin());
+            *u->second = true;
+            if (opt_value) {
+                *field_ptr = *opt_value;
+            }
+        }
+        else {
+            field_ptr = data_.data()+(j++)*width_padded_;
+            if (opt_value) {
+                std::fill(field_ptr, field_ptr+width_padded_, *opt_value);
+            }
         }
     }
     weight_ = data_.data();
 
+    // Fields stored in single precision are laid out likewise in single_data_.
+
+    auto single_fields = single_field_table();
+    single_data_ = single_array(single_fields.size()*width_padded_, NAN, pad);
+    for (auto i: util::count_along(single_fields)) {
+        // Take reference to corresponding derived (generated) mechanism single pointer member.
+        single_type*& field_ptr = *(single_fields[i].second);
+        field_ptr = single_data_.data()+i*width_padded_;
+
+        if (auto opt_value = value_by_key(field_default_table(), single_fields[i].first)) {
+            std::fill(field_ptr, field_ptr+width_padded_, single_type(*opt_value));
+        }
+    }
+
     // Allocate and copy local state: weight, node indices, ion indices.
     // The tail comprises those elements between width_ and width_padded_:
     //
@@ -150,14 +212,56 @@ void mechanism::instantiate(unsigned id, backend::shared_state& shared, const me
     // * For indices in the padded tail of ion index maps, set index to last valid ion index.
 
     node_index_ = iarray(width_padded_, pad);
+    unsigned simd_width = this->simd_width();
 
     copy_extend(pos_data.cv, node_index_, pos_data.cv.back());
-    copy_extend(pos_data.weight, make_range(data_.data(), data_.data()+width_padded_), 0);
     index_constraints_ = make_constraint_partition(node_index_, width_, simd_width);
+    layout_constraints_ = count_constraints(index_constraints_);
+
+    // Point mechanism instances can be stored in any order, as target handles
+    // refer to the stored index. If the layout order leaves SIMD blocks with
+    // repeated CV indices, store the instances in an order with fewer such
+    // blocks, and record where each instance of the layout is stored.
+
+    std::vector<fvm_index_type> order;
+    instance_index_.clear();
+    if (kind()==mechanismKind::point && !index_constraints_.none.empty()) {
+        order = make_independent_order(pos_data.cv, simd_width);
+
+        auto cv = util::indirect_view(pos_data.cv, order);
+        copy_extend(cv, node_index_, util::back(cv));
+        auto part = make_constraint_partition(node_index_, width_, simd_width);
+
+        if (part.none.size()<index_constraints_.none.size()) {
+            index_constraints_ = std::move(part);
+            instance_index_.resize(width_);
+            for (auto j: util::count_along(order)) {
+                instance_index_[order[j]] = j;
+            }
+        }
+        else {
+            copy_extend(pos_data.cv, node_index_, pos_data.cv.back());
+            order.clear();
+        }
+    }
+    set_instance_range(0, width_);
+
+    auto weight_range = make_range(data_.data(), data_.data()+width_padded_);
+    if (order.empty()) {
+        copy_extend(pos_data.weight, weight_range, 0);
+    }
+    else {
+        copy_extend(util::indirect_view(pos_data.weight, order), weight_range, 0);
+    }
 
     if (mult_in_place_) {
         multiplicity_ = iarray(width_padded_, pad);
-        copy_extend(pos_data.multiplicity, multiplicity_, 1);
+        if (order.empty()) {
+            copy_extend(pos_data.multiplicity, multiplicity_, 1);
+        }
+        else {
+            copy_extend(util::indirect_view(pos_data.multiplicity, order), multiplicity_, 1);
+        }
     }
 
     for (auto i: ion_index_table()) {
@@ -187,10 +291,42 @@ void mechanism::set_parameter(const std::string& key, const std::vector<fvm_valu
 
         if (width_>0) {
             // Retrieve corresponding derived (generated) mechanism value pointer member.
-            value_type* field_ptr = *opt_ptr.value();
-            util::range<value_type*> field(field_ptr, field_ptr+width_padded_);
+            value_type*& field_ptr = *opt_ptr.value();
+
+            // A range parameter with the same value for every instance is
+            // stored as that value; otherwise it needs its own array.
+            auto uniform = uniform_table();
+            auto u = std::find_if(uniform.begin(), uniform.end(), [&](const uniform_entry& e) { return key==e.first; });
+            if (u!=uniform.end()) {
+                auto k = u-uniform.begin();
+                bool& is_uniform = *u->second;
+
+                if (util::all_of(values, [&](value_type v) { return v==values.front(); })) {
+                    uniform_data_[k] = values.front();
+                    field_ptr = uniform_data_.data()+k;
+                    parameter_data_[k] = array();
+                    is_uniform = true;
+                    return;
+                }
+
+                if (is_uniform) {
+                    parameter_data_[k] = array(width_padded_, NAN, data_.get_allocator());
+                    field_ptr = parameter_data_[k].data();
+                    is_uniform = false;
+                }
+            }
+
+            assign_field(make_range(field_ptr, field_ptr+width_padded_), values, instance_index_);
+        }
+    }
+    else if (auto opt_single_ptr = value_by_key(single_field_table(), key)) {
+        if (values.size()!=width_) {
+            throw arbor_internal_error("multicore/mechanism: mechanism parameter size mismatch");
+        }
 
-            copy_extend(values, field, values.back());
+        if (width_>0) {
+            single_type* field_ptr = *opt_single_ptr.value();
+            assign_field(make_range(field_ptr, field_ptr+width_padded_), values, instance_index_);
         }
     }
     else {
@@ -198,10 +334,33 @@ void mechanism::set_parameter(const std::string& key, const std::vector<fvm_valu
     }
 }
 
+mechanism_index_constraints mechanism::index_constraints() const {
+    return count_constraints(index_constraints_);
+}
+
+void mechanism::set_instance_range(fvm_size_type begin, fvm_size_type end) {
+    begin_ = begin;
+    end_ = end;
+
+    // Each list in index_constraints_ holds the first instances of its SIMD
+    // blocks in increasing order.
+
+    auto bounds = [begin, end](const iarray& blocks, std::size_t& first, std::size_t& last) {
+        first = std::lower_bound(blocks.begin(), blocks.end(), fvm_index_type(begin))-blocks.begin();
+        last = std::lower_bound(blocks.begin(), blocks.end(), fvm_index_type(end))-blocks.begin();
+    };
+
+    bounds(index_constraints_.contiguous, constraints_begin_.contiguous, constraints_end_.contiguous);
+    bounds(index_constraints_.constant, constraints_begin_.constant, constraints_end_.constant);
+    bounds(index_constraints_.independent, constraints_begin_.independent, constraints_end_.independent);
+    bounds(index_constraints_.none, constraints_begin_.none, constraints_end_.none);
+}
+
 void mechanism::initialize() {
     nrn_init();
 
     auto states = state_table();
+    auto single_states = single_state_table();
 
     if (mult_in_place_) {
         for (auto& state: states) {
@@ -209,6 +368,11 @@ void mechanism::initialize() {
                 (*state.second)[j] *= multiplicity_[j];
             }
         }
+        for (auto& state: single_states) {
+            for (std::size_t j = 0; j < width_; ++j) {
+                (*state.second)[j] *= multiplicity_[j];
+            }
+        }
     }
 }
 
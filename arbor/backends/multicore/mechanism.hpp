@@ -27,12 +27,17 @@ public:
     using index_type = fvm_index_type;
     using size_type = fvm_size_type;
 
+    // Storage type for state variables of mechanisms generated with
+    // single precision state: values are computed in value_type.
+    using single_type = float;
+
 protected:
     using backend = arb::multicore::backend;
     using deliverable_event_stream = backend::deliverable_event_stream;
 
     using array  = arb::multicore::array;
     using iarray = arb::multicore::iarray;
+    using single_array = arb::multicore::padded_vector<single_type>;
 
     struct ion_state_view {
         value_type* current_density;
@@ -50,11 +55,25 @@ public:
     std::size_t memory() const override {
         std::size_t s = object_sizeof();
 
-        s += sizeof(value_type) * data_.size();
+        s += sizeof(value_type) * (data_.size() + uniform_data_.size());
+        for (const auto& a: parameter_data_) {
+            s += sizeof(value_type) * a.size();
+        }
+        s += sizeof(single_type) * single_data_.size();
         s += sizeof(size_type) * width_padded_ * (n_ion_ + 1); // node and ion indices.
         return s;
     }
 
+    mechanism_index_constraints layout_index_constraints() const override {
+        return layout_constraints_;
+    }
+
+    mechanism_index_constraints index_constraints() const override;
+
+    std::vector<fvm_index_type> instance_index() const override {
+        return instance_index_;
+    }
+
     void instantiate(fvm_size_type id, backend::shared_state& shared, const mechanism_overrides&, const mechanism_layout&) override;
     void initialize() override;
 
@@ -65,6 +84,12 @@ public:
 
     void set_parameter(const std::string& key, const std::vector<fvm_value_type>& values) override;
 
+    fvm_size_type instance_block() const override {
+        return simd_width();
+    }
+
+    void set_instance_range(fvm_size_type begin, fvm_size_type end) override;
+
 protected:
     size_type width_ = 0;        // Instance width (number of CVs/sites)
     size_type width_padded_ = 0; // Width rounded up to multiple of pad/alignment.
@@ -89,16 +114,40 @@ protected:
     iarray multiplicity_;
     bool mult_in_place_;
     constraint_partition index_constraints_;
+    mechanism_index_constraints layout_constraints_;
+    std::vector<fvm_index_type> instance_index_; // Empty if instances are in layout order.
+
+    // Instances [begin_, end_) processed by the generated kernels, and the
+    // corresponding positions in each list of index_constraints_.
+    size_type begin_ = 0;
+    size_type end_ = 0;
+    mechanism_index_constraints constraints_begin_;
+    mechanism_index_constraints constraints_end_;
     const value_type* weight_;    // Points within data_ after instantiation.
 
     // Bulk storage for state and parameter variables.
 
     array data_;
 
+    // Range parameters with the same value for every instance are stored as
+    // that value in uniform_data_; others in their own array in parameter_data_.
+    // Both are indexed by position in uniform_table().
+
+    array uniform_data_;
+    std::vector<array> parameter_data_;
+
+    // Fields stored in single precision, in the order of single_field_table().
+
+    single_array single_data_;
+
     // Generated mechanism field, global and ion table lookup types.
     // First component is name, second is pointer to corresponing member in 
     // the mechanism's parameter pack, or for field_default_table,
-    // the scalar value used to initialize the field.
+    // the scalar value used to initialize the field. The uniform_table
+    // lists the range parameters, with a flag that is set if the field
+    // holds a single value for all instances. The single field and state
+    // tables list fields stored as single_type, which are not listed in the
+    // field and state tables.
 
     using global_table_entry = std::pair<const char*, value_type*>;
     using mechanism_global_table = std::vector<global_table_entry>;
@@ -109,6 +158,15 @@ protected:
     using field_table_entry = std::pair<const char*, value_type**>;
     using mechanism_field_table = std::vector<field_table_entry>;
 
+    using single_field_table_entry = std::pair<const char*, single_type**>;
+    using mechanism_single_field_table = std::vector<single_field_table_entry>;
+
+    using single_state_table_entry = std::pair<const char*, single_type**>;
+    using mechanism_single_state_table = std::vector<single_state_table_entry>;
+
+    using uniform_entry = std::pair<const char*, bool*>;
+    using mechanism_uniform_table = std::vector<uniform_entry>;
+
     using field_default_entry = std::pair<const char*, value_type>;
     using mechanism_field_default_table = std::vector<field_default_entry>;
 
@@ -129,8 +187,11 @@ protected:
 
     virtual mechanism_field_table field_table() { return {}; }
     virtual mechanism_field_default_table field_default_table() { return {}; }
+    virtual mechanism_uniform_table uniform_table() { return {}; }
     virtual mechanism_global_table global_table() { return {}; }
     virtual mechanism_state_table state_table() { return {}; }
+    virtual mechanism_single_field_table single_field_table() { return {}; }
+    virtual mechanism_single_state_table single_state_table() { return {}; }
     virtual mechanism_ion_state_table ion_state_table() { return {}; }
     virtual mechanism_ion_index_table ion_index_table() { return {}; }
 
@@ -138,6 +199,11 @@ protected:
 
     virtual std::size_t object_sizeof() const = 0;
 
+    // Number of instances processed together by the generated kernels, for
+    // which index constraints are determined.
+
+    virtual unsigned simd_width() const { return 1; }
+
     // Event delivery, given event queue state:
 
     virtual void deliver_events(deliverable_event_stream::state) {};
@@ -52,20 +52,22 @@ public:
         util::fill(mark_, 0);
     }
 
-    // Initialize event streams from a vector of events, sorted by time.
-    void init(std::vector<Event> staged) {
+    // Initialize event streams from a sequence of events, sorted first by
+    // index and then by time. Storage is reused across calls.
+    template <typename EvSeq>
+    void init(const EvSeq& staged) {
         using ::arb::event_time;
         using ::arb::event_index;
         using ::arb::event_data;
 
-        if (staged.size()>std::numeric_limits<size_type>::max()) {
+        if (util::size(staged)>std::numeric_limits<size_type>::max()) {
             throw arbor_internal_error("multicore/multi_event_stream: too many events for size type");
         }
 
         // Staged events should already be sorted by index.
         arb_assert(util::is_sorted_by(staged, [](const Event& ev) { return event_index(ev); }));
 
-        std::size_t n_ev = staged.size();
+        std::size_t n_ev = util::size(staged);
         util::assign_by(ev_data_, staged, [](const Event& ev) { return event_data(ev); });
         util::assign_by(ev_time_, staged, [](const Event& ev) { return event_time(ev); });
 
@@ -99,6 +101,10 @@ public:
 
         arb_assert(n_streams()==util::size(t_until));
 
+        // With no events left every stream is empty, with its mark at its
+        // start: skip the pass over the streams.
+        if (empty()) return;
+
         // note: operation on each `i` is independent.
         for (size_type i = 0; i<n_streams(); ++i) {
             auto end = span_end_[i];
@@ -120,6 +126,8 @@ public:
 
         arb_assert(n_streams()==util::size(t_until));
 
+        if (empty()) return;
+
         // note: operation on each `i` is independent.
         for (size_type i = 0; i<n_streams(); ++i) {
             auto end = span_end_[i];
@@ -135,6 +143,8 @@ public:
 
     // Remove marked events from front of each event stream.
     void drop_marked_events() {
+        if (empty()) return;
+
         // note: operation on each `i` is independent.
         for (size_type i = 0; i<n_streams(); ++i) {
             remaining_ -= (mark_[i]-span_begin_[i]);
@@ -153,6 +163,8 @@ public:
     void event_time_if_before(TimeSeq& t_until) {
         using ::arb::event_time;
 
+        if (empty()) return;
+
         // note: operation on each `i` is independent.
         for (size_type i = 0; i<n_streams(); ++i) {
             if (span_begin_[i]==span_end_[i]) {
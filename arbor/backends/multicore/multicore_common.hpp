@@ -23,7 +23,6 @@ using padded_vector = std::vector<V, util::padded_allocator<V>>;
 
 using array  = padded_vector<fvm_value_type>;
 using iarray = padded_vector<fvm_index_type>;
-using gjarray = padded_vector<fvm_gap_junction>;
 
 using deliverable_event_stream = arb::multicore::multi_event_stream<deliverable_event>;
 using sample_event_stream = arb::multicore::multi_event_stream<sample_event>;
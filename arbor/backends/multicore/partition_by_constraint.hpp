@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 
+#include <arbor/fvm_types.hpp>
 #include <arbor/simd/simd.hpp>
 
 namespace arb {
@@ -93,6 +96,86 @@ constraint_partition make_constraint_partition(const T& node_index, unsigned wid
     return part;
 }
 
+// Order the entries of node_index so that as few SIMD blocks as possible
+// have repeated indices without being constant, for point mechanisms whose
+// instances can be stored in any order. Returns the order: entry order[j]
+// is stored at j.
+//
+// Each index with at least simd_width entries first fills as many constant
+// blocks as it can. The remaining blocks are formed greedily from the
+// distinct indices with the most entries left, which maximizes the number
+// of blocks without repeated indices. Entries are sorted by index within
+// each block, and the entries left once fewer than simd_width distinct
+// indices remain are sorted by index, so that repeated indices are always
+// in adjacent lanes. Entries with the same index keep their relative order.
+
+template <typename T>
+std::vector<fvm_index_type> make_independent_order(const T& node_index, unsigned simd_width) {
+    std::vector<fvm_index_type> by_index(node_index.size());
+    std::iota(by_index.begin(), by_index.end(), 0);
+    std::stable_sort(by_index.begin(), by_index.end(),
+        [&](fvm_index_type a, fvm_index_type b) { return node_index[a]<node_index[b]; });
+
+    // Runs of equal index in by_index: next entry and number left in each.
+    std::vector<fvm_index_type> next, left;
+    for (unsigned i = 0; i<by_index.size(); ++i) {
+        if (!i || node_index[by_index[i]]!=node_index[by_index[i-1]]) {
+            next.push_back(i);
+            left.push_back(0);
+        }
+        ++left.back();
+    }
+
+    std::vector<fvm_index_type> order;
+    order.reserve(by_index.size());
+
+    if (simd_width>1) {
+        for (unsigned r = 0; r<next.size(); ++r) {
+            while (left[r]>=fvm_index_type(simd_width)) {
+                for (unsigned k = 0; k<simd_width; ++k) {
+                    order.push_back(by_index[next[r]++]);
+                }
+                left[r] -= simd_width;
+            }
+        }
+    }
+
+    // Max-heap of runs with entries left, by number left, then lowest index.
+    auto fewer = [&](unsigned a, unsigned b) { return left[a]<left[b] || (left[a]==left[b] && a>b); };
+    std::vector<unsigned> heap;
+    for (unsigned r = 0; r<next.size(); ++r) {
+        if (left[r]) heap.push_back(r);
+    }
+    std::make_heap(heap.begin(), heap.end(), fewer);
+
+    std::vector<unsigned> block;
+    while (simd_width>1 && heap.size()>=simd_width) {
+        block.clear();
+        for (unsigned k = 0; k<simd_width; ++k) {
+            std::pop_heap(heap.begin(), heap.end(), fewer);
+            block.push_back(heap.back());
+            heap.pop_back();
+        }
+
+        std::sort(block.begin(), block.end());
+        for (auto r: block) {
+            order.push_back(by_index[next[r]++]);
+            if (--left[r]) {
+                heap.push_back(r);
+                std::push_heap(heap.begin(), heap.end(), fewer);
+            }
+        }
+    }
+
+    std::sort(heap.begin(), heap.end());
+    for (auto r: heap) {
+        while (left[r]--) {
+            order.push_back(by_index[next[r]++]);
+        }
+    }
+    return order;
+}
+
 bool constexpr is_constraint_stronger(index_constraint a, index_constraint b) {
     return a==b ||
            a==index_constraint::none ||
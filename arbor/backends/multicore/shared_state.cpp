@@ -2,6 +2,7 @@
 #include <cfloat>
 #include <cmath>
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -18,6 +19,7 @@
 #include "io/sepval.hpp"
 #include "util/padded_alloc.hpp"
 #include "util/rangeutil.hpp"
+#include "util/span.hpp"
 
 #include "multi_event_stream.hpp"
 #include "multicore_common.hpp"
@@ -52,6 +54,8 @@ ion_state::ion_state(
     const std::vector<fvm_value_type>& init_Xi,
     const std::vector<fvm_value_type>& init_Xo,
     const std::vector<fvm_value_type>& init_eX,
+    bool write_Xi,
+    bool write_Xo,
     unsigned align
 ):
     alignment(min_alignment(align)),
@@ -63,7 +67,9 @@ ion_state::ion_state(
     init_Xi_(init_Xi.begin(), init_Xi.end(), pad(alignment)),
     init_Xo_(init_Xo.begin(), init_Xo.end(), pad(alignment)),
     init_eX_(init_eX.begin(), init_eX.end(), pad(alignment)),
-    charge(1u, charge, pad(alignment))
+    charge(1u, charge, pad(alignment)),
+    write_Xi_(write_Xi),
+    write_Xo_(write_Xo)
 {
     arb_assert(node_index_.size()==init_Xi_.size());
     arb_assert(node_index_.size()==init_Xo_.size());
@@ -72,8 +78,12 @@ ion_state::ion_state(
 }
 
 void ion_state::init_concentration() {
-    std::copy(init_Xi_.begin(), init_Xi_.end(), Xi_.begin());
-    std::copy(init_Xo_.begin(), init_Xo_.end(), Xo_.begin());
+    if (write_Xi_) {
+        std::copy(init_Xi_.begin(), init_Xi_.end(), Xi_.begin());
+    }
+    if (write_Xo_) {
+        std::copy(init_Xo_.begin(), init_Xo_.end(), Xo_.begin());
+    }
 }
 
 void ion_state::zero_current() {
@@ -82,7 +92,8 @@ void ion_state::zero_current() {
 
 void ion_state::reset() {
     zero_current();
-    init_concentration();
+    std::copy(init_Xi_.begin(), init_Xi_.end(), Xi_.begin());
+    std::copy(init_Xo_.begin(), init_Xo_.end(), Xo_.begin());
     std::copy(init_eX_.begin(), init_eX_.end(), eX_.begin());
 }
 
@@ -103,7 +114,6 @@ shared_state::shared_state(
     n_cv(cv_to_intdom_vec.size()),
     n_gj(gj_vec.size()),
     cv_to_intdom(math::round_up(n_cv, alignment), pad(alignment)),
-    gap_junctions(math::round_up(n_gj, alignment), pad(alignment)),
     time(n_intdom, pad(alignment)),
     time_to(n_intdom, pad(alignment)),
     dt_intdom(n_intdom, pad(alignment)),
@@ -122,13 +132,63 @@ shared_state::shared_state(
         std::fill(cv_to_intdom.begin() + n_cv, cv_to_intdom.end(), cv_to_intdom_vec.back());
     }
     if (n_gj>0) {
-        std::copy(gj_vec.begin(), gj_vec.end(), gap_junctions.begin());
-        std::fill(gap_junctions.begin()+n_gj, gap_junctions.end(), gj_vec.back());
+        std::vector<fvm_size_type> order(n_gj);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+            [&](auto a, auto b) { return gj_vec[a].loc.first<gj_vec[b].loc.first; });
+
+        // Partition the sorted junctions into rows.
+        std::vector<fvm_size_type> row_divs;
+        for (auto i: util::make_span(n_gj)) {
+            auto cv = gj_vec[order[i]].loc.first;
+            if (gj_cv.empty() || gj_cv.back()!=cv) {
+                row_divs.push_back(i);
+                gj_cv.push_back(cv);
+            }
+        }
+        row_divs.push_back(n_gj);
+
+        // Pad the rows to whole slices with copies of the last CV, which
+        // keeps gj_cv sorted within each slice.
+        auto n_row = gj_cv.size();
+        auto n_row_padded = math::round_up(n_row, simd_width);
+        gj_cv.resize(n_row_padded, gj_cv.back());
+        row_divs.resize(n_row_padded+1, n_gj);
+        gj_row_weight.assign(n_row_padded, 0);
+
+        gj_slice_divs.push_back(0);
+        for (fvm_size_type r0 = 0; r0<n_row_padded; r0 += simd_width) {
+            fvm_size_type len = 0;
+            for (auto r: util::make_span(r0, r0+simd_width)) {
+                len = std::max(len, row_divs[r+1]-row_divs[r]);
+            }
+
+            auto base = gj_slice_divs.back();
+            gj_peer.resize(base+len*simd_width, gj_cv[r0]);
+            gj_weight.resize(base+len*simd_width, 0);
+            for (auto r: util::make_span(r0, r0+simd_width)) {
+                for (auto i: util::make_span(row_divs[r], row_divs[r+1])) {
+                    const auto& gj = gj_vec[order[i]];
+                    auto k = base+(i-row_divs[r])*simd_width+(r-r0);
+                    gj_peer[k] = gj.loc.second;
+                    gj_weight[k] = gj.weight;
+                    gj_row_weight[r] += gj.weight;
+                }
+            }
+            gj_slice_divs.push_back(base+len*simd_width);
+        }
+
+        gj_constraints = make_constraint_partition(gj_cv, n_row_padded, simd_width);
     }
 
     for (unsigned i = 0; i<n_cv; ++i) {
         temperature_degC[i] = temperature_K[i] - 273.15;
     }
+
+    cv_intdom_identity = n_cv==n_intdom;
+    for (unsigned i = 0; i<n_cv && cv_intdom_identity; ++i) {
+        cv_intdom_identity = cv_to_intdom_vec[i]==fvm_index_type(i);
+    }
 }
 
 void shared_state::add_ion(
@@ -137,11 +197,13 @@ void shared_state::add_ion(
     const std::vector<fvm_index_type>& cv,
     const std::vector<fvm_value_type>& init_iconc,
     const std::vector<fvm_value_type>& init_econc,
-    const std::vector<fvm_value_type>& init_erev)
+    const std::vector<fvm_value_type>& init_erev,
+    bool iconc_written,
+    bool econc_written)
 {
     ion_data.emplace(std::piecewise_construct,
         std::forward_as_tuple(ion_name),
-        std::forward_as_tuple(charge, cv, init_iconc, init_econc, init_erev, alignment));
+        std::forward_as_tuple(charge, cv, init_iconc, init_econc, init_erev, iconc_written, econc_written, alignment));
 }
 
 void shared_state::reset() {
@@ -151,6 +213,18 @@ void shared_state::reset() {
     util::fill(time, 0);
     util::fill(time_to, 0);
 
+    if (adaptive_dt) {
+        util::fill(dt_step, 0);
+        util::fill(dt_last, 0);
+        std::copy(init_voltage.begin(), init_voltage.end(), voltage_last.begin());
+        util::fill(dv_last, 0);
+        std::copy(breakpoint_divs.begin(), breakpoint_divs.end()-1, breakpoint_next.begin());
+    }
+
+    for (auto i: util::count_along(gj_halo_cv)) {
+        gj_halo_voltage[i] = init_voltage[gj_halo_cv[i]];
+    }
+
     for (auto& i: ion_data) {
         i.second.reset();
     }
@@ -178,13 +252,141 @@ void shared_state::update_time_to(fvm_value_type dt_step, fvm_value_type tmax) {
     }
 }
 
+void shared_state::configure_adaptive_dt(
+    fvm_value_type tolerance,
+    fvm_value_type dt_max,
+    const std::vector<fvm_index_type>& bp_divs,
+    const std::vector<fvm_value_type>& bp)
+{
+    arb_assert(bp_divs.size()==n_intdom+1);
+
+    adaptive_dt = true;
+    dt_tolerance = tolerance;
+    dt_step_max = dt_max;
+
+    dt_step = array(n_intdom, 0, pad(alignment));
+    dt_last = array(n_intdom, 0, pad(alignment));
+    step_error = array(n_intdom, 0, pad(alignment));
+    voltage_last = array(init_voltage.begin(), init_voltage.end(), pad(alignment));
+    dv_last = array(n_cv, 0, pad(alignment));
+
+    breakpoint_divs = iarray(bp_divs.begin(), bp_divs.end(), pad(alignment));
+    breakpoint_next = iarray(bp_divs.begin(), bp_divs.end()-1, pad(alignment));
+    breakpoints = array(bp.begin(), bp.end(), pad(alignment));
+}
+
+void shared_state::update_time_to_adaptive(fvm_value_type dt_min, fvm_value_type tmax) {
+    auto marked = deliverable_events.marked_events();
+    for (fvm_size_type i = 0; i<n_intdom; ++i) {
+        if (marked.begin_offset[i]!=marked.end_offset[i]) {
+            dt_step[i] = dt_min;
+        }
+
+        auto t_until = tmax;
+        auto& next = breakpoint_next[i];
+        for (; next!=breakpoint_divs[i+1]; ++next) {
+            if (breakpoints[next]>time[i]) {
+                t_until = std::min(t_until, breakpoints[next]);
+                break;
+            }
+            dt_step[i] = dt_min;
+        }
+
+        auto dt = std::max(dt_min, std::min(dt_step[i], dt_step_max));
+        time_to[i] = std::min(time[i]+dt, t_until);
+    }
+}
+
+void shared_state::update_dt_step(fvm_value_type dt_min) {
+    // Steps grow or shrink by at most these factors.
+    constexpr fvm_value_type max_growth = 2;
+    constexpr fvm_value_type max_shrink = 0.2;
+
+    util::fill(step_error, 0);
+    for (fvm_size_type i = 0; i<n_cv; ++i) {
+        auto j = cv_to_intdom[i];
+        auto dt = dt_intdom[j];
+        if (dt<=0) continue;
+
+        auto dv = voltage[i]-voltage_last[i];
+        auto r = dt_last[j]>0? dt/dt_last[j]: 0;
+        step_error[j] = std::max(step_error[j], std::abs(dv-r*dv_last[i])/2);
+
+        voltage_last[i] = voltage[i];
+        dv_last[i] = dv;
+    }
+
+    // The error of a backward Euler step is of second order in dt. A step
+    // cut short by an event or sample with a small error keeps the planned
+    // step size for the next step.
+    for (fvm_size_type j = 0; j<n_intdom; ++j) {
+        auto dt = dt_intdom[j];
+        if (dt<=0) continue;
+
+        auto err = step_error[j];
+        auto f = err>0? fvm_value_type(0.9)*std::sqrt(dt_tolerance/err): max_growth;
+        auto next = dt*std::max(max_shrink, std::min(f, max_growth));
+        if (err<=dt_tolerance) {
+            next = std::max(next, dt_step[j]);
+        }
+
+        dt_step[j] = std::max(dt_min, std::min(next, dt_step_max));
+        dt_last[j] = dt;
+    }
+}
+
+void shared_state::configure_gj_halo(const std::vector<fvm_gap_junction>& halo_gj, const std::vector<fvm_index_type>& export_cv) {
+    gj_halo_cv = iarray(halo_gj.size(), pad(alignment));
+    gj_halo_weight = array(halo_gj.size(), pad(alignment));
+    gj_halo_voltage = array(halo_gj.size(), pad(alignment));
+    for (auto i: util::count_along(halo_gj)) {
+        gj_halo_cv[i] = halo_gj[i].loc.first;
+        gj_halo_weight[i] = halo_gj[i].weight;
+        gj_halo_voltage[i] = init_voltage[halo_gj[i].loc.first];
+    }
+    gj_export_cv = iarray(export_cv.begin(), export_cv.end(), pad(alignment));
+}
+
+void shared_state::export_gj_halo(std::vector<fvm_value_type>& values) const {
+    for (auto cv: gj_export_cv) {
+        values.push_back(voltage[cv]);
+    }
+}
+
+void shared_state::import_gj_halo(const std::vector<fvm_value_type>& values) {
+    arb_assert(values.size()==gj_halo_voltage.size());
+    std::copy(values.begin(), values.end(), gj_halo_voltage.begin());
+}
+
+void shared_state::configure_crank_nicolson() {
+    voltage_half = array(init_voltage.begin(), init_voltage.end(), pad(alignment));
+}
+
+void shared_state::extrapolate_voltage() {
+    for (fvm_size_type i = 0; i<n_cv; i+=simd_width) {
+        simd_value_type v(voltage.data()+i);
+        simd_value_type v_half(voltage_half.data()+i);
+        v = simd_value_type(2)*v_half-v;
+        v.copy_to(voltage.data()+i);
+    }
+}
+
 void shared_state::set_dt() {
-    for (fvm_size_type j = 0; j<n_intdom; j+=simd_width) {
-        simd_value_type t(time.data()+j);
-        simd_value_type t_to(time_to.data()+j);
+    bool changed = false;
+    for (fvm_size_type j = 0; j<n_intdom; ++j) {
+        auto dt = time_to[j]-time[j];
+        changed |= dt!=dt_intdom[j];
+        dt_intdom[j] = dt;
+    }
+
+    // With fixed steps, the dt of an integration domain only changes when a
+    // step is cut short by an event or the end of the epoch, and on the step
+    // after: skip the pass over the CVs otherwise.
+    if (!changed) return;
 
-        auto dt = t_to-t;
-        dt.copy_to(dt_intdom.data()+j);
+    if (cv_intdom_identity) {
+        std::copy(dt_intdom.begin(), dt_intdom.begin()+n_cv, dt_cv.begin());
+        return;
     }
 
     for (fvm_size_type i = 0; i<n_cv; i+=simd_width) {
@@ -196,12 +398,58 @@ void shared_state::set_dt() {
 }
 
 void shared_state::add_gj_current() {
-    for (unsigned i = 0; i < n_gj; i++) {
-        auto gj = gap_junctions[i];
-        auto curr = gj.weight *
-                    (voltage[gj.loc.second] - voltage[gj.loc.first]); // nA
+    // The current into the CV of a row is the sum over its junctions of
+    // weight × (voltage - peer voltage). Each lane of a slice sums the
+    // weighted peer voltages of one row; the CVs of the lanes of a slice
+    // are distinct, except for the padding of the last slice, which has
+    // zero weight and is accumulated with index_constraint::none.
+    //
+    // With SIMD width 1 each slice is a row, and a scalar loop over the rows
+    // avoids the cost of the index constraints.
+    if (simd_width==1) {
+        for (auto r: util::make_span(gj_cv.size())) {
+            auto cv = gj_cv[r];
+            fvm_value_type peer_current = 0;
+            for (auto i: util::make_span(gj_slice_divs[r], gj_slice_divs[r+1])) {
+                peer_current += gj_weight[i]*voltage[gj_peer[i]];
+            }
+            current_density[cv] += gj_row_weight[r]*voltage[cv]-peer_current;
+            conductivity[cv] += gj_row_weight[r];
+        }
+    }
+    else {
+        auto add = [&](const iarray& slices, index_constraint constraint) {
+            for (auto r0: slices) {
+                auto s = r0/simd_width;
+
+                simd_value_type peer_current(fvm_value_type(0));
+                for (auto i = gj_slice_divs[s]; i<gj_slice_divs[s+1]; i += simd_width) {
+                    simd_index_type peer(gj_peer.data()+i);
+                    simd_value_type weight(gj_weight.data()+i);
+                    peer_current = fma(weight, simd_value_type(simd::indirect(voltage.data(), peer)), peer_current);
+                }
+
+                simd_index_type cv(gj_cv.data()+r0);
+                simd_value_type g(gj_row_weight.data()+r0);
+                simd_value_type v(simd::indirect(voltage.data(), cv, constraint));
+
+                simd::indirect(current_density.data(), cv, constraint) += g*v-peer_current;
+                simd::indirect(conductivity.data(), cv, constraint) += g;
+            }
+        };
+
+        add(gj_constraints.contiguous, index_constraint::contiguous);
+        add(gj_constraints.independent, index_constraint::independent);
+        add(gj_constraints.constant, index_constraint::constant);
+        add(gj_constraints.none, index_constraint::none);
+    }
 
-        current_density[gj.loc.first] -= curr;
+    // Junctions with peers in other cell groups, against the imported peer
+    // voltages.
+    for (auto i: util::count_along(gj_halo_cv)) {
+        auto cv = gj_halo_cv[i];
+        current_density[cv] += gj_halo_weight[i]*(voltage[cv]-gj_halo_voltage[i]);
+        conductivity[cv] += gj_halo_weight[i];
     }
 }
 
@@ -213,6 +461,57 @@ std::pair<fvm_value_type, fvm_value_type> shared_state::voltage_bounds() const {
     return util::minmax_value(voltage);
 }
 
+std::vector<probe_handle> shared_state::configure_reductions(const std::vector<fvm_probe_reduction>& descs) {
+    std::vector<fvm_size_type> order;
+    util::assign(order, util::make_span(descs.size()));
+    util::stable_sort_by(order, [&](fvm_size_type r) { return descs[r].intdom; });
+
+    std::vector<fvm_index_type> cv;
+    std::vector<fvm_value_type> weight, bin_edges;
+    std::vector<fvm_size_type> value_offset(descs.size());
+
+    reductions.clear();
+    reduction_divs.assign(n_intdom+1, 0);
+
+    fvm_size_type n_value = 0;
+    for (auto r: order) {
+        const auto& desc = descs[r];
+        const fvm_value_type* source =
+            desc.source==probe_reduction_source::voltage? voltage.data(): current_density.data();
+
+        reduction_info info;
+        info.kind = desc.kind;
+        info.source = source;
+        info.cv_begin = cv.size();
+        info.edge_begin = bin_edges.size();
+        info.value_begin = n_value;
+
+        util::append(cv, desc.cv);
+        util::append(weight, desc.weight);
+        util::append(bin_edges, desc.bin_edges);
+        info.cv_end = cv.size();
+
+        value_offset[r] = n_value;
+        n_value += desc.width();
+        info.value_end = n_value;
+
+        reductions.push_back(info);
+        ++reduction_divs[desc.intdom+1];
+    }
+    std::partial_sum(reduction_divs.begin(), reduction_divs.end(), reduction_divs.begin());
+
+    reduction_cv = iarray(cv.begin(), cv.end(), pad(alignment));
+    reduction_weight = array(weight.begin(), weight.end(), pad(alignment));
+    reduction_bin_edges = array(bin_edges.begin(), bin_edges.end(), pad(alignment));
+    reduction_value = array(n_value, 0, pad(alignment));
+
+    std::vector<probe_handle> handles;
+    for (auto offset: value_offset) {
+        handles.push_back(reduction_value.data()+offset);
+    }
+    return handles;
+}
+
 void shared_state::take_samples(
     const sample_event_stream::state& s,
     array& sample_time,
@@ -221,11 +520,49 @@ void shared_state::take_samples(
     for (fvm_size_type i = 0; i<s.n_streams(); ++i) {
         auto begin = s.begin_marked(i);
         auto end = s.end_marked(i);
+        if (begin==end) continue;
+
+        // Evaluate reductions on this intdom before copying out values.
+        if (!reductions.empty()) {
+            for (auto r = reduction_divs[i]; r<reduction_divs[i+1]; ++r) {
+                const auto& red = reductions[r];
+                auto value = reduction_value.data()+red.value_begin;
+
+                switch (red.kind) {
+                case probe_reduction_kind::mean:
+                case probe_reduction_kind::sum: {
+                        fvm_value_type sum = 0, wsum = 0;
+                        for (auto j = red.cv_begin; j<red.cv_end; ++j) {
+                            sum += reduction_weight[j]*red.source[reduction_cv[j]];
+                            wsum += reduction_weight[j];
+                        }
+                        *value = red.kind==probe_reduction_kind::sum? sum: sum/wsum;
+                    }
+                    break;
+                case probe_reduction_kind::histogram: {
+                        auto edges = reduction_bin_edges.data()+red.edge_begin;
+                        auto n_bin = red.value_end-red.value_begin;
+
+                        std::fill(value, value+n_bin, 0);
+                        for (auto j = red.cv_begin; j<red.cv_end; ++j) {
+                            auto x = red.source[reduction_cv[j]];
+                            auto bin = std::upper_bound(edges, edges+n_bin+1, x)-edges;
+                            if (bin>0 && (fvm_size_type)bin<=n_bin) {
+                                value[bin-1] += 1;
+                            }
+                        }
+                    }
+                    break;
+                }
+            }
+        }
 
         // (Note: probably not worth explicitly vectorizing this.)
         for (auto p = begin; p<end; ++p) {
             sample_time[p->offset] = time[i];
-            sample_value[p->offset] = *p->handle;
+            for (sample_size_type j = 0; j<p->width; ++j) {
+                sample_value[p->value_offset+j] = p->handle[j];
+            }
         }
     }
 }
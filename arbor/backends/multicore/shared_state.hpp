@@ -13,6 +13,7 @@
 #include <arbor/simd/simd.hpp>
 
 #include "backends/event.hpp"
+#include "backends/probe_reduction.hpp"
 #include "util/padded_alloc.hpp"
 #include "util/rangeutil.hpp"
 
@@ -21,6 +22,7 @@
 #include "threshold_watcher.hpp"
 
 #include "multicore_common.hpp"
+#include "partition_by_constraint.hpp"
 
 namespace arb {
 namespace multicore {
@@ -52,6 +54,9 @@ struct ion_state {
 
     array charge;           // charge of ionic species (global value, length 1)
 
+    bool write_Xi_ = true;  // Is Xi_ written by any mechanism?
+    bool write_Xo_ = true;  // Is Xo_ written by any mechanism?
+
     ion_state() = default;
 
     ion_state(
@@ -60,17 +65,21 @@ struct ion_state {
         const std::vector<fvm_value_type>& init_Xi,
         const std::vector<fvm_value_type>& init_Xo,
         const std::vector<fvm_value_type>& init_eX,
+        bool write_Xi,
+        bool write_Xo,
         unsigned align
     );
 
-    // Set ion concentrations to weighted proportion of default concentrations.
+    // Set ion concentrations that are written by mechanisms to weighted
+    // proportion of default concentrations; the others keep their initial
+    // values.
     void init_concentration();
 
     // Set ionic current density to zero.
     void zero_current();
 
-    // Zero currents, reset concentrations, and reset reversal potential from
-    // initial values.
+    // Zero currents, reset all concentrations, and reset reversal potential
+    // from initial values.
     void reset();
 };
 
@@ -83,7 +92,7 @@ struct shared_state {
     fvm_size_type n_gj = 0;   // Total number of GJs.
 
     iarray cv_to_intdom;      // Maps CV index to integration domain index.
-    gjarray  gap_junctions;   // Stores gap_junction info.
+    bool cv_intdom_identity = false; // CV i is in integration domain i (single-CV cells without gap junctions).
     array time;               // Maps intdom index to integration start time [ms].
     array time_to;            // Maps intdom index to integration stop time [ms].
     array dt_intdom;          // Maps  index to (stop time) - (start time) [ms].
@@ -96,10 +105,60 @@ struct shared_state {
     array temperature_degC;   // Maps CV to local temperature (read only) [°C].
     array diam_um;            // Maps CV to local diameter (read only) [µm].
 
+    // Gap junctions as the rows of a sparse matrix, one for each CV with
+    // junctions, sorted by CV. The rows are taken a SIMD width at a time in
+    // slices, and each slice holds its junctions column by column, padded
+    // with zero weight to the length of its longest row: junction j of row
+    // r is at gj_slice_divs[r/W]+j*W+r%W, for SIMD width W.
+    iarray gj_cv;             // Maps row to local CV.
+    array gj_row_weight;      // Maps row to the sum of its GJ weights [kS/m²].
+    iarray gj_slice_divs;     // Partitions GJ indices by slice.
+    iarray gj_peer;           // Maps GJ index to peer CV.
+    array gj_weight;          // Maps GJ index to conductance per area of the local CV [kS/m²].
+    constraint_partition gj_constraints; // First row of each slice, by index constraint of gj_cv.
+
+    // Gap junctions with peers in other cell groups, set by configure_gj_halo().
+    iarray gj_halo_cv;        // Maps halo GJ index to local CV.
+    array gj_halo_weight;     // Maps halo GJ index to conductance per area of the local CV [kS/m²].
+    array gj_halo_voltage;    // Maps halo GJ index to peer voltage, set by import_gj_halo() [mV].
+    iarray gj_export_cv;      // CVs of the GJ sites whose voltage is exported to other cell groups.
+
+    // Adaptive time steps, allocated by configure_adaptive_dt().
+    bool adaptive_dt = false;
+    fvm_value_type dt_tolerance = 0;  // Local error tolerance per step [mV].
+    fvm_value_type dt_step_max = 0;   // Largest step [ms].
+    array dt_step;            // Maps intdom index to size of next step [ms].
+    array dt_last;            // Maps intdom index to dt of the last step [ms].
+    array step_error;         // Maps intdom index to local error of the last step [mV].
+    array voltage_last;       // Maps CV index to voltage at the start of the step [mV].
+    array dv_last;            // Maps CV index to change in voltage over the last step [mV].
+    iarray breakpoint_divs;   // Partitions breakpoints by intdom.
+    iarray breakpoint_next;   // Maps intdom index to index of its next breakpoint.
+    array breakpoints;        // Times at which steps must end [ms].
+
+    // Crank–Nicolson voltage integration, allocated by configure_crank_nicolson().
+    array voltage_half;       // Maps CV index to voltage at the midpoint of the step [mV].
+
     std::unordered_map<std::string, ion_state> ion_data;
 
     deliverable_event_stream deliverable_events;
 
+    // Reduction probes, evaluated when samples are taken on their intdom.
+    struct reduction_info {
+        probe_reduction_kind kind;
+        const fvm_value_type* source;
+        fvm_size_type cv_begin, cv_end;   // Range in reduction_cv and reduction_weight.
+        fvm_size_type edge_begin;         // First bin edge in reduction_bin_edges.
+        fvm_size_type value_begin, value_end; // Range in reduction_value.
+    };
+
+    std::vector<reduction_info> reductions;     // Ordered by intdom.
+    std::vector<fvm_size_type> reduction_divs;  // Partitions reductions by intdom.
+    iarray reduction_cv;
+    array reduction_weight;
+    array reduction_bin_edges;
+    array reduction_value;
+
     shared_state() = default;
 
     shared_state(
@@ -118,7 +177,9 @@ struct shared_state {
         const std::vector<fvm_index_type>& cv,
         const std::vector<fvm_value_type>& init_iconc,
         const std::vector<fvm_value_type>& init_econc,
-        const std::vector<fvm_value_type>& init_erev);
+        const std::vector<fvm_value_type>& init_erev,
+        bool iconc_written,
+        bool econc_written);
 
     void zero_currents();
 
@@ -129,12 +190,58 @@ struct shared_state {
     // Set time_to to earliest of time+dt_step and tmax.
     void update_time_to(fvm_value_type dt_step, fvm_value_type tmax);
 
+    // Take adaptive steps of at most dt_max with the given local error
+    // tolerance: see update_time_to_adaptive() and update_dt_step().
+    // Steps of each integration domain end at its breakpoints, given as
+    // sorted times partitioned by intdom, where the inputs to the cell
+    // change discontinuously.
+    void configure_adaptive_dt(
+        fvm_value_type tolerance,
+        fvm_value_type dt_max,
+        const std::vector<fvm_index_type>& breakpoint_divs,
+        const std::vector<fvm_value_type>& breakpoints);
+
+    // Set time_to to earliest of time+dt_step, the next breakpoint and tmax,
+    // with steps of at least dt_min otherwise. Integration domains with
+    // marked events or at a breakpoint restart from steps of dt_min.
+    void update_time_to_adaptive(fvm_value_type dt_min, fvm_value_type tmax);
+
+    // Choose the size of the next step of each integration domain from an
+    // estimate of the local error in voltage of the step just taken: half
+    // the difference between the change in voltage over the step and over
+    // the step before, scaled to the same step size.
+    void update_dt_step(fvm_value_type dt_min);
+
+    // Allocate the midpoint voltage of the Crank–Nicolson scheme.
+    void configure_crank_nicolson();
+
+    // Complete a Crank–Nicolson step, given the backward Euler solution
+    // over half the step in voltage_half: the voltage at the end of the
+    // step is extrapolated from the voltage at its start and midpoint.
+    void extrapolate_voltage();
+
     // Set the per-integration domain and per-compartment dt from time_to - time.
+    // The per-compartment dt is only rewritten if some per-integration domain
+    // dt has changed since the last call.
     void set_dt();
 
-    // Update gap_junction state
+    // Add the current of each gap junction to its local CV, and its
+    // conductance to the CV's conductivity: the local voltage is then
+    // integrated implicitly, and the peer voltage explicitly.
     void add_gj_current();
 
+    // Set up gap junctions with peers in other cell groups, given with the
+    // index of the peer voltage in place of the peer CV, and the CVs of the
+    // gap junction sites whose voltage other cell groups import.
+    void configure_gj_halo(const std::vector<fvm_gap_junction>& halo_gj, const std::vector<fvm_index_type>& export_cv);
+
+    // Append the voltage of each exported gap junction site to values.
+    void export_gj_halo(std::vector<fvm_value_type>& values) const;
+
+    // Set the peer voltage of each halo gap junction. Until the first
+    // import after reset, the peer voltage is that of the local CV.
+    void import_gj_halo(const std::vector<fvm_value_type>& values);
+
     // Return minimum and maximum time value [ms] across cells.
     std::pair<fvm_value_type, fvm_value_type> time_bounds() const;
 
@@ -142,6 +249,9 @@ struct shared_state {
     // (Used for solution bounds checking.)
     std::pair<fvm_value_type, fvm_value_type> voltage_bounds() const;
 
+    // Set up reduction probes, returning a probe handle for each reduction.
+    std::vector<probe_handle> configure_reductions(const std::vector<fvm_probe_reduction>& reductions);
+
     // Take samples according to marked events in a sample_event_stream.
     void take_samples(
         const sample_event_stream::state& s,
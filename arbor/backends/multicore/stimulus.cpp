@@ -21,8 +21,7 @@ public:
     void nrn_init() override {}
     void nrn_state() override {}
     void nrn_current() override {
-        size_type n = size();
-        for (size_type i=0; i<n; ++i) {
+        for (size_type i=begin_; i<end_; ++i) {
             auto cv = node_index_[i];
             auto t = vec_t_[vec_ci_[cv]];
 
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include <arbor/assert.hpp>
 #include <arbor/fvm_types.hpp>
 #include <arbor/math.hpp>
+#include <arbor/simd/simd.hpp>
 
 #include "backends/threshold_crossing.hpp"
 #include "execution_context.hpp"
@@ -11,7 +16,23 @@
 namespace arb {
 namespace multicore {
 
+// Detectors are tested W at a time, where W is the native SIMD width: the
+// voltages are gathered and compared against the thresholds in one vector
+// operation, and the comparison is packed into the bits of a word. The
+// crossing state of detector i is bit i%64 of is_crossed_[i/64], so the new
+// crossings of a block are the bits set in the comparison and clear in the
+// crossing state, and the new crossing state of 64 detectors is the packed
+// comparison. Only the new crossings are visited to interpolate their times.
+
 class threshold_watcher {
+    static constexpr unsigned simd_width = simd::simd_abi::native_width<fvm_value_type>::value;
+
+    using simd_value = simd::simd<fvm_value_type, simd_width>;
+    using simd_index = simd::simd<fvm_index_type, simd_width>;
+
+    static constexpr unsigned word_bits = 64;
+    static_assert(word_bits%simd_width==0, "SIMD width must divide the bitset word size");
+
 public:
     threshold_watcher() = default;
 
@@ -32,9 +53,9 @@ public:
         values_(values),
         n_cv_(cv_index.size()),
         cv_index_(cv_index),
-        is_crossed_(n_cv_),
+        is_crossed_((n_cv_+word_bits-1)/word_bits),
         thresholds_(thresholds),
-        v_prev_(values_, values_+n_cv_)
+        v_prev_(n_cv_)
     {
         arb_assert(n_cv_==thresholds.size());
         reset();
@@ -51,8 +72,10 @@ public:
     /// calling, because the values are used to determine the initial state
     void reset() {
         clear_crossings();
+        std::fill(is_crossed_.begin(), is_crossed_.end(), 0);
         for (fvm_size_type i = 0; i<n_cv_; ++i) {
-            is_crossed_[i] = values_[cv_index_[i]]>=thresholds_[i];
+            v_prev_[i] = values_[cv_index_[i]];
+            is_crossed_[i/word_bits] |= word(v_prev_[i]>=thresholds_[i])<<(i%word_bits);
         }
     }
 
@@ -64,36 +87,39 @@ public:
     /// Crossing events are recorded for each threshold that
     /// is crossed since the last call to test
     void test() {
-        for (fvm_size_type i = 0; i<n_cv_; ++i) {
-            auto cv     = cv_index_[i];
-            auto cell   = cv_to_intdom_[cv];
-            auto v_prev = v_prev_[i];
-            auto v      = values_[cv];
-            auto thresh = thresholds_[i];
-
-            if (!is_crossed_[i]) {
-                if (v>=thresh) {
-                    // The threshold has been passed, so estimate the time using
-                    // linear interpolation.
-                    auto pos = (thresh - v_prev)/(v - v_prev);
-                    auto crossing_time = math::lerp(t_before_[cell], t_after_[cell], pos);
-                    crossings_.push_back({i, crossing_time});
-
-                    is_crossed_[i] = true;
-                }
+        constexpr fvm_size_type W = simd_width;
+        // With one lane, the scalar loop is faster than the SIMD one.
+        const fvm_size_type n_simd = W>1? n_cv_-n_cv_%W: 0;
+
+        for (fvm_size_type b = 0; b<n_cv_; b += word_bits) {
+            const word crossed = is_crossed_[b/word_bits];
+            word above = 0;
+
+            fvm_size_type i = b;
+            for (const auto end = std::min(b+word_bits, n_simd); i<end; i += W) {
+                simd_value v(simd::indirect(values_, simd_index(cv_index_.data()+i)));
+                word k = (v>=simd_value(thresholds_.data()+i)).pack();
+
+                record_crossings(i, k&~(crossed>>(i-b)));
+                v.copy_to(v_prev_.data()+i);
+                above |= k<<(i-b);
             }
-            else {
-                if (v<thresh) {
-                    is_crossed_[i] = false;
+            for (const auto end = std::min(b+word_bits, n_cv_); i<end; ++i) {
+                auto v = values_[cv_index_[i]];
+                if (v>=thresholds_[i]) {
+                    word bit = word(1)<<(i-b);
+                    if (!(crossed&bit)) record_crossings(i, 1);
+                    above |= bit;
                 }
+                v_prev_[i] = v;
             }
 
-            v_prev_[i] = v;
+            is_crossed_[b/word_bits] = above;
         }
     }
 
     bool is_crossed(fvm_size_type i) const {
-        return is_crossed_[i];
+        return (is_crossed_[i/word_bits]>>(i%word_bits))&1;
     }
 
     /// The number of threshold values that are monitored.
@@ -102,6 +128,28 @@ public:
     }
 
 private:
+    using word = std::uint64_t;
+
+    /// Record a crossing for detector i+k for each bit k set in `up`, before
+    /// v_prev_ is overwritten for these detectors.
+    void record_crossings(fvm_size_type i, word up) {
+        for (; up; up >>= 1, ++i) {
+            if (up&1) {
+                auto cv     = cv_index_[i];
+                auto cell   = cv_to_intdom_[cv];
+                auto v_prev = v_prev_[i];
+                auto v      = values_[cv];
+                auto thresh = thresholds_[i];
+
+                // The threshold has been passed, so estimate the time using
+                // linear interpolation.
+                auto pos = (thresh - v_prev)/(v - v_prev);
+                auto crossing_time = math::lerp(t_before_[cell], t_after_[cell], pos);
+                crossings_.push_back({i, crossing_time});
+            }
+        }
+    }
+
     /// Non-owning pointers to cv-to-cell map, per-cell time data,
     /// and the values for to test against thresholds.
     const fvm_index_type* cv_to_intdom_ = nullptr;
@@ -112,7 +160,7 @@ private:
     /// Threshold watcher state.
     fvm_size_type n_cv_ = 0;
     std::vector<fvm_index_type> cv_index_;
-    std::vector<fvm_size_type> is_crossed_;
+    std::vector<word> is_crossed_;
     std::vector<fvm_value_type> thresholds_;
     std::vector<fvm_value_type> v_prev_;
     std::vector<threshold_crossing> crossings_;
@@ -0,0 +1,37 @@
+#pragma once
+
+// Back-end independent description of reduction probes, as provided to the
+// back-end shared state.
+
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+
+namespace arb {
+
+enum class probe_reduction_kind {
+    mean,       // Weighted mean of values.
+    sum,        // Weighted sum of values.
+    histogram   // Count of values in each bin.
+};
+
+enum class probe_reduction_source {
+    voltage,         // Membrane voltage [mV].
+    current_density  // Membrane current density [A/m²].
+};
+
+struct fvm_probe_reduction {
+    probe_reduction_kind kind;
+    probe_reduction_source source;
+    fvm_index_type intdom;                 // Integration domain of the CVs.
+    std::vector<fvm_index_type> cv;        // Distinct CV indices.
+    std::vector<fvm_value_type> weight;    // Per-CV weights (mean and sum).
+    std::vector<fvm_value_type> bin_edges; // Ascending bin edges (histogram).
+
+    // Number of values produced per sample.
+    fvm_size_type width() const {
+        return kind==probe_reduction_kind::histogram? bin_edges.size()-1: 1;
+    }
+};
+
+} // namespace arb
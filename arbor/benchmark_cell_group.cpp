@@ -81,7 +81,7 @@ void benchmark_cell_group::clear_spikes() {
 }
 
 void benchmark_cell_group::add_sampler(sampler_association_handle h,
-                                   cell_member_predicate probe_ids,
+                                   probe_selector probe_ids,
                                    schedule sched,
                                    sampler_function fn,
                                    sampling_policy policy)
@@ -89,4 +89,13 @@ void benchmark_cell_group::add_sampler(sampler_association_handle h,
     std::logic_error("A benchmark_cell group doen't support sampling of internal state!");
 }
 
+void benchmark_cell_group::add_sampler(sampler_association_handle h,
+                                   probe_selector probe_ids,
+                                   schedule sched,
+                                   bulk_sampler_function fn,
+                                   sampling_policy policy)
+{
+    std::logic_error("A benchmark_cell group doen't support sampling of internal state!");
+}
+
 } // namespace arb
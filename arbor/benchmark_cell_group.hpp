@@ -27,7 +27,9 @@ public:
 
     void clear_spikes() override;
 
-    void add_sampler(sampler_association_handle h, cell_member_predicate probe_ids, schedule sched, sampler_function fn, sampling_policy policy) override;
+    void add_sampler(sampler_association_handle h, probe_selector probe_ids, schedule sched, sampler_function fn, sampling_policy policy) override;
+
+    void add_sampler(sampler_association_handle h, probe_selector probe_ids, schedule sched, bulk_sampler_function fn, sampling_policy policy) override;
 
     void remove_sampler(sampler_association_handle h) override {}
 
@@ -50,6 +50,10 @@ void check_global_properties(const cable_cell_global_properties& G) {
             throw cable_cell_error("missing init_reversal_potential or reversal_potential_method for ion "+ion);
         }
     }
+
+    if (G.adaptive_dt && !(G.adaptive_dt_tolerance>0 && G.adaptive_dt_max>0)) {
+        throw cable_cell_error("adaptive time step tolerance and maximum must be positive");
+    }
 }
 
 cable_cell_local_parameter_set neuron_parameter_defaults = {
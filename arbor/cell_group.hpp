@@ -5,6 +5,8 @@
 #include <vector>
 
 #include <arbor/common_types.hpp>
+#include <arbor/fvm_types.hpp>
+#include <arbor/recipe.hpp>
 #include <arbor/sampling.hpp>
 #include <arbor/schedule.hpp>
 #include <arbor/spike.hpp>
@@ -31,10 +33,20 @@ public:
     virtual const std::vector<spike>& spikes() const = 0;
     virtual void clear_spikes() = 0;
 
+    // Gap junctions with cells in other groups are coupled through a halo
+    // exchange of the voltages at their sites: see fvm_lowered_cell for the
+    // order of the halo junctions and exported voltages. Groups of cells
+    // without gap junctions have no halo.
+
+    virtual std::vector<gap_junction_connection> halo_junctions() const { return {}; }
+    virtual void export_halo(std::vector<fvm_value_type>&) const {}
+    virtual void import_halo(const std::vector<fvm_value_type>&) {}
+
     // Sampler association methods below should be thread-safe, as they might be invoked
     // from a sampler call back called from a different cell group running on a different thread.
 
-    virtual void add_sampler(sampler_association_handle, cell_member_predicate, schedule, sampler_function, sampling_policy) = 0;
+    virtual void add_sampler(sampler_association_handle, probe_selector, schedule, sampler_function, sampling_policy) = 0;
+    virtual void add_sampler(sampler_association_handle, probe_selector, schedule, bulk_sampler_function, sampling_policy) = 0;
     virtual void remove_sampler(sampler_association_handle) = 0;
     virtual void remove_all_samplers() = 0;
 };
@@ -68,6 +68,27 @@ struct dry_run_context_impl {
         return gathered_vector<cell_gid_type>(std::move(gathered_gids), std::move(partition));
     }
 
+    // Every rank is a copy of the local one, so the halo of each rank holds
+    // the same values.
+    gathered_vector<fvm_value_type>
+    gather_halo(const std::vector<fvm_value_type>& local_values) const {
+        using count_type = typename gathered_vector<fvm_value_type>::count_type;
+
+        count_type local_size = local_values.size();
+
+        std::vector<fvm_value_type> gathered_values;
+        gathered_values.reserve(local_size*num_ranks_);
+
+        std::vector<count_type> partition;
+        for (count_type i = 0; i < num_ranks_; i++) {
+            partition.push_back(static_cast<count_type>(i*local_size));
+            gathered_values.insert(gathered_values.end(), local_values.begin(), local_values.end());
+        }
+        partition.push_back(static_cast<count_type>(num_ranks_*local_size));
+
+        return gathered_vector<fvm_value_type>(std::move(gathered_values), std::move(partition));
+    }
+
     int id() const { return 0; }
 
     int size() const { return num_ranks_; }
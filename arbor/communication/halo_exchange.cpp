@@ -0,0 +1,94 @@
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
+#include <arbor/assert.hpp>
+#include <arbor/common_types.hpp>
+#include <arbor/fvm_types.hpp>
+#include <arbor/recipe.hpp>
+
+#include "cell_group.hpp"
+#include "communication/gathered_vector.hpp"
+#include "distributed_context.hpp"
+#include "execution_context.hpp"
+#include "profile/profiler_macro.hpp"
+#include "util/span.hpp"
+
+#include "communication/halo_exchange.hpp"
+
+namespace arb {
+
+halo_exchange::halo_exchange(const std::vector<cell_group_ptr>& groups, execution_context& ctx):
+    distributed_(ctx.distributed)
+{
+    // The sites exported by each group, in order of first appearance as the
+    // local site of a halo junction, as pairs of gid and site index.
+    std::vector<std::vector<gap_junction_connection>> group_junctions;
+    std::vector<cell_gid_type> local_sites;
+    for (auto i: util::count_along(groups)) {
+        auto junctions = groups[i]->halo_junctions();
+        if (junctions.empty()) continue;
+
+        std::unordered_set<cell_member_type> exported;
+        for (const auto& gj: junctions) {
+            if (!exported.count(gj.local)) {
+                exported.insert(gj.local);
+                local_sites.push_back(gj.local.gid);
+                local_sites.push_back(gj.local.index);
+            }
+        }
+        groups_.push_back(i);
+        group_junctions.push_back(std::move(junctions));
+    }
+
+    // Index of each exported site in the gathered voltages, which are in
+    // the order of the gathered sites.
+    auto global_sites = distributed_->gather_gids(local_sites);
+
+    std::unordered_map<cell_member_type, fvm_size_type> site_index;
+    const auto& sites = global_sites.values();
+    for (std::size_t i = 0; i<sites.size(); i += 2) {
+        site_index[{sites[i], sites[i+1]}] = n_global_++;
+    }
+
+    // A peer site that is not exported is not the site of a gap junction
+    // to another group: the junction must be listed on both cells.
+    import_divs_.push_back(0);
+    for (const auto& junctions: group_junctions) {
+        for (const auto& gj: junctions) {
+            auto it = site_index.find(gj.peer);
+            if (it==site_index.end()) {
+                throw gj_unsupported_domain_decomposition(gj.local.gid, gj.peer.gid);
+            }
+            import_index_.push_back(it->second);
+        }
+        import_divs_.push_back(import_index_.size());
+    }
+}
+
+void halo_exchange::exchange(std::vector<cell_group_ptr>& groups) {
+    PE(communication_halo_export);
+    exported_.clear();
+    for (auto i: groups_) {
+        groups[i]->export_halo(exported_);
+    }
+    PL();
+
+    PE(communication_halo_gather);
+    auto global = distributed_->gather_halo(exported_);
+    PL();
+
+    PE(communication_halo_import);
+    arb_assert(global.values().size()==n_global_);
+    for (auto k: util::count_along(groups_)) {
+        imported_.clear();
+        for (auto j: util::make_span(import_divs_[k], import_divs_[k+1])) {
+            imported_.push_back(global.values()[import_index_[j]]);
+        }
+        groups[groups_[k]]->import_halo(imported_);
+    }
+    PL();
+}
+
+} // namespace arb
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+
+#include <arbor/common_types.hpp>
+#include <arbor/fvm_types.hpp>
+
+#include "cell_group.hpp"
+#include "execution_context.hpp"
+
+namespace arb {
+
+// Halo exchange of the voltages at gap junction sites, for gap junctions
+// between cells of different cell groups, on this domain or others.
+//
+// Each cell group exports the voltage at the local site of each of its halo
+// junctions, and at each exchange the exported voltages of all domains are
+// gathered. The layout of the gathered voltages is fixed at construction,
+// when the exported sites of all domains are gathered. Each group then
+// imports the voltage at the peer site of each of its halo junctions.
+//
+// Construction and exchange are collective over all domains.
+
+class halo_exchange {
+public:
+    halo_exchange() = default;
+
+    halo_exchange(const std::vector<cell_group_ptr>& groups, execution_context& ctx);
+
+    // True if no cell group on any domain has halo junctions.
+    bool empty() const {
+        return n_global_ == 0;
+    }
+
+    // Indices of the local cell groups with halo junctions.
+    const std::vector<cell_size_type>& groups() const {
+        return groups_;
+    }
+
+    // Export the voltages of the local cell groups, gather the voltages of
+    // all domains, and import the peer voltages of the halo junctions.
+    void exchange(std::vector<cell_group_ptr>& groups);
+
+private:
+    distributed_context_handle distributed_;
+    fvm_size_type n_global_ = 0;
+
+    std::vector<cell_size_type> groups_;
+    // Index in the gathered voltages of the peer site of each halo
+    // junction, partitioned by group in groups_.
+    std::vector<fvm_size_type> import_index_;
+    std::vector<fvm_size_type> import_divs_;
+
+    std::vector<fvm_value_type> exported_;
+    std::vector<fvm_value_type> imported_;
+};
+
+} // namespace arb
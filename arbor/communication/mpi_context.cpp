@@ -38,6 +38,11 @@ struct mpi_context_impl {
         return mpi::gather_all_with_partition(local_gids, comm_);
     }
 
+    gathered_vector<fvm_value_type>
+    gather_halo(const std::vector<fvm_value_type>& local_values) const {
+        return mpi::gather_all_with_partition(local_values, comm_);
+    }
+
     std::string name() const { return "MPI"; }
     int id() const { return rank_; }
     int size() const { return size_; }
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 
+#include <arbor/fvm_types.hpp>
 #include <arbor/spike.hpp>
 #include <arbor/util/pp_util.hpp>
 
@@ -43,6 +44,7 @@ class distributed_context {
 public:
     using spike_vector = std::vector<arb::spike>;
     using gid_vector = std::vector<cell_gid_type>;
+    using halo_vector = std::vector<fvm_value_type>;
 
     // default constructor uses a local context: see below.
     distributed_context();
@@ -63,6 +65,12 @@ public:
         return impl_->gather_gids(local_gids);
     }
 
+    // Gather the halo values of all domains, such as the voltages at gap
+    // junction sites that cells on other domains are coupled to.
+    gathered_vector<fvm_value_type> gather_halo(const halo_vector& local_values) const {
+        return impl_->gather_halo(local_values);
+    }
+
     int id() const {
         return impl_->id();
     }
@@ -91,6 +99,8 @@ private:
             gather_spikes(const spike_vector& local_spikes) const = 0;
         virtual gathered_vector<cell_gid_type>
             gather_gids(const gid_vector& local_gids) const = 0;
+        virtual gathered_vector<fvm_value_type>
+            gather_halo(const halo_vector& local_values) const = 0;
         virtual int id() const = 0;
         virtual int size() const = 0;
         virtual void barrier() const = 0;
@@ -115,6 +125,10 @@ private:
         gather_gids(const gid_vector& local_gids) const override {
             return wrapped.gather_gids(local_gids);
         }
+        gathered_vector<fvm_value_type>
+        gather_halo(const halo_vector& local_values) const override {
+            return wrapped.gather_halo(local_values);
+        }
         int id() const override {
             return wrapped.id();
         }
@@ -157,6 +171,14 @@ struct local_context {
                 {0u, static_cast<count_type>(local_gids.size())}
         );
     }
+    gathered_vector<fvm_value_type>
+    gather_halo(const std::vector<fvm_value_type>& local_values) const {
+        using count_type = typename gathered_vector<fvm_value_type>::count_type;
+        return gathered_vector<fvm_value_type>(
+                std::vector<fvm_value_type>(local_values),
+                {0u, static_cast<count_type>(local_values.size())}
+        );
+    }
 
     int id() const { return 0; }
 
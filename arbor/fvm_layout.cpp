@@ -1,9 +1,12 @@
+#include <algorithm>
+#include <numeric>
 #include <set>
 #include <stdexcept>
 #include <unordered_set>
 #include <vector>
 
 #include <arbor/arbexcept.hpp>
+#include <arbor/assert.hpp>
 #include <arbor/cable_cell.hpp>
 #include <arbor/util/optional.hpp>
 
@@ -201,6 +204,17 @@ namespace {
 //       = 1/R · hV₁V₂/(h₂²V₁+h₁²V₂)
 //
 
+fvm_size_type fvm_num_cvs(const cable_cell& cell) {
+    fvm_size_type ncv = 0;
+    for (unsigned i = 0; i < cell.segments().size(); i++) {
+        ncv += cell.segment(i)->num_compartments();
+        if (!cell.segment(i)->is_soma() && cell.parent(i)->is_soma()) {
+            ncv++;
+        }
+    }
+    return ncv;
+}
+
 fvm_discretization fvm_discretize(const std::vector<cable_cell>& cells, const cable_cell_parameter_set& global_defaults) {
 
     using value_type = fvm_value_type;
@@ -213,17 +227,7 @@ fvm_discretization fvm_discretize(const std::vector<cable_cell>& cells, const ca
         transform_view(cells, [](const cable_cell& c) { return c.num_branches(); }));
 
     std::vector<index_type> cell_cv_bounds;
-    auto cell_cv_part = make_partition(cell_cv_bounds,
-        transform_view(cells, [](const cable_cell& c) {
-            unsigned ncv = 0;
-            for (unsigned i = 0; i < c.segments().size(); i++) {
-                ncv += c.segment(i)->num_compartments();
-                if (!c.segment(i)->is_soma() && c.parent(i)->is_soma()) {
-                    ncv++;
-                }
-            }
-            return ncv;
-        }));
+    auto cell_cv_part = make_partition(cell_cv_bounds, transform_view(cells, fvm_num_cvs));
 
     D.ncell = cells.size();
     D.ncv = cell_cv_part.bounds().second;
@@ -405,6 +409,44 @@ fvm_discretization fvm_discretize(const std::vector<cable_cell>& cells, const ca
     return D;
 }
 
+fvm_probe_reduction fvm_build_probe_reduction(const fvm_discretization& D, fvm_size_type cell_index, fvm_index_type intdom, const cell_probe_reduction& probe) {
+    fvm_probe_reduction red;
+
+    switch (probe.reduction) {
+    case cell_probe_reduction::mean:
+        red.kind = probe_reduction_kind::mean;
+        break;
+    case cell_probe_reduction::sum:
+        red.kind = probe_reduction_kind::sum;
+        break;
+    case cell_probe_reduction::histogram:
+        red.kind = probe_reduction_kind::histogram;
+        break;
+    }
+
+    red.source = probe.kind==cell_probe_address::membrane_voltage?
+        probe_reduction_source::voltage: probe_reduction_source::current_density;
+    red.intdom = intdom;
+
+    if (probe.locations.empty()) {
+        util::assign(red.cv, util::make_span(D.cell_cv_part()[cell_index]));
+    }
+    else {
+        for (auto loc: probe.locations) {
+            red.cv.push_back(D.branch_location_cv(cell_index, loc));
+        }
+        util::sort(red.cv);
+        red.cv.erase(std::unique(red.cv.begin(), red.cv.end()), red.cv.end());
+    }
+
+    for (auto cv: red.cv) {
+        red.weight.push_back(D.cv_area[cv]);
+    }
+    red.bin_edges = probe.bin_edges;
+
+    return red;
+}
+
 // Build up mechanisms.
 //
 // Processing procedes in the following stages:
@@ -419,6 +461,8 @@ fvm_discretization fvm_discretize(const std::vector<cable_cell>& cells, const ca
 
 fvm_mechanism_data fvm_build_mechanism_data(const cable_cell_global_properties& gprop, const std::vector<cable_cell>& cells, const fvm_discretization& D) {
     using util::assign;
+
+    arb_assert(D.cv_renumbering.empty());
     using util::sort_by;
     using util::optional;
 
@@ -770,10 +814,16 @@ fvm_mechanism_data fvm_build_mechanism_data(const cable_cell_global_properties&
                 if (!seg_ion_entry.mech_writes_iconc) {
                     ion_config.init_iconc[i] += weight*seg_ion_entry.ion_data.init_int_concentration;
                 }
+                else {
+                    ion_config.iconc_written = true;
+                }
 
                 if (!seg_ion_entry.mech_writes_econc) {
                     ion_config.init_econc[i] += weight*seg_ion_entry.ion_data.init_ext_concentration;
                 }
+                else {
+                    ion_config.econc_written = true;
+                }
 
                 // Reversal potentials are not area weighted, and are overridden at the
                 // per-cell level by any supplied revpot mechanisms.
@@ -1021,7 +1071,229 @@ fvm_mechanism_data fvm_build_mechanism_data(const cable_cell_global_properties&
             transform_view(stimuli, [](cv_clamp p) { return p.second.amplitude; }));
     }
 
+    // Group density mechanisms by CV set, in order of name.
+    std::vector<std::string> density_mechs;
+    for (const auto& entry: mechdata.mechanisms) {
+        if (entry.second.kind==mechanismKind::density) {
+            density_mechs.push_back(entry.first);
+        }
+    }
+    util::sort(density_mechs);
+
+    for (const auto& name: density_mechs) {
+        const auto& cv = mechdata.mechanisms.at(name).cv;
+        auto it = std::find_if(mechdata.colocated.begin(), mechdata.colocated.end(),
+            [&](const std::vector<std::string>& group) { return mechdata.mechanisms.at(group.front()).cv==cv; });
+
+        if (it==mechdata.colocated.end()) {
+            mechdata.colocated.push_back({name});
+        }
+        else {
+            it->push_back(name);
+        }
+    }
+    mechdata.colocated.erase(
+        std::remove_if(mechdata.colocated.begin(), mechdata.colocated.end(),
+            [](const std::vector<std::string>& group) { return group.size()<2; }),
+        mechdata.colocated.end());
+
     return mechdata;
 }
 
+// CV renumbering
+// --------------
+//
+// Orderings are computed per cell from the children of each CV, starting at
+// the root of the cell. Every ordering visits a CV only after its parent.
+
+std::vector<fvm_index_type> fvm_cv_order(cv_ordering ordering, const std::vector<fvm_index_type>& parent_cv, const std::vector<fvm_index_type>& cell_cv_bounds) {
+    using index_type = fvm_index_type;
+
+    const index_type ncv = parent_cv.size();
+
+    std::vector<index_type> order;
+    order.reserve(ncv);
+
+    if (ordering==cv_ordering::segment) {
+        util::assign(order, make_span(ncv));
+        return order;
+    }
+
+    // Children of each CV, in increasing CV order.
+    std::vector<index_type> child_divs(ncv+1, 0);
+    for (auto i: make_span(ncv)) {
+        if (parent_cv[i]!=i) ++child_divs[parent_cv[i]+1];
+    }
+    std::partial_sum(child_divs.begin(), child_divs.end(), child_divs.begin());
+
+    std::vector<index_type> children(child_divs.back());
+    {
+        std::vector<index_type> next(child_divs.begin(), child_divs.end()-1);
+        for (auto i: make_span(ncv)) {
+            if (parent_cv[i]!=i) children[next[parent_cv[i]]++] = i;
+        }
+    }
+
+    auto child_range = [&](index_type i) {
+        return util::subrange_view(children, child_divs[i], child_divs[i+1]);
+    };
+    auto degree = [&](index_type i) { return child_divs[i+1]-child_divs[i]; };
+
+    std::vector<index_type> pending;
+    for (auto cv_span: util::partition_view(cell_cv_bounds)) {
+        if (cv_span.first==cv_span.second) continue;
+
+        const index_type root = cv_span.first;
+        arb_assert(parent_cv[root]==root);
+
+        switch (ordering) {
+        case cv_ordering::segment:
+            break;
+        case cv_ordering::depth_first:
+            // Stack of CVs; children are pushed in reverse to be visited in order.
+            pending.assign(1, root);
+            while (!pending.empty()) {
+                auto i = pending.back();
+                pending.pop_back();
+                order.push_back(i);
+
+                for (auto k = child_divs[i+1]; k>child_divs[i]; --k) {
+                    pending.push_back(children[k-1]);
+                }
+            }
+            break;
+        case cv_ordering::cuthill_mckee:
+            // The output is the breadth-first queue.
+            order.push_back(root);
+            for (auto k = order.size()-1; k<order.size(); ++k) {
+                auto first = order.size();
+                util::append(order, child_range(order[k]));
+                std::stable_sort(order.begin()+first, order.end(),
+                    [&](index_type a, index_type b) { return degree(a)<degree(b); });
+            }
+            break;
+        case cv_ordering::branch_contiguous:
+            // Queue of the first CVs of unbranched runs.
+            pending.assign(1, root);
+            for (std::size_t k = 0; k<pending.size(); ++k) {
+                auto i = pending[k];
+                order.push_back(i);
+                while (degree(i)==1) {
+                    i = children[child_divs[i]];
+                    order.push_back(i);
+                }
+                util::append(pending, child_range(i));
+            }
+            break;
+        }
+    }
+
+    arb_assert(order.size()==std::size_t(ncv));
+    return order;
+}
+
+namespace {
+    // Replace v by v[order[0]], v[order[1]], ...
+    template <typename V>
+    void apply_order(V& v, const std::vector<fvm_index_type>& order) {
+        if (v.empty()) return;
+
+        V w;
+        w.reserve(order.size());
+        for (auto j: order) {
+            w.push_back(v[j]);
+        }
+        v = std::move(w);
+    }
+
+    // Renumber the CVs of a mechanism or ion, and restore increasing CV
+    // order in cv and in the per-entry fields given by the remaining
+    // arguments.
+    template <typename... Fields>
+    std::vector<fvm_index_type> renumber_cvs(
+        std::vector<fvm_index_type>& cv, const std::vector<fvm_index_type>& renumbering, Fields&... fields)
+    {
+        for (auto& i: cv) {
+            i = renumbering[i];
+        }
+
+        std::vector<fvm_index_type> order;
+        util::assign(order, count_along(cv));
+        util::stable_sort_by(order, [&cv](fvm_index_type i) { return cv[i]; });
+
+        apply_order(cv, order);
+        int expand[] = {(apply_order(fields, order), 0)...};
+        (void)expand;
+        return order;
+    }
+}
+
+void fvm_reorder_cvs(cv_ordering ordering, fvm_discretization& D, fvm_mechanism_data& M) {
+    using index_type = fvm_index_type;
+
+    if (ordering==cv_ordering::segment) return;
+
+    auto order = fvm_cv_order(ordering, D.parent_cv, D.cell_cv_bounds);
+
+    // renumbering[j] is the new index of CV j.
+    std::vector<index_type> renumbering(D.ncv);
+    for (auto i: count_along(order)) {
+        renumbering[order[i]] = i;
+    }
+
+    std::vector<index_type> parent_cv(D.ncv);
+    for (auto i: count_along(order)) {
+        parent_cv[i] = renumbering[D.parent_cv[order[i]]];
+    }
+    D.parent_cv = std::move(parent_cv);
+
+    apply_order(D.cv_to_cell, order);
+    apply_order(D.face_conductance, order);
+    apply_order(D.cv_area, order);
+    apply_order(D.cv_capacitance, order);
+    apply_order(D.init_membrane_potential, order);
+    apply_order(D.temperature_K, order);
+    apply_order(D.diam_um, order);
+
+    if (D.cv_renumbering.empty()) {
+        D.cv_renumbering = renumbering;
+    }
+    else {
+        for (auto& i: D.cv_renumbering) {
+            i = renumbering[i];
+        }
+    }
+
+    for (auto& entry: M.mechanisms) {
+        auto& config = entry.second;
+
+        // Targets are grouped by multiplicity for coalesced synapses.
+        bool coalesced = !config.multiplicity.empty();
+        std::vector<index_type> multiplicity_divs;
+        auto target_part = util::make_partition(multiplicity_divs, config.multiplicity);
+
+        auto entry_order = renumber_cvs(config.cv, renumbering, config.norm_area, config.multiplicity);
+        for (auto& pv: config.param_values) {
+            apply_order(pv.second, entry_order);
+        }
+
+        if (!coalesced) {
+            apply_order(config.target, entry_order);
+        }
+        else if (!config.target.empty()) {
+            std::vector<index_type> target;
+            target.reserve(config.target.size());
+            for (auto j: entry_order) {
+                util::append(target, util::subrange_view(config.target, target_part[j]));
+            }
+            config.target = std::move(target);
+        }
+    }
+
+    for (auto& entry: M.ions) {
+        auto& config = entry.second;
+        renumber_cvs(config.cv, renumbering, config.init_iconc, config.init_econc, config.init_revpot);
+    }
+}
+
 } // namespace arb
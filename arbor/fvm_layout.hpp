@@ -7,6 +7,7 @@
 #include <arbor/mechcat.hpp>
 #include <arbor/recipe.hpp>
 
+#include "backends/probe_reduction.hpp"
 #include "fvm_compartment.hpp"
 #include "util/span.hpp"
 
@@ -78,6 +79,15 @@ struct fvm_discretization {
     std::vector<size_type> cell_segment_bounds; // Partitions segment indices by cell.
     std::vector<index_type> cell_cv_bounds;      // Partitions CV indices by cell.
 
+    // CV indices in `segments` are in segment order. If the CVs have been
+    // renumbered by fvm_reorder_cvs, CV k in segment order is CV
+    // cv_renumbering[k]; otherwise cv_renumbering is empty.
+    std::vector<index_type> cv_renumbering;
+
+    index_type renumbered_cv(index_type k) const {
+        return cv_renumbering.empty()? k: cv_renumbering[k];
+    }
+
     auto cell_segment_part() const {
         return util::partition_view(cell_segment_bounds);
     }
@@ -91,12 +101,19 @@ struct fvm_discretization {
 
         size_type seg = loc.branch+cell_segs.first;
         arb_assert(seg<cell_segs.second);
-        return segments[seg].cv_by_position(loc.pos);
+        return renumbered_cv(segments[seg].cv_by_position(loc.pos));
     }
 };
 
+// Number of CVs in the discretization of a cell.
+fvm_size_type fvm_num_cvs(const cable_cell& cell);
+
 fvm_discretization fvm_discretize(const std::vector<cable_cell>& cells, const cable_cell_parameter_set& params);
 
+// CVs and CV area weights for a reduction probe on the cell with index cell_index.
+
+fvm_probe_reduction fvm_build_probe_reduction(const fvm_discretization& D, fvm_size_type cell_index, fvm_index_type intdom, const cell_probe_reduction& probe);
+
 
 // Post-discretization data for point and density mechanism instantiation.
 
@@ -138,6 +155,10 @@ struct fvm_ion_config {
 
     // Ion-specific (initial) reversal potential per CV.
     std::vector<value_type> init_revpot;
+
+    // Are the internal and external concentrations written by any mechanism?
+    bool iconc_written = false;
+    bool econc_written = false;
 };
 
 struct fvm_mechanism_data {
@@ -149,8 +170,25 @@ struct fvm_mechanism_data {
 
     // Total number of targets (point-mechanism points)
     std::size_t ntarget = 0;
+
+    // Groups of two or more density mechanisms, by name, that are present on
+    // exactly the same CVs; these can be applied in turn to blocks of CVs.
+    std::vector<std::vector<std::string>> colocated;
 };
 
+// Mechanism data must be built before the CVs are renumbered.
+
 fvm_mechanism_data fvm_build_mechanism_data(const cable_cell_global_properties& gprop, const std::vector<cable_cell>& cells, const fvm_discretization& D);
 
+// CV order for the given ordering of the CVs of each cell: position i of
+// the reordered CVs holds CV order[i]. Each cell keeps its range of CV
+// indices, with the root first and every CV after its parent.
+
+std::vector<fvm_index_type> fvm_cv_order(cv_ordering ordering, const std::vector<fvm_index_type>& parent_cv, const std::vector<fvm_index_type>& cell_cv_bounds);
+
+// Renumber the CVs in the discretization and mechanism data by ordering.
+// Mechanism and ion CVs are kept in increasing CV order.
+
+void fvm_reorder_cvs(cv_ordering ordering, fvm_discretization& D, fvm_mechanism_data& M);
+
 } // namespace arb
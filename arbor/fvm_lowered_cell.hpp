@@ -15,6 +15,12 @@
 
 namespace arb {
 
+// Staged events and samples are passed to the lowered cell as views onto
+// buffers owned (and reused across epochs) by the caller.
+
+using deliverable_event_span = util::range<const deliverable_event*>;
+using sample_event_span = util::range<const sample_event*>;
+
 struct fvm_integration_result {
     util::range<const threshold_crossing*> crossings;
     util::range<const fvm_value_type*> sample_time;
@@ -36,11 +42,23 @@ struct fvm_lowered_cell {
     virtual fvm_integration_result integrate(
         fvm_value_type tfinal,
         fvm_value_type max_dt,
-        std::vector<deliverable_event> staged_events,
-        std::vector<sample_event> staged_samples) = 0;
+        deliverable_event_span staged_events,
+        sample_event_span staged_samples) = 0;
 
     virtual fvm_value_type time() const = 0;
 
+    // Gap junctions of the cells with cells outside the group, with the
+    // local site on this group, in the order their peer voltages are
+    // imported.
+    virtual const std::vector<gap_junction_connection>& halo_junctions() const = 0;
+
+    // Append the voltage at the local site of each halo junction [mV]: one
+    // value per site, in order of first appearance in halo_junctions().
+    virtual void export_halo(std::vector<fvm_value_type>& values) const = 0;
+
+    // Set the peer voltage of each halo junction [mV].
+    virtual void import_halo(const std::vector<fvm_value_type>& values) = 0;
+
     virtual ~fvm_lowered_cell() {}
 };
 
@@ -0,0 +1,273 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
+#include <arbor/cable_cell.hpp>
+#include <arbor/cable_cell_param.hpp>
+#include <arbor/common_types.hpp>
+#include <arbor/recipe.hpp>
+#include <arbor/util/any.hpp>
+
+#include "backends/multicore/fvm.hpp"
+#include "fvm_layout.hpp"
+#include "fvm_lowered_cell_blocked.hpp"
+#include "fvm_lowered_cell_impl.hpp"
+#include "hardware/memory.hpp"
+#include "util/partition.hpp"
+#include "util/range.hpp"
+#include "util/rangeutil.hpp"
+#include "util/span.hpp"
+
+namespace arb {
+
+using impl_type = fvm_lowered_cell_impl<multicore::backend>;
+
+std::vector<fvm_size_type> fvm_integration_blocks(
+    const std::vector<fvm_index_type>& cell_to_intdom,
+    const std::vector<fvm_size_type>& cell_cvs,
+    fvm_size_type max_cvs)
+{
+    const auto n = cell_to_intdom.size();
+    arb_assert(cell_cvs.size()==n);
+
+    // A block may end after cell i only if no integration domain has cells
+    // on both sides: the largest domain index up to i is smaller than the
+    // smallest after i.
+    std::vector<fvm_index_type> suffix_min(n+1, std::numeric_limits<fvm_index_type>::max());
+    for (auto i = n; i-->0; ) {
+        suffix_min[i] = std::min(suffix_min[i+1], cell_to_intdom[i]);
+    }
+
+    // Cells are taken in runs that can be cut from the rest, and a new
+    // block is started before a run that would overfill the current one.
+    std::vector<fvm_size_type> divs = {0};
+    fvm_index_type prefix_max = 0;
+    fvm_size_type run_begin = 0;
+    fvm_size_type run_cvs = 0;
+    fvm_size_type block_cvs = 0;
+    for (auto i: util::make_span(n)) {
+        prefix_max = std::max(prefix_max, cell_to_intdom[i]);
+        run_cvs += cell_cvs[i];
+
+        if (prefix_max<suffix_min[i+1]) {
+            if (block_cvs && block_cvs+run_cvs>max_cvs) {
+                divs.push_back(run_begin);
+                block_cvs = 0;
+            }
+            block_cvs += run_cvs;
+            run_begin = i+1;
+            run_cvs = 0;
+        }
+    }
+    if (n) {
+        divs.push_back(n);
+    }
+    return divs;
+}
+
+
+namespace {
+// Gather the events of an epoch by block, stably, with the integration
+// domain of each event made local to its block. The partition of the
+// gathered events by block is written to divs; pos is scratch space.
+template <typename Event, typename Index>
+void gather_by_block(
+    std::vector<Event>& out,
+    std::vector<fvm_size_type>& divs,
+    std::vector<fvm_size_type>& pos,
+    util::range<const Event*> events,
+    const std::vector<fvm_size_type>& intdom_to_block,
+    const std::vector<fvm_index_type>& block_intdom_base,
+    Index index)
+{
+    divs.assign(block_intdom_base.size()+1, 0);
+    for (const auto& ev: events) {
+        ++divs[intdom_to_block[index(ev)]+1];
+    }
+    std::partial_sum(divs.begin(), divs.end(), divs.begin());
+
+    pos.assign(divs.begin(), divs.end()-1);
+    out.resize(events.size());
+    for (const auto& ev: events) {
+        auto b = intdom_to_block[index(ev)];
+        auto& e = out[pos[b]++] = ev;
+        index(e) -= block_intdom_base[b];
+    }
+}
+} // anonymous namespace
+
+void fvm_lowered_cell_blocked::reset() {
+    for (auto& b: blocks_) {
+        b.cell->reset();
+    }
+}
+
+fvm_value_type fvm_lowered_cell_blocked::time() const {
+    return blocks_.empty()? 0: blocks_.front().cell->time();
+}
+
+void fvm_lowered_cell_blocked::export_halo(std::vector<fvm_value_type>& values) const {
+    for (auto& b: blocks_) {
+        b.cell->export_halo(values);
+    }
+}
+
+void fvm_lowered_cell_blocked::import_halo(const std::vector<fvm_value_type>& values) {
+    if (blocks_.size()==1) {
+        blocks_.front().cell->import_halo(values);
+        return;
+    }
+
+    for (auto i: util::count_along(blocks_)) {
+        halo_values_.assign(values.begin()+halo_divs_[i], values.begin()+halo_divs_[i+1]);
+        blocks_[i].cell->import_halo(halo_values_);
+    }
+}
+
+void fvm_lowered_cell_blocked::initialize(
+    const std::vector<cell_gid_type>& gids,
+    const recipe& rec,
+    std::vector<fvm_index_type>& cell_to_intdom,
+    std::vector<target_handle>& target_handles,
+    probe_association_map<probe_handle>& probe_map)
+{
+    blocks_.clear();
+    block_intdom_base_.clear();
+    intdom_to_block_.clear();
+    halo_junctions_.clear();
+    halo_divs_.assign(1, 0);
+
+    // Bad global properties are reported by the lowered cells of the blocks.
+    cable_cell_global_properties global_props;
+    util::any rec_props = rec.get_global_properties(cell_kind::cable);
+    if (auto p = util::any_cast<cable_cell_global_properties>(&rec_props)) {
+        global_props = *p;
+    }
+
+    if (!global_props.blocked_integration || gids.size()<2) {
+        blocks_.push_back({fvm_lowered_cell_ptr(new impl_type(context_)), 0});
+        blocks_.front().cell->initialize(gids, rec, cell_to_intdom, target_handles, probe_map);
+        halo_junctions_ = blocks_.front().cell->halo_junctions();
+        halo_divs_.push_back(halo_junctions_.size());
+        return;
+    }
+
+    std::vector<fvm_index_type> group_intdom;
+    impl_type::fvm_intdom(rec, gids, group_intdom);
+
+    std::vector<fvm_size_type> cell_cvs;
+    cell_cvs.reserve(gids.size());
+    for (auto gid: gids) {
+        try {
+            cell_cvs.push_back(fvm_num_cvs(util::any_cast<const cable_cell&>(rec.get_cell_description(gid))));
+        }
+        catch (util::bad_any_cast&) {
+            throw bad_cell_description(rec.get_cell_kind(gid), gid);
+        }
+    }
+
+    fvm_size_type max_cvs = global_props.integration_block_cvs;
+    if (!max_cvs) {
+        auto cache_size = hw::l2_cache_size();
+        max_cvs = (cache_size>0? cache_size: default_cache_size)/cv_state_size;
+    }
+
+    cell_to_intdom.clear();
+    target_handles.clear();
+
+    fvm_index_type intdom_base = 0;
+    fvm_size_type source_base = 0;
+    auto block_divs = fvm_integration_blocks(group_intdom, cell_cvs, max_cvs);
+    for (auto cells: util::partition_view(block_divs)) {
+        std::vector<cell_gid_type> block_gids(gids.begin()+cells.first, gids.begin()+cells.second);
+        std::vector<fvm_index_type> block_intdom;
+        std::vector<target_handle> block_targets;
+
+        fvm_lowered_cell_ptr cell(new impl_type(context_));
+        cell->initialize(block_gids, rec, block_intdom, block_targets, probe_map);
+
+        for (auto i: block_intdom) {
+            cell_to_intdom.push_back(intdom_base+i);
+        }
+        for (auto h: block_targets) {
+            h.intdom_index += intdom_base;
+            target_handles.push_back(h);
+        }
+
+        fvm_index_type n_intdom = block_intdom.empty()? 0: util::max_value(block_intdom)+1;
+        intdom_to_block_.insert(intdom_to_block_.end(), n_intdom, blocks_.size());
+        blocks_.push_back({std::move(cell), source_base});
+        block_intdom_base_.push_back(intdom_base);
+
+        util::append(halo_junctions_, blocks_.back().cell->halo_junctions());
+        halo_divs_.push_back(halo_junctions_.size());
+
+        intdom_base += n_intdom;
+        for (auto gid: block_gids) {
+            source_base += rec.num_sources(gid);
+        }
+    }
+}
+
+fvm_integration_result fvm_lowered_cell_blocked::integrate(
+    fvm_value_type tfinal,
+    fvm_value_type dt_max,
+    deliverable_event_span staged_events,
+    sample_event_span staged_samples)
+{
+    if (blocks_.size()==1) {
+        return blocks_.front().cell->integrate(tfinal, dt_max, staged_events, staged_samples);
+    }
+
+    gather_by_block(events_, event_divs_, gather_pos_, staged_events, intdom_to_block_, block_intdom_base_,
+        [](auto& ev) -> auto& { return ev.handle.intdom_index; });
+    gather_by_block(samples_, sample_divs_, gather_pos_, staged_samples, intdom_to_block_, block_intdom_base_,
+        [](auto& ev) -> auto& { return ev.cell_index; });
+
+    sample_size_type n_samples = 0;
+    sample_size_type n_values = 0;
+    for (const auto& ev: staged_samples) {
+        n_samples = std::max(n_samples, ev.raw.offset+1);
+        n_values = std::max(n_values, ev.raw.value_offset+ev.raw.width);
+    }
+    if (sample_time_.size()<(std::size_t)n_samples) {
+        sample_time_.resize(n_samples);
+    }
+    if (sample_value_.size()<(std::size_t)n_values) {
+        sample_value_.resize(n_values);
+    }
+
+    // Each block keeps the sample offsets of its events: copy its sample
+    // times and values to the same offsets of the group buffers.
+    crossings_.clear();
+    for (auto i: util::count_along(blocks_)) {
+        auto& b = blocks_[i];
+        auto block_samples = util::make_range(samples_.data()+sample_divs_[i], samples_.data()+sample_divs_[i+1]);
+
+        auto result = b.cell->integrate(tfinal, dt_max,
+            util::make_range(events_.data()+event_divs_[i], events_.data()+event_divs_[i+1]),
+            block_samples);
+
+        for (auto c: result.crossings) {
+            c.index += b.source_base;
+            crossings_.push_back(c);
+        }
+        for (const auto& ev: block_samples) {
+            sample_time_[ev.raw.offset] = result.sample_time[ev.raw.offset];
+            for (auto k: util::make_span(ev.raw.value_offset, ev.raw.value_offset+ev.raw.width)) {
+                sample_value_[k] = result.sample_value[k];
+            }
+        }
+    }
+
+    return fvm_integration_result{
+        util::range_pointer_view(crossings_),
+        util::range_pointer_view(sample_time_),
+        util::range_pointer_view(sample_value_)
+    };
+}
+
+} // namespace arb
@@ -0,0 +1,110 @@
+#pragma once
+
+// Lowered cell for the multicore back end that integrates the cells of a
+// group in blocks.
+//
+// With cable_cell_global_properties::blocked_integration set, the cells of
+// the group are split into blocks of whole integration domains, each
+// small enough that its cell state fits in the L2 cache. Every block has
+// its own lowered cell, with its own shared state, matrix and mechanism
+// instances, and is advanced through the whole epoch before the next, so
+// that its state is read from memory once per epoch rather than once per
+// step. Threshold crossings are reported block by block, so within an
+// epoch they are not in time order.
+
+#include <vector>
+
+#include <arbor/common_types.hpp>
+#include <arbor/fvm_types.hpp>
+#include <arbor/recipe.hpp>
+
+#include "backends/event.hpp"
+#include "backends/threshold_crossing.hpp"
+#include "execution_context.hpp"
+#include "fvm_lowered_cell.hpp"
+#include "sampler_map.hpp"
+
+namespace arb {
+
+// Partition the cells of a group into blocks of contiguous cells with at
+// most max_cvs CVs each, given the number of CVs of each cell and its
+// integration domain. Cells of an integration domain are never split
+// across blocks: a block may exceed max_cvs if a single domain does.
+// Returns the partition divisions of the cells by block.
+std::vector<fvm_size_type> fvm_integration_blocks(
+    const std::vector<fvm_index_type>& cell_to_intdom,
+    const std::vector<fvm_size_type>& cell_cvs,
+    fvm_size_type max_cvs);
+
+class fvm_lowered_cell_blocked: public fvm_lowered_cell {
+public:
+    // Estimate of the state per CV touched in an integration step [bytes]:
+    // voltage, currents and ion state, the matrix, and the state of a few
+    // density mechanisms.
+    static constexpr std::size_t cv_state_size = 512;
+
+    // L2 cache size assumed if it can not be queried [bytes].
+    static constexpr std::size_t default_cache_size = 512*1024;
+
+    fvm_lowered_cell_blocked(const execution_context& ctx): context_(ctx) {}
+
+    void reset() override;
+
+    void initialize(
+        const std::vector<cell_gid_type>& gids,
+        const recipe& rec,
+        std::vector<fvm_index_type>& cell_to_intdom,
+        std::vector<target_handle>& target_handles,
+        probe_association_map<probe_handle>& probe_map) override;
+
+    fvm_integration_result integrate(
+        fvm_value_type tfinal,
+        fvm_value_type max_dt,
+        deliverable_event_span staged_events,
+        sample_event_span staged_samples) override;
+
+    fvm_value_type time() const override;
+
+    const std::vector<gap_junction_connection>& halo_junctions() const override {
+        return halo_junctions_;
+    }
+
+    void export_halo(std::vector<fvm_value_type>& values) const override;
+
+    void import_halo(const std::vector<fvm_value_type>& values) override;
+
+    std::size_t num_blocks() const { return blocks_.size(); }
+
+private:
+    struct block {
+        fvm_lowered_cell_ptr cell;
+        fvm_size_type source_base;  // index of the first spike source of the block
+    };
+
+    execution_context context_;
+    std::vector<block> blocks_;
+
+    // Index of the first integration domain of each block, and the block
+    // of each integration domain of the group.
+    std::vector<fvm_index_type> block_intdom_base_;
+    std::vector<fvm_size_type> intdom_to_block_;
+
+    // Events, samples and results of the epoch, gathered by block; reused
+    // across epochs.
+    std::vector<deliverable_event> events_;
+    std::vector<fvm_size_type> event_divs_;
+    std::vector<sample_event> samples_;
+    std::vector<fvm_size_type> sample_divs_;
+    std::vector<fvm_size_type> gather_pos_;
+    std::vector<threshold_crossing> crossings_;
+    std::vector<fvm_value_type> sample_time_;
+    std::vector<fvm_value_type> sample_value_;
+
+    // Halo junctions of the blocks, in block order, partitioned by block;
+    // the peer voltages of a block are copied to halo_values_ for import.
+    std::vector<gap_junction_connection> halo_junctions_;
+    std::vector<fvm_size_type> halo_divs_;
+    std::vector<fvm_value_type> halo_values_;
+};
+
+} // namespace arb
@@ -8,6 +8,7 @@
 #ifdef ARB_HAVE_GPU
 #include "backends/gpu/fvm.hpp"
 #endif
+#include "fvm_lowered_cell_blocked.hpp"
 #include "fvm_lowered_cell_impl.hpp"
 
 namespace arb {
@@ -15,7 +16,7 @@ namespace arb {
 fvm_lowered_cell_ptr make_fvm_lowered_cell(backend_kind p, const execution_context& ctx) {
     switch (p) {
     case backend_kind::multicore:
-        return fvm_lowered_cell_ptr(new fvm_lowered_cell_impl<multicore::backend>(ctx));
+        return fvm_lowered_cell_ptr(new fvm_lowered_cell_blocked(ctx));
     case backend_kind::gpu:
 #ifdef ARB_HAVE_GPU
         return fvm_lowered_cell_ptr(new fvm_lowered_cell_impl<gpu::backend>(ctx));
@@ -7,11 +7,14 @@
 // implementation details may be tested in the unit tests.
 // It should otherwise only be used in `fvm_lowered_cell.cpp`.
 
+#include <algorithm>
 #include <cmath>
 #include <iterator>
 #include <memory>
 #include <queue>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <unordered_set>
@@ -30,6 +33,7 @@
 #include "sampler_map.hpp"
 #include "util/maputil.hpp"
 #include "util/meta.hpp"
+#include "util/partition.hpp"
 #include "util/range.hpp"
 #include "util/rangeutil.hpp"
 #include "util/strprintf.hpp"
@@ -59,29 +63,48 @@ public:
     fvm_integration_result integrate(
         value_type tfinal,
         value_type max_dt,
-        std::vector<deliverable_event> staged_events,
-        std::vector<sample_event> staged_samples) override;
+        deliverable_event_span staged_events,
+        sample_event_span staged_samples) override;
 
+    // Returns the gap junctions between cells of the group. Junctions with
+    // peers outside the group are kept as halo junctions instead: see
+    // halo_junctions().
     std::vector<fvm_gap_junction> fvm_gap_junctions(
         const std::vector<cable_cell>& cells,
         const std::vector<cell_gid_type>& gids,
         const recipe& rec,
         const fvm_discretization& D);
 
-    // Generates indom index for every gid, guarantees that gids belonging to the same supercell are in the same intdom
+    // Generates indom index for every gid, guarantees that gids of the group connected by gap junctions are in the same intdom
     // Fills cell_to_intdom map; returns number of intdoms
-    fvm_size_type fvm_intdom(
+    static fvm_size_type fvm_intdom(
         const recipe& rec,
         const std::vector<cell_gid_type>& gids,
         std::vector<fvm_index_type>& cell_to_intdom);
 
     value_type time() const override { return tmin_; }
 
+    const std::vector<gap_junction_connection>& halo_junctions() const override {
+        return halo_junctions_;
+    }
+
+    void export_halo(std::vector<fvm_value_type>& values) const override {
+        state_->export_gj_halo(values);
+    }
+
+    void import_halo(const std::vector<fvm_value_type>& values) override {
+        state_->import_gj_halo(values);
+    }
+
     //Exposed for testing purposes
     std::vector<mechanism_ptr>& mechanisms() {
         return mechanisms_;
     }
 
+    const std::vector<std::vector<unsigned>>& mechanism_groups() const {
+        return mechanism_groups_;
+    }
+
 private:
     // Host or GPU-side back-end dependent storage.
     using array = typename backend::array;
@@ -104,15 +127,41 @@ private:
     std::vector<mechanism_ptr> mechanisms_; // excludes reversal potential calculators.
     std::vector<mechanism_ptr> revpot_mechanisms_;
 
+    // Indices into mechanisms_, grouped in the order in which the mechanisms
+    // are applied. A group of more than one mechanism comprises colocated
+    // density mechanisms, which are applied in turn to each block of
+    // colocated_block instances.
+    std::vector<std::vector<unsigned>> mechanism_groups_;
+    static constexpr fvm_size_type colocated_block = 512;
+
     // Non-physical voltage check threshold, 0 => no check.
     value_type check_voltage_mV = 0;
 
+    // Integration domains take adaptive time steps.
+    bool adaptive_dt_ = false;
+
+    // Voltage is integrated with the Crank–Nicolson scheme.
+    bool crank_nicolson_ = false;
+
+    // Gap junctions with peers outside the group, as given by the recipe
+    // with the local site first, and as lowered: with the index of the halo
+    // junction in place of the peer CV. The local sites of the halo
+    // junctions are exported at export_cv_, in order of first appearance.
+    std::vector<gap_junction_connection> halo_junctions_;
+    std::vector<fvm_gap_junction> halo_gj_;
+    std::vector<fvm_index_type> export_cv_;
+
     // Host-side views/copies and local state.
     decltype(backend::host_view(sample_time_)) sample_time_host_;
     decltype(backend::host_view(sample_value_)) sample_value_host_;
 
     void update_ion_state();
 
+    // Apply f to each mechanism in the group, block by block for colocated
+    // density mechanisms.
+    template <typename F>
+    void apply_mechanisms(const std::vector<unsigned>& group, F&& f);
+
     // Throw if absolute value of membrane voltage exceeds bounds.
     void assert_voltage_bounded(fvm_value_type bound);
 
@@ -125,8 +174,11 @@ private:
         arb_assert((assert_tmin(), true));
     }
 
+    // Number of steps of at most dt from t0 to t1. An interval of a whole
+    // number of steps, as with the halo sub-epochs of one step each, takes
+    // no extra step of zero length.
     static unsigned dt_steps(value_type t0, value_type t1, value_type dt) {
-        return t0>=t1? 0: 1+(unsigned)((t1-t0)/dt);
+        return t0>=t1? 0: (unsigned)std::ceil((t1-t0)/dt);
     }
 
     // Sets the GPU used for CUDA calls from the thread that calls it.
@@ -138,6 +190,29 @@ private:
     }
 };
 
+template <typename Backend>
+template <typename F>
+void fvm_lowered_cell_impl<Backend>::apply_mechanisms(const std::vector<unsigned>& group, F&& f) {
+    if (group.size()==1) {
+        f(*mechanisms_[group.front()]);
+        return;
+    }
+
+    fvm_size_type n = mechanisms_[group.front()]->size();
+    fvm_size_type block = colocated_block;
+    for (fvm_size_type begin = 0; begin<n; begin += block) {
+        fvm_size_type end = std::min(n, begin+block);
+        for (auto i: group) {
+            mechanisms_[i]->set_instance_range(begin, end);
+            f(*mechanisms_[i]);
+        }
+    }
+
+    for (auto i: group) {
+        mechanisms_[i]->set_instance_range(0, n);
+    }
+}
+
 template <typename Backend>
 void fvm_lowered_cell_impl<Backend>::assert_tmin() {
     auto time_minmax = state_->time_bounds();
@@ -173,8 +248,8 @@ template <typename Backend>
 fvm_integration_result fvm_lowered_cell_impl<Backend>::integrate(
     value_type tfinal,
     value_type dt_max,
-    std::vector<deliverable_event> staged_events,
-    std::vector<sample_event> staged_samples)
+    deliverable_event_span staged_events,
+    sample_event_span staged_samples)
 {
     using util::as_const;
 
@@ -184,14 +259,24 @@ fvm_integration_result fvm_lowered_cell_impl<Backend>::integrate(
     PE(advance_integrate_setup);
     threshold_watcher_.clear_crossings();
 
-    auto n_samples = staged_samples.size();
+    // Sample offsets need not be contiguous from zero: size the buffers by
+    // the largest offsets.
+    sample_size_type n_samples = 0;
+    sample_size_type n_values = 0;
+    for (const auto& ev: staged_samples) {
+        n_samples = std::max(n_samples, ev.raw.offset+1);
+        n_values = std::max(n_values, ev.raw.value_offset+ev.raw.width);
+    }
+
     if (sample_time_.size() < n_samples) {
         sample_time_ = array(n_samples);
-        sample_value_ = array(n_samples);
+    }
+    if (sample_value_.size() < (std::size_t)n_values) {
+        sample_value_ = array(n_values);
     }
 
-    state_->deliverable_events.init(std::move(staged_events));
-    sample_events_.init(std::move(staged_samples));
+    state_->deliverable_events.init(staged_events);
+    sample_events_.init(staged_samples);
 
     arb_assert((assert_tmin(), true));
     unsigned remaining_steps = dt_steps(tmin_, tfinal, dt_max);
@@ -220,46 +305,76 @@ fvm_integration_result fvm_lowered_cell_impl<Backend>::integrate(
         PE(advance_integrate_current_zero);
         state_->zero_currents();
         PL();
-        for (auto& m: mechanisms_) {
-            m->deliver_events();
-            m->nrn_current();
+        for (auto& group: mechanism_groups_) {
+            for (auto i: group) {
+                mechanisms_[i]->deliver_events();
+            }
+            apply_mechanisms(group, [](mechanism& m) { m.nrn_current(); });
         }
 
         // Add current contribution from gap_junctions
+
+        PE(advance_integrate_current_gj);
         state_->add_gj_current();
+        PL();
+
+        // Update event list and integration step times. With adaptive
+        // steps, dt_max is the smallest step.
 
         PE(advance_integrate_events);
+        if (adaptive_dt_) {
+            state_->update_time_to_adaptive(dt_max, tfinal);
+        }
+        else {
+            state_->update_time_to(dt_max, tfinal);
+        }
         state_->deliverable_events.drop_marked_events();
-
-        // Update event list and integration step times.
-
-        state_->update_time_to(dt_max, tfinal);
         state_->deliverable_events.event_time_if_before(state_->time_to);
-        state_->set_dt();
         PL();
 
         // Take samples at cell time if sample time in this step interval.
+        // Adaptive steps instead end at sample times, so that samples are
+        // taken at the time requested.
 
         PE(advance_integrate_samples);
-        sample_events_.mark_until(state_->time_to);
-        state_->take_samples(sample_events_.marked_events(), sample_time_, sample_value_);
-        sample_events_.drop_marked_events();
+        if (adaptive_dt_) {
+            sample_events_.mark_until_after(state_->time);
+            state_->take_samples(sample_events_.marked_events(), sample_time_, sample_value_);
+            sample_events_.drop_marked_events();
+            sample_events_.event_time_if_before(state_->time_to);
+        }
+        else {
+            sample_events_.mark_until(state_->time_to);
+            state_->take_samples(sample_events_.marked_events(), sample_time_, sample_value_);
+            sample_events_.drop_marked_events();
+        }
+        PL();
+
+        PE(advance_integrate_events);
+        state_->set_dt();
         PL();
 
-        // Integrate voltage by matrix solve.
+        // Integrate voltage by matrix solve. For the Crank–Nicolson scheme
+        // the matrix is assembled over half the step (see initialize()), and
+        // the solution at the midpoint extrapolated to the end of the step.
 
         PE(advance_integrate_matrix_build);
         matrix_.assemble(state_->dt_intdom, state_->voltage, state_->current_density, state_->conductivity);
         PL();
         PE(advance_integrate_matrix_solve);
-        matrix_.solve();
-        memory::copy(matrix_.solution(), state_->voltage);
+        if (crank_nicolson_) {
+            matrix_.solve(state_->voltage_half);
+            state_->extrapolate_voltage();
+        }
+        else {
+            matrix_.solve(state_->voltage);
+        }
         PL();
 
         // Integrate mechanism state.
 
-        for (auto& m: mechanisms_) {
-            m->nrn_state();
+        for (auto& group: mechanism_groups_) {
+            apply_mechanisms(group, [](mechanism& m) { m.nrn_state(); });
         }
 
         // Update ion concentrations.
@@ -275,6 +390,14 @@ fvm_integration_result fvm_lowered_cell_impl<Backend>::integrate(
         memory::copy(state_->time_to, state_->time);
         PL();
 
+        // Choose the size of the next step.
+
+        if (adaptive_dt_) {
+            PE(advance_integrate_stepsize);
+            state_->update_dt_step(dt_max);
+            PL();
+        }
+
         // Check for non-physical solutions:
 
         if (check_voltage_mV>0) {
@@ -286,7 +409,7 @@ fvm_integration_result fvm_lowered_cell_impl<Backend>::integrate(
         // Check for end of integration.
 
         PE(advance_integrate_stepsupdate);
-        if (!--remaining_steps) {
+        if (!--remaining_steps || adaptive_dt_) {
             tmin_ = state_->time_bounds().first;
             remaining_steps = dt_steps(tmin_, tfinal, dt_max);
         }
@@ -385,21 +508,31 @@ void fvm_lowered_cell_impl<B>::initialize(
 
     auto num_intdoms = fvm_intdom(rec, gids, cell_to_intdom);
 
-    // Discretize cells, build matrix.
+    // Discretize cells and mechanism data, and renumber CVs.
 
     fvm_discretization D = fvm_discretize(cells, global_props.default_parameters);
+    fvm_mechanism_data mech_data = fvm_build_mechanism_data(global_props,  cells, D);
+    fvm_reorder_cvs(global_props.cv_order, D, mech_data);
+
+    // Build matrix.
 
     std::vector<index_type> cv_to_intdom(D.ncv);
     std::transform(D.cv_to_cell.begin(), D.cv_to_cell.end(), cv_to_intdom.begin(),
                    [&cell_to_intdom](index_type i){ return cell_to_intdom[i]; });
 
-    arb_assert(D.ncell == ncell);
-    matrix_ = matrix<backend>(D.parent_cv, D.cell_cv_bounds, D.cv_capacitance, D.face_conductance, D.cv_area, cell_to_intdom);
-    sample_events_ = sample_event_stream(num_intdoms);
+    // A backward Euler step over dt/2 is assembled as one over dt with
+    // twice the capacitance.
 
-    // Discretize mechanism data.
+    crank_nicolson_ = global_props.voltage_scheme==voltage_integration::crank_nicolson;
+    if (crank_nicolson_) {
+        for (auto& c: D.cv_capacitance) {
+            c *= 2;
+        }
+    }
 
-    fvm_mechanism_data mech_data = fvm_build_mechanism_data(global_props,  cells, D);
+    arb_assert(D.ncell == ncell);
+    matrix_ = matrix<backend>(D.parent_cv, D.cell_cv_bounds, D.cv_capacitance, D.face_conductance, D.cv_area, cell_to_intdom, context_);
+    sample_events_ = sample_event_stream(num_intdoms);
 
     // Discretize and build gap junction info.
 
@@ -416,13 +549,47 @@ void fvm_lowered_cell_impl<B>::initialize(
                 num_intdoms, cv_to_intdom, gj_vector, D.init_membrane_potential, D.temperature_K, D.diam_um,
                 data_alignment? data_alignment: 1u);
 
+    if (crank_nicolson_) {
+        state_->configure_crank_nicolson();
+    }
+
+    if (!halo_gj_.empty()) {
+        state_->configure_gj_halo(halo_gj_, export_cv_);
+    }
+
+    adaptive_dt_ = global_props.adaptive_dt;
+    if (adaptive_dt_) {
+        // Adaptive steps end where stimuli are switched on or off.
+        std::vector<std::vector<value_type>> intdom_breakpoints(num_intdoms);
+        for (auto cell_idx: make_span(ncell)) {
+            auto& bp = intdom_breakpoints[cell_to_intdom[cell_idx]];
+            for (const auto& stim: cells[cell_idx].stimuli()) {
+                bp.push_back(stim.clamp.delay);
+                bp.push_back(stim.clamp.delay+stim.clamp.duration);
+            }
+        }
+
+        std::vector<index_type> breakpoint_divs;
+        std::vector<value_type> breakpoints;
+        for (auto& bp: intdom_breakpoints) {
+            util::sort(bp);
+            breakpoints.insert(breakpoints.end(), bp.begin(), bp.end());
+        }
+        util::make_partition(breakpoint_divs,
+            util::transform_view(intdom_breakpoints, [](const std::vector<value_type>& bp) { return bp.size(); }));
+
+        state_->configure_adaptive_dt(global_props.adaptive_dt_tolerance, global_props.adaptive_dt_max,
+            breakpoint_divs, breakpoints);
+    }
+
     // Instantiate mechanisms and ions.
 
     for (auto& i: mech_data.ions) {
         const std::string& ion_name = i.first;
 
         if (auto charge = value_by_key(global_props.ion_species, ion_name)) {
-            state_->add_ion(ion_name, *charge, i.second.cv, i.second.init_iconc, i.second.init_econc, i.second.init_revpot);
+            state_->add_ion(ion_name, *charge, i.second.cv, i.second.init_iconc, i.second.init_econc, i.second.init_revpot,
+                i.second.iconc_written, i.second.econc_written);
         }
         else {
             throw cable_cell_error("unrecognized ion '"+ion_name+"' in mechanism");
@@ -432,6 +599,7 @@ void fvm_lowered_cell_impl<B>::initialize(
     target_handles.resize(mech_data.ntarget);
 
     unsigned mech_id = 0;
+    std::unordered_map<std::string, unsigned> mechanism_index;
     for (auto& m: mech_data.mechanisms) {
         auto& name = m.first;
         auto& config = m.second;
@@ -456,18 +624,6 @@ void fvm_lowered_cell_impl<B>::initialize(
             for (auto i: count_along(config.cv)) {
                 auto cv = layout.cv[i];
                 layout.weight[i] = 1000/D.cv_area[cv];
-
-                // (builtin stimulus, for example, has no targets)
-
-                if (!config.target.empty()) {
-                    if(!config.multiplicity.empty()) {
-                        for (auto j: make_span(multiplicity_part[i])) {
-                            target_handles[config.target[j]] = target_handle(mech_id, i, cv_to_intdom[cv]);
-                        }
-                    } else {
-                        target_handles[config.target[i]] = target_handle(mech_id, i, cv_to_intdom[cv]);
-                    };
-                }
             }
             break;
         case mechanismKind::density:
@@ -484,7 +640,29 @@ void fvm_lowered_cell_impl<B>::initialize(
         }
 
         auto minst = mech_instance(name);
-        minst.mech->instantiate(mech_id++, *state_, minst.overrides, layout);
+        minst.mech->instantiate(mech_id, *state_, minst.overrides, layout);
+
+        // Target handles refer to the index at which the instance is stored,
+        // which may differ from the layout order for point mechanisms.
+        // (builtin stimulus, for example, has no targets)
+
+        if (config.kind==mechanismKind::point && !config.target.empty()) {
+            auto instance_index = minst.mech->instance_index();
+
+            for (auto i: count_along(config.cv)) {
+                auto cv = layout.cv[i];
+                fvm_size_type index = instance_index.empty()? i: instance_index[i];
+
+                if(!config.multiplicity.empty()) {
+                    for (auto j: make_span(multiplicity_part[i])) {
+                        target_handles[config.target[j]] = target_handle(mech_id, index, cv_to_intdom[cv]);
+                    }
+                } else {
+                    target_handles[config.target[i]] = target_handle(mech_id, index, cv_to_intdom[cv]);
+                };
+            }
+        }
+        ++mech_id;
 
         for (auto& pv: config.param_values) {
             minst.mech->set_parameter(pv.first, pv.second);
@@ -494,15 +672,54 @@ void fvm_lowered_cell_impl<B>::initialize(
             revpot_mechanisms_.push_back(mechanism_ptr(minst.mech.release()));
         }
         else {
+            mechanism_index[name] = mechanisms_.size();
             mechanisms_.push_back(mechanism_ptr(minst.mech.release()));
         }
     }
 
+    // Group colocated density mechanisms if they are wider than a block, and
+    // if the implementations can be restricted to blocks of that size.
+
+    std::vector<int> group_of(mechanisms_.size(), -1);
+    std::vector<std::vector<unsigned>> colocated;
+    for (auto& names: mech_data.colocated) {
+        std::vector<unsigned> group;
+        for (auto& name: names) {
+            auto i = mechanism_index.at(name);
+            auto granularity = mechanisms_[i]->instance_block();
+            if (granularity && colocated_block%granularity==0) {
+                group.push_back(i);
+            }
+        }
+
+        if (group.size()>1 && mechanisms_[group.front()]->size()>colocated_block) {
+            util::sort(group);
+            for (auto i: group) {
+                group_of[i] = colocated.size();
+            }
+            colocated.push_back(std::move(group));
+        }
+    }
+
+    mechanism_groups_.clear();
+    for (auto i: count_along(mechanisms_)) {
+        if (group_of[i]<0) {
+            mechanism_groups_.push_back({unsigned(i)});
+        }
+        else if (colocated[group_of[i]].front()==i) {
+            mechanism_groups_.push_back(colocated[group_of[i]]);
+        }
+    }
+
     // Collect detectors, probe handles.
 
     std::vector<index_type> detector_cv;
     std::vector<value_type> detector_threshold;
 
+    // Reduction probes are configured after all probes have been collected.
+    std::vector<fvm_probe_reduction> reductions;
+    std::vector<probe_info> reduction_probes;
+
     for (auto cell_idx: make_span(ncell)) {
         cell_gid_type gid = gids[cell_idx];
 
@@ -513,6 +730,19 @@ void fvm_lowered_cell_impl<B>::initialize(
 
         for (cell_lid_type j: make_span(rec.num_probes(gid))) {
             probe_info pi = rec.get_probe({gid, j});
+
+            if (auto red = any_cast<cell_probe_reduction>(&pi.address)) {
+                if (red->reduction==cell_probe_reduction::histogram &&
+                    (red->bin_edges.size()<2 || !std::is_sorted(red->bin_edges.begin(), red->bin_edges.end())))
+                {
+                    throw bad_probe_reduction(pi.id);
+                }
+
+                reductions.push_back(fvm_build_probe_reduction(D, cell_idx, cell_to_intdom[cell_idx], *red));
+                reduction_probes.push_back(std::move(pi));
+                continue;
+            }
+
             auto where = any_cast<cell_probe_address>(pi.address);
 
             auto cv = D.branch_location_cv(cell_idx, where.location);
@@ -533,6 +763,12 @@ void fvm_lowered_cell_impl<B>::initialize(
         }
     }
 
+    auto reduction_handles = state_->configure_reductions(reductions);
+    for (auto i: count_along(reduction_probes)) {
+        const auto& pi = reduction_probes[i];
+        probe_map.insert({pi.id, {reduction_handles[i], pi.tag, (sample_size_type)reductions[i].width()}});
+    }
+
     threshold_watcher_ = backend::voltage_watcher(*state_, detector_cv, detector_threshold, context_);
 
     reset();
@@ -561,22 +797,47 @@ std::vector<fvm_gap_junction> fvm_lowered_cell_impl<B>::fvm_gap_junctions(
         }
     }
 
+    halo_junctions_.clear();
+    halo_gj_.clear();
+    export_cv_.clear();
+    std::unordered_set<cell_gid_type> group(gids.begin(), gids.end());
+    std::unordered_set<cell_member_type> exported;
+
     for (auto gid: gids) {
         auto gj_list = rec.gap_junctions_on(gid);
         for (auto g: gj_list) {
             if (gid != g.local.gid && gid != g.peer.gid) {
                 throw arb::bad_cell_description(cell_kind::cable, gid);
             }
+            if (gid != g.local.gid) {
+                std::swap(g.local, g.peer);
+            }
+
             cell_gid_type cv0, cv1;
             try {
                 cv0 = gid_to_cvs[g.local.gid].at(g.local.index);
-                cv1 = gid_to_cvs[g.peer.gid].at(g.peer.index);
             }
             catch (std::out_of_range&) {
                 throw arb::bad_cell_description(cell_kind::cable, gid);
             }
-            if (gid != g.local.gid) {
-                std::swap(cv0, cv1);
+
+            // Peers outside the group are coupled through the halo.
+            if (!group.count(g.peer.gid)) {
+                if (!exported.count(g.local)) {
+                    exported.insert(g.local);
+                    export_cv_.push_back(cv0);
+                }
+
+                halo_gj_.push_back(fvm_gap_junction(std::make_pair(cv0, fvm_index_type(halo_junctions_.size())), g.ggap * 1e3 / D.cv_area[cv0]));
+                halo_junctions_.push_back(g);
+                continue;
+            }
+
+            try {
+                cv1 = gid_to_cvs[g.peer.gid].at(g.peer.index);
+            }
+            catch (std::out_of_range&) {
+                throw arb::bad_cell_description(cell_kind::cable, gid);
             }
             v.push_back(fvm_gap_junction(std::make_pair(cv0, cv1), g.ggap * 1e3 / D.cv_area[cv0]));
         }
@@ -619,8 +880,9 @@ fvm_size_type fvm_lowered_cell_impl<B>::fvm_intdom(
                         gj.peer.gid==g?  gj.local.gid:
                         throw bad_cell_description(cell_kind::cable, g);
 
+                // Peers outside the group are coupled through the halo.
                 if (!gid_to_loc.count(peer)) {
-                    throw gj_unsupported_domain_decomposition(g, peer);
+                    continue;
                 }
 
                 if (!visited.count(peer)) {
@@ -3,6 +3,7 @@
 #ifdef __linux__
 extern "C" {
     #include <malloc.h>
+    #include <unistd.h>
 }
 #endif
 
@@ -38,5 +39,16 @@ memory_size_type gpu_allocated_memory() {
 }
 #endif
 
+#if defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+memory_size_type l2_cache_size() {
+    auto n = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    return n>0? n: -1;
+}
+#else
+memory_size_type l2_cache_size() {
+    return -1;
+}
+#endif
+
 } // namespace hw
 } // namespace arb
@@ -20,5 +20,10 @@ memory_size_type allocated_memory();
 // Returns -1 on error, or if not using the gpu.
 memory_size_type gpu_allocated_memory();
 
+// Returns the size of the level 2 data cache in bytes.
+// Returns -1 if the size is not known, or if the operation is not
+// supported on the target architecture.
+memory_size_type l2_cache_size();
+
 } // namespace hw
 } // namespace arb
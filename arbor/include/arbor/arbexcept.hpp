@@ -45,6 +45,11 @@ struct bad_probe_id: arbor_exception {
     cell_member_type probe_id;
 };
 
+struct bad_probe_reduction: arbor_exception {
+    explicit bad_probe_reduction(cell_member_type id);
+    cell_member_type probe_id;
+};
+
 struct gj_kind_mismatch: arbor_exception {
     gj_kind_mismatch(cell_gid_type gid_0, cell_gid_type gid_1);
     cell_gid_type gid_0, gid_1;
@@ -52,6 +57,7 @@ struct gj_kind_mismatch: arbor_exception {
 
 // Domain decomposition errors:
 
+// A gap junction between cell groups must be listed on the cells at both ends.
 struct gj_unsupported_domain_decomposition: arbor_exception {
     gj_unsupported_domain_decomposition(cell_gid_type gid_0, cell_gid_type gid_1);
     cell_gid_type gid_0, gid_1;
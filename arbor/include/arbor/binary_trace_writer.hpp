@@ -0,0 +1,63 @@
+#pragma once
+
+/*
+ * Bulk sampler that appends probe traces to a binary stream.
+ *
+ * Each sampler call writes one record, in native byte order:
+ *
+ *     uint32  gid      probe id gid
+ *     uint32  index    probe id index
+ *     int32   tag      probe tag
+ *     uint32  n        number of samples
+ *     double  time[n]  sample times [ms]
+ *     double  value[n] sample values
+ *
+ * Records for one probe are written in time order; records for different
+ * probes may be interleaved.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+#include <arbor/common_types.hpp>
+#include <arbor/sampling.hpp>
+
+namespace arb {
+
+class binary_trace_writer {
+public:
+    explicit binary_trace_writer(std::ostream& out): state_(std::make_shared<state>(out)) {}
+
+    // Models bulk_sampler_function. Sampler calls may come from multiple
+    // threads: writes of whole records are serialized.
+    void operator()(cell_member_type probe_id, probe_tag tag, std::size_t n, const double* time, const double* value) {
+        std::uint32_t header[4] = {
+            std::uint32_t(probe_id.gid),
+            std::uint32_t(probe_id.index),
+            std::uint32_t(tag),
+            std::uint32_t(n)
+        };
+
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        auto& out = state_->out;
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(time), n*sizeof(double));
+        out.write(reinterpret_cast<const char*>(value), n*sizeof(double));
+    }
+
+private:
+    struct state {
+        explicit state(std::ostream& out): out(out) {}
+
+        std::ostream& out;
+        std::mutex mutex;
+    };
+
+    // Shared, so that copies of the writer held by the simulation
+    // write through the same lock.
+    std::shared_ptr<state> state_;
+};
+
+} // namespace arb
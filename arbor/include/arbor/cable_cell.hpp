@@ -37,6 +37,28 @@ struct cell_probe_address {
     probe_kind kind;
 };
 
+// Probe type for a reduction of a membrane quantity over the CVs of a cell,
+// computed by the back-end when the sample is taken. The reduction covers
+// the CVs containing the given locations, or all CVs of the cell if no
+// locations are given.
+//
+//  * mean:      membrane area-weighted mean; one value per sample.
+//  * sum:       sum of the quantity times CV membrane area [µm²]; one value
+//               per sample. For membrane current density this is the total
+//               membrane current in pA.
+//  * histogram: number of CVs with value in [bin_edges[i], bin_edges[i+1]);
+//               bin_edges.size()-1 values per sample.
+struct cell_probe_reduction {
+    enum reduction_kind {
+        mean, sum, histogram
+    };
+
+    std::vector<mlocation> locations;
+    cell_probe_address::probe_kind kind;
+    reduction_kind reduction;
+    std::vector<double> bin_edges; // Ascending; histogram only.
+};
+
 // Forward declare the implementation, for PIMPL.
 struct cable_cell_impl;
 
@@ -276,6 +276,30 @@ struct cable_cell_parameter_set: public cable_cell_local_parameter_set {
 
 extern cable_cell_local_parameter_set neuron_parameter_defaults;
 
+// Numbering of the CVs of each cell in the lowered cell.
+//
+// The root CV of a cell is always numbered first, and every other CV after
+// its parent.
+
+enum class cv_ordering {
+    segment,            // CVs in segment order, as produced by the discretization
+    depth_first,        // depth-first (pre-order) traversal of the CV tree
+    cuthill_mckee,      // breadth-first, children by increasing degree
+    branch_contiguous   // unbranched runs of CVs kept contiguous, in breadth-first order
+};
+
+// Time integration scheme of the membrane voltage.
+//
+// Mechanism state is advanced after the voltage in each step, from the new
+// voltage. With the Crank–Nicolson scheme mechanism state is then taken to
+// be staggered by half a step from the voltage, so that the currents of a
+// step are evaluated at its midpoint.
+
+enum class voltage_integration {
+    backward_euler,     // first order, unconditionally stable
+    crank_nicolson      // second order: backward Euler over half a step, extrapolated
+};
+
 // Global cable cell data.
 
 struct cable_cell_global_properties {
@@ -288,6 +312,31 @@ struct cable_cell_global_properties {
     // True => combine linear synapses for performance.
     bool coalesce_synapses = true;
 
+    // Order in which CVs are numbered in the cell state and matrix.
+    cv_ordering cv_order = cv_ordering::segment;
+
+    // True => integrate the cells of each cell group in blocks of
+    // integration domains, each block advanced through a whole epoch
+    // before the next, so that the state of a block stays in cache.
+    // Only the multicore back end integrates in blocks.
+    bool blocked_integration = false;
+
+    // Maximum number of CVs in an integration block; if zero, derived
+    // from the size of the L2 cache.
+    unsigned integration_block_cvs = 0;
+
+    // True => each integration domain takes its own time steps, chosen to
+    // keep the estimated local error in membrane voltage of each step below
+    // adaptive_dt_tolerance [mV]. Steps are no shorter than the simulation
+    // time step, and no longer than adaptive_dt_max [ms]. Only the multicore
+    // back end supports adaptive time steps.
+    bool adaptive_dt = false;
+    double adaptive_dt_tolerance = 0.001;
+    double adaptive_dt_max = 0.5;
+
+    // Scheme used to integrate the membrane voltage.
+    voltage_integration voltage_scheme = voltage_integration::backward_euler;
+
     // Available ion species, together with charge.
     std::unordered_map<std::string, int> ion_species = {
         {"na", 1},
@@ -12,6 +12,12 @@ struct partition_hint {
     std::size_t cpu_group_size = 1;
     std::size_t gpu_group_size = max_size;
     bool prefer_gpu = true;
+
+    // Distribute cells connected by gap junctions like independent cells,
+    // rather than keeping each connected set of cells in one cell group.
+    // Gap junctions between cell groups, on this domain or others, are then
+    // coupled through a halo exchange of the voltages at their sites.
+    bool split_gap_junctions = false;
 };
 
 using partition_hint_map = std::unordered_map<cell_kind, partition_hint>;
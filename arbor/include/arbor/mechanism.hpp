@@ -18,6 +18,15 @@ template <typename B> class concrete_mechanism;
 template <typename B>
 using concrete_mech_ptr = std::unique_ptr<concrete_mechanism<B>>;
 
+// Number of SIMD blocks of a mechanism instance, by the constraint on the
+// CV indices within each block (see arb::simd::index_constraint).
+struct mechanism_index_constraints {
+    std::size_t contiguous = 0;
+    std::size_t constant = 0;
+    std::size_t independent = 0;
+    std::size_t none = 0;
+};
+
 class mechanism {
 public:
     mechanism() = default;
@@ -42,13 +51,32 @@ public:
     // that the mechanism covers.
     virtual std::size_t size() const = 0;
 
+    // Index constraints of the SIMD blocks of an instance, as given in the layout
+    // and as stored: point mechanism instances may be reordered on instantiation.
+    virtual mechanism_index_constraints layout_index_constraints() const { return {}; }
+    virtual mechanism_index_constraints index_constraints() const { return {}; }
+
+    // Index at which each instance of the layout is stored, if instantiation
+    // reordered the instances; empty otherwise.
+    virtual std::vector<fvm_index_type> instance_index() const { return {}; }
+
     // Cloning makes a new object of the derived concrete mechanism type, but does not
     // copy any state.
     virtual mechanism_ptr clone() const = 0;
 
-    // Non-global parameters can be set post-instantiation:
+    // Non-global parameters can be set post-instantiation, with values given
+    // in layout order:
     virtual void set_parameter(const std::string& key, const std::vector<fvm_value_type>& values) = 0;
 
+    // Mechanisms covering the same CVs can have nrn_state() and nrn_current()
+    // applied in turn to blocks of instances, so that the cell state of each
+    // block is reused from cache. Implementations that support this return a
+    // non-zero block granularity, and restrict nrn_state() and nrn_current()
+    // to the instances [begin, end) after set_instance_range(begin, end),
+    // where begin and end are multiples of the granularity or end is size().
+    virtual fvm_size_type instance_block() const { return 0; }
+    virtual void set_instance_range(fvm_size_type begin, fvm_size_type end) {}
+
     // Simulation interfaces:
     virtual void initialize() = 0;
     virtual void nrn_state() = 0;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iosfwd>
 #include <map>
 #include <memory>
 #include <string>
@@ -37,9 +38,29 @@
 // If the mechanism in question has a single ion dependence, then that ion name
 // can be omitted in the assignments; "mech/oldion=newion" will make the same
 // derived mechanism as simply "mech/newion".
+//
+// A back-end may have several implementations of a mechanism, each compiled
+// for a SIMD instruction set. An instance is cloned from the implementation
+// for the widest instruction set supported by the running CPU; see
+// runtime_simd_isa() below.
 
 namespace arb {
 
+// Instruction sets for which a multicore mechanism implementation can be
+// compiled, in increasing order of preference.
+
+enum class simd_isa {
+    none, avx, avx2, avx512
+};
+
+std::ostream& operator<<(std::ostream&, simd_isa);
+
+// Widest instruction set supported by the running CPU, as given by CPUID.
+// If the environment variable ARB_SIMD_ISA is set to one of "none", "avx",
+// "avx2" or "avx512", the result is at most that instruction set.
+
+simd_isa runtime_simd_isa();
+
 // catalogue_state comprises the private implementation of mechanism_catalogue.
 struct catalogue_state;
 
@@ -79,7 +100,9 @@ public:
     void remove(const std::string& name);
 
     // Clone the implementation associated with name (search derivation hierarchy starting from
-    // most derived) and return together with any global overrides.
+    // most derived) and return together with any global overrides. Of the implementations
+    // registered for B, the one for the widest instruction set not wider than
+    // runtime_simd_isa() is used.
     template <typename B>
     struct cat_instance {
         std::unique_ptr<concrete_mechanism<B>> mech;
@@ -96,12 +119,18 @@ public:
         };
     }
 
+    // Instruction set of the implementation that instance<B>(name) would use.
+    template <typename B>
+    simd_isa instance_isa(const std::string& name) const {
+        return instance_isa_impl(std::type_index(typeid(B)), name);
+    }
+
     // Associate a concrete (prototype) mechanism for a given back-end B with a (possibly derived)
-    // mechanism name.
+    // mechanism name, compiled for the given instruction set.
     template <typename B>
-    void register_implementation(const std::string& name, std::unique_ptr<concrete_mechanism<B>> proto) {
+    void register_implementation(const std::string& name, std::unique_ptr<concrete_mechanism<B>> proto, simd_isa isa = simd_isa::none) {
         mechanism_ptr generic_proto = mechanism_ptr(proto.release());
-        register_impl(std::type_index(typeid(B)), name, std::move(generic_proto));
+        register_impl(std::type_index(typeid(B)), name, std::move(generic_proto), isa);
     }
 
     ~mechanism_catalogue();
@@ -110,7 +139,8 @@ private:
     std::unique_ptr<catalogue_state> state_;
 
     std::pair<mechanism_ptr, mechanism_overrides> instance_impl(std::type_index, const std::string&) const;
-    void register_impl(std::type_index, const std::string&, mechanism_ptr);
+    simd_isa instance_isa_impl(std::type_index, const std::string&) const;
+    void register_impl(std::type_index, const std::string&, mechanism_ptr, simd_isa);
 };
 
 
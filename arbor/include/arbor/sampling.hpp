@@ -1,7 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <arbor/common_types.hpp>
 #include <arbor/util/any_ptr.hpp>
@@ -10,10 +14,95 @@ namespace arb {
 
 using cell_member_predicate = std::function<bool (cell_member_type)>;
 
-static cell_member_predicate all_probes = [](cell_member_type pid) { return true; };
+// A probe selector describes the set of probes to which a sampler is attached.
+//
+// Structured selectors (all probes, one probe id, the probes on a half-open
+// range of gids, or the probes on a set of gids) allow the simulation and cell
+// groups to find the selected probes by lookup. An arbitrary predicate on
+// probe ids is also accepted, but it must be tested against every probe in
+// every cell group.
 
-inline cell_member_predicate one_probe(cell_member_type pid) {
-    return [pid](cell_member_type x) { return pid==x; };
+struct probe_selector {
+    enum class selector_kind {
+        all,
+        one,
+        gid_range,
+        gid_set,
+        predicate
+    };
+
+    selector_kind kind = selector_kind::all;
+
+    cell_member_type id = {0, 0};      // One probe id.
+    cell_gid_type gid_begin = 0;       // Half-open range of gids [gid_begin, gid_end).
+    cell_gid_type gid_end = 0;
+    std::vector<cell_gid_type> gids;   // Set of gids, sorted and unique.
+    cell_member_predicate pred;        // Arbitrary membership test.
+
+    // Default selector matches all probes.
+    probe_selector() = default;
+
+    // Any predicate on probe ids can be used as a selector.
+    template <
+        typename F,
+        typename = std::enable_if_t<
+            !std::is_same<std::decay_t<F>, probe_selector>::value &&
+            std::is_convertible<F, cell_member_predicate>::value>
+    >
+    probe_selector(F&& f): kind(selector_kind::predicate), pred(std::forward<F>(f)) {}
+
+    // Membership test for probe id.
+    bool operator()(cell_member_type pid) const {
+        switch (kind) {
+        case selector_kind::all:
+            return true;
+        case selector_kind::one:
+            return pid==id;
+        case selector_kind::gid_range:
+            return pid.gid>=gid_begin && pid.gid<gid_end;
+        case selector_kind::gid_set:
+            return std::binary_search(gids.begin(), gids.end(), pid.gid);
+        case selector_kind::predicate:
+            return pred(pid);
+        }
+        return false;
+    }
+
+    // True if the selected probes can be determined from gids alone.
+    bool is_gid_indexed() const {
+        return kind==selector_kind::one || kind==selector_kind::gid_range || kind==selector_kind::gid_set;
+    }
+};
+
+// Match all probe ids.
+static probe_selector all_probes;
+
+// Match just one probe id.
+inline probe_selector one_probe(cell_member_type pid) {
+    probe_selector sel;
+    sel.kind = probe_selector::selector_kind::one;
+    sel.id = pid;
+    return sel;
+}
+
+// Match probes on cells with gid in [gid_begin, gid_end).
+inline probe_selector probes_in_gid_range(cell_gid_type gid_begin, cell_gid_type gid_end) {
+    probe_selector sel;
+    sel.kind = probe_selector::selector_kind::gid_range;
+    sel.gid_begin = gid_begin;
+    sel.gid_end = gid_end;
+    return sel;
+}
+
+// Match probes on cells with gid in the given collection.
+inline probe_selector probes_on_gids(std::vector<cell_gid_type> gids) {
+    std::sort(gids.begin(), gids.end());
+    gids.erase(std::unique(gids.begin(), gids.end()), gids.end());
+
+    probe_selector sel;
+    sel.kind = probe_selector::selector_kind::gid_set;
+    sel.gids = std::move(gids);
+    return sel;
 }
 
 struct sample_record {
@@ -23,6 +112,14 @@ struct sample_record {
 
 using sampler_function = std::function<void (cell_member_type, probe_tag, std::size_t, const sample_record*)>;
 
+// Bulk samplers receive the n sample times and values for one probe as
+// contiguous arrays, which point directly into the simulation's sample
+// buffers and are valid only for the duration of the call. Bulk samplers
+// apply only to probes with double-valued samples; for probes with more
+// than one value per sample, the values of each sample are consecutive.
+
+using bulk_sampler_function = std::function<void (cell_member_type, probe_tag, std::size_t, const double* time, const double* value)>;
+
 using sampler_association_handle = std::size_t;
 
 enum class sampling_policy {
@@ -150,6 +150,10 @@ struct avx_int4: implbase<avx_int4> {
         return _mm_cmpeq_epi32(b, ones);
     }
 
+    static unsigned long long mask_pack(const __m128i& m) {
+        return _mm_movemask_ps(_mm_castsi128_ps(m));
+    }
+
     static bool mask_element(const __m128i& u, int i) {
         return static_cast<bool>(element(u, i));
     }
@@ -198,6 +202,8 @@ struct avx_double4: implbase<avx_double4> {
     //     element, set_element, fma.
 
     using implbase<avx_double4>::cast_from;
+    using implbase<avx_double4>::convert_from;
+    using implbase<avx_double4>::convert_to;
 
     using int64 = std::int64_t;
 
@@ -237,6 +243,14 @@ struct avx_double4: implbase<avx_double4> {
         return ifelse(mask, d, v);
     }
 
+    static __m256d convert_from(const float* p) {
+        return _mm256_cvtps_pd(_mm_loadu_ps(p));
+    }
+
+    static void convert_to(const __m256d& v, float* p) {
+        _mm_storeu_ps(p, _mm256_cvtpd_ps(v));
+    }
+
     static __m256d cast_from(tag<avx_int4>, const __m128i& v) {
         return _mm256_cvtepi32_pd(v);
     }
@@ -328,6 +342,10 @@ struct avx_double4: implbase<avx_double4> {
         return _mm256_castsi256_pd(combine_m128i(bu, bl));
     }
 
+    static unsigned long long mask_pack(const __m256d& m) {
+        return _mm256_movemask_pd(m);
+    }
+
     static void mask_set_element(__m256d& u, int i, bool b) {
         char data[256];
         _mm256_storeu_pd((double*)data, u);
@@ -729,6 +747,7 @@ struct avx2_int4: avx_int4 {
 struct avx2_double4: avx_double4 {
     using implbase<avx_double4>::cast_from;
     using implbase<avx_double4>::gather;
+    using implbase<avx_double4>::reduce_by_key;
 
     // Need to provide a cast overload for avx2_int4 tag:
     static __m256d cast_from(tag<avx2_int4>, const __m128i& v) {
@@ -779,6 +798,31 @@ struct avx2_double4: avx_double4 {
         return  _mm256_mask_i32gather_pd(a, p, index, mask, 8);
     };
 
+    // Sum runs of equal indices by a segmented scan in register, in steps
+    // of 1 and 2 lanes, as for avx512_double8. Without a scatter, the lanes
+    // of the gathered sum are then stored in order: the last lane of each
+    // run, which holds the whole sum of the run, is stored last.
+
+    static void reduce_by_key(tag<avx2_int4>, const __m256d& s, double* p, const __m128i& index) {
+        // Bit i of run is set if lane i has the index of lane i-1.
+        __m128i prev = _mm_shuffle_epi32(index, 0x90);
+        int run = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(index, prev))) & 0xe;
+
+        __m256d v = s;
+        int m = run;
+        v = add(v, _mm256_and_pd(mask_unpack(m), _mm256_permute4x64_pd(v, 0x90)));
+        m &= m<<1;
+        v = add(v, _mm256_and_pd(mask_unpack(m), _mm256_permute4x64_pd(v, 0x40)));
+
+        double a[4];
+        int o[4];
+        copy_to(add(v, _mm256_i32gather_pd(p, index, 8)), a);
+        avx_int4::copy_to(index, o);
+        for (unsigned i = 0; i<4; ++i) {
+            p[o[i]] = a[i];
+        }
+    }
+
     // avx4_double4 versions of log, exp, and expm1 use the same algorithms as for avx_double4,
     // but use AVX2-specialized bit manipulation and FMA.
 
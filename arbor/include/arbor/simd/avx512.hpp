@@ -185,6 +185,10 @@ struct avx512_mask8: implbase<avx512_mask8> {
         return _mm512_int2mask(p);
     }
 
+    static unsigned long long mask_pack(const __mmask8& m) {
+        return _mm512_mask2int(m);
+    }
+
     static bool mask_element(const __mmask8& u, int i) {
         return element(u, i);
     }
@@ -225,6 +229,10 @@ struct avx512_int8: implbase<avx512_int8> {
         return _mm512_set1_epi32(v);
     }
 
+    static __m512i cast_from(tag<avx512_double8>, const __m512d& v) {
+        return _mm512_inserti64x4(_mm512_setzero_si512(), _mm512_cvttpd_epi32(v), 0);
+    }
+
     static void copy_to(const __m512i& v, int32* p) {
         _mm512_mask_storeu_epi32(p, lo(), v);
     }
@@ -405,6 +413,9 @@ struct avx512_double8: implbase<avx512_double8> {
     using implbase<avx512_double8>::gather;
     using implbase<avx512_double8>::scatter;
     using implbase<avx512_double8>::cast_from;
+    using implbase<avx512_double8>::reduce_by_key;
+    using implbase<avx512_double8>::convert_from;
+    using implbase<avx512_double8>::convert_to;
 
     // CMPPD predicates:
     static constexpr int cmp_eq_oq =    0;
@@ -421,6 +432,10 @@ struct avx512_double8: implbase<avx512_double8> {
         return _mm512_set1_pd(v);
     }
 
+    static __m512d cast_from(tag<avx512_int8>, const __m512i& v) {
+        return _mm512_cvtepi32_pd(_mm512_castsi512_si256(v));
+    }
+
     static void copy_to(const __m512d& v, double* p) {
         _mm512_storeu_pd(p, v);
     }
@@ -441,6 +456,14 @@ struct avx512_double8: implbase<avx512_double8> {
         return _mm512_mask_loadu_pd(v, mask, p);
     }
 
+    static __m512d convert_from(const float* p) {
+        return _mm512_cvtps_pd(_mm256_loadu_ps(p));
+    }
+
+    static void convert_to(const __m512d& v, float* p) {
+        _mm256_storeu_ps(p, _mm512_cvtpd_ps(v));
+    }
+
     static double element0(const __m512d& a) {
         return _mm_cvtsd_f64(_mm512_castpd512_pd128(a));
     }
@@ -577,6 +600,30 @@ struct avx512_double8: implbase<avx512_double8> {
         _mm512_mask_i32scatter_pd(p, mask, _mm512_castsi512_si256(index), s, 8);
     }
 
+    // Sum runs of equal indices by a segmented scan in register: in steps of
+    // 1, 2 and 4 lanes, each lane adds the lane d below if every lane in
+    // between has the same index. The last lane of each run then holds the
+    // sum of the run, and the last lanes have distinct indices.
+
+    static void reduce_by_key(tag<avx512_int8>, const __m512d& s, double* p, const __m512i& index) {
+        // Bit i of run is set if lane i has the index of lane i-1.
+        __m512i prev = _mm512_permutexvar_epi32(_mm512_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0), index);
+        __mmask8 run = (__mmask8)(_mm512_cmpeq_epi32_mask(index, prev) & 0xfe);
+
+        __m512d v = s;
+        __mmask8 m = run;
+        v = _mm512_mask_add_pd(v, m, v, _mm512_permutexvar_pd(_mm512_setr_epi64(0, 0, 1, 2, 3, 4, 5, 6), v));
+        m = (__mmask8)(m & (m<<1));
+        v = _mm512_mask_add_pd(v, m, v, _mm512_permutexvar_pd(_mm512_setr_epi64(0, 0, 0, 1, 2, 3, 4, 5), v));
+        m = (__mmask8)(m & (m<<2));
+        v = _mm512_mask_add_pd(v, m, v, _mm512_permutexvar_pd(_mm512_setr_epi64(0, 0, 0, 0, 0, 1, 2, 3), v));
+
+        __mmask8 last = (__mmask8)~(run>>1);
+        __m256i k = _mm512_castsi512_si256(index);
+        __m512d a = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), last, k, p, 8);
+        _mm512_mask_i32scatter_pd(p, last, k, _mm512_add_pd(a, v), 8);
+    }
+
     // Use SVML for exp and log if compiling with icpc, else use ratpoly
     // approximations.
 
@@ -181,6 +181,23 @@ struct implbase {
         return I::copy_from(a);
     }
 
+    // Load from and store to memory of a different arithmetic type,
+    // e.g. single-precision storage of double-precision values.
+
+    template <typename T>
+    static vector_type convert_from(const T* p) {
+        store a;
+        std::copy(p, p+width, a);
+        return I::copy_from(a);
+    }
+
+    template <typename T>
+    static void convert_to(const vector_type& v, T* p) {
+        store a;
+        I::copy_to(v, a);
+        std::copy(a, a+width, p);
+    }
+
     static vector_type negate(const vector_type& u) {
         store a, r;
         I::copy_to(u, a);
@@ -379,6 +396,17 @@ struct implbase {
         return I::mask_copy_from(m);
     }
 
+    static unsigned long long mask_pack(const vector_type& v) {
+        mask_store m;
+        I::mask_copy_to(v, m);
+
+        unsigned long long k = 0;
+        for (unsigned i = 0; i<width; ++i) {
+            k |= (unsigned long long)m[i]<<i;
+        }
+        return k;
+    }
+
     template <typename ImplIndex>
     static vector_type gather(tag<ImplIndex>, const scalar_type* p, const typename ImplIndex::vector_type& index) {
         typename ImplIndex::scalar_type o[width];
@@ -447,6 +475,29 @@ struct implbase {
         return r;
     }
 
+    // Add the lanes of s to p at the lanes of index, which may repeat
+    // (index_constraint::none). Repeated indices must be in adjacent lanes:
+    // each run of equal indices is summed, and p updated once per run.
+    template <typename ImplIndex>
+    static void reduce_by_key(tag<ImplIndex>, const vector_type& s, scalar_type* p, const typename ImplIndex::vector_type& index) {
+        typename ImplIndex::scalar_type o[width];
+        ImplIndex::copy_to(index, o);
+
+        store a;
+        I::copy_to(s, a);
+
+        scalar_type temp = 0;
+        for (unsigned i = 0; i<width-1; ++i) {
+            temp += a[i];
+            if (o[i] != o[i+1]) {
+                p[o[i]] += temp;
+                temp = 0;
+            }
+        }
+        temp += a[width-1];
+        p[o[width-1]] += temp;
+    }
+
     // Maths
 
     static vector_type abs(const vector_type& u) {
@@ -99,6 +99,16 @@ namespace detail {
             value_ = Impl::copy_from(a);
         }
 
+        // Construct from values of a different arithmetic type in memory,
+        // converting each to scalar_type.
+        template <
+            typename T,
+            typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, scalar_type>::value>
+        >
+        explicit simd_impl(const T* p) {
+            value_ = Impl::convert_from(p);
+        }
+
         // Construct from scalar values in memory with mask.
         explicit simd_impl(const scalar_type* p, const simd_mask& m) {
             value_ = Impl::copy_from_masked(p, m.value_);
@@ -149,6 +159,15 @@ namespace detail {
             Impl::copy_to(value_, p);
         }
 
+        // Store with conversion to a different arithmetic type.
+        template <
+            typename T,
+            typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, scalar_type>::value>
+        >
+        void copy_to(T* p) const {
+            Impl::convert_to(value_, p);
+        }
+
         template <typename IndexImpl, typename = std::enable_if_t<width==simd_traits<IndexImpl>::width>>
         void copy_to(indirect_expression<IndexImpl, scalar_type> pi) const {
             Impl::scatter(tag<IndexImpl>{}, value_, pi.p, pi.index);
@@ -213,24 +232,7 @@ namespace detail {
         static void compound_indexed_add(tag<ImplIndex> tag, const vector_type& s, scalar_type* p, const typename ImplIndex::vector_type& index, index_constraint constraint) {
             switch (constraint) {
             case index_constraint::none:
-                {
-                    typename ImplIndex::scalar_type o[width];
-                    ImplIndex::copy_to(index, o);
-
-                    scalar_type a[width];
-                    Impl::copy_to(s, a);
-
-                    scalar_type temp = 0;
-                    for (unsigned i = 0; i<width-1; ++i) {
-                        temp += a[i];
-                        if (o[i] != o[i+1]) {
-                            p[o[i]] += temp;
-                            temp = 0;
-                        }
-                    }
-                    temp += a[width-1];
-                    p[o[width-1]] += temp;
-                }
+                Impl::reduce_by_key(tag, s, p, index);
                 break;
             case index_constraint::independent:
                 {
@@ -570,6 +572,12 @@ namespace detail {
             return simd_mask_impl::wrap(Impl::mask_unpack(bits));
         }
 
+        // Make integer from mask, with bit i set if element i is true.
+
+        unsigned long long pack() const {
+            return Impl::mask_pack(value_);
+        }
+
     private:
         simd_mask_impl(const vector_type& v): base(v) {}
 
@@ -673,6 +681,14 @@ detail::indirect_expression<IndexImpl, V> indirect(
     return detail::indirect_expression<IndexImpl, V>(p, index, constraint);
 }
 
+// Indexed update with repeated indices, which must be in adjacent lanes:
+// the lanes of each run of equal indices are summed before p is updated.
+
+template <typename Impl, typename IndexImpl, typename PtrLike>
+void reduce_by_key(const detail::simd_impl<Impl>& s, PtrLike p, const detail::simd_impl<IndexImpl>& index) {
+    indirect(p, index, index_constraint::none) += s;
+}
+
 
 } // namespace simd
 } // namespace arb
@@ -5,13 +5,11 @@
  * trace data from a cell probe, with some metadata.
  */
 
-#include <stdexcept>
 #include <type_traits>
 #include <vector>
 
 #include <arbor/common_types.hpp>
 #include <arbor/sampling.hpp>
-#include <arbor/util/any_ptr.hpp>
 
 namespace arb {
 
@@ -29,14 +27,10 @@ class simple_sampler {
 public:
     explicit simple_sampler(trace_data<V>& trace): trace_(trace) {}
 
-    void operator()(cell_member_type probe_id, probe_tag tag, std::size_t n, const sample_record* recs) {
+    // Models bulk_sampler_function.
+    void operator()(cell_member_type probe_id, probe_tag tag, std::size_t n, const double* time, const double* value) {
         for (std::size_t i = 0; i<n; ++i) {
-            if (auto p = util::any_cast<const V*>(recs[i].data)) {
-                trace_.push_back({recs[i].time, *p});
-            }
-            else {
-                throw std::runtime_error("unexpected sample type in simple_sampler");
-            }
+            trace_.push_back({time_type(time[i]), V(value[i])});
         }
     }
 
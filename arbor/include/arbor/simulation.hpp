@@ -32,9 +32,12 @@ public:
     // Note: sampler functions may be invoked from a different thread than that
     // which called the `run` method.
 
-    sampler_association_handle add_sampler(cell_member_predicate probe_ids,
+    sampler_association_handle add_sampler(probe_selector probe_ids,
         schedule sched, sampler_function f, sampling_policy policy = sampling_policy::lax);
 
+    sampler_association_handle add_sampler(probe_selector probe_ids,
+        schedule sched, bulk_sampler_function f, sampling_policy policy = sampling_policy::lax);
+
     void remove_sampler(sampler_association_handle);
 
     void remove_all_samplers();
@@ -44,6 +47,12 @@ public:
     // Set event binning policy on all our groups.
     void set_binning_policy(binning_kind policy, time_type bin_interval);
 
+    // Set the interval at which the voltages at the sites of gap junctions
+    // between cell groups are exchanged; over each interval the peer voltage
+    // of such a junction is held constant. Zero, the default, exchanges the
+    // voltages every time step.
+    void set_gap_junction_interval(time_type interval);
+
     // Register a callback that will perform a export of the global
     // spike vector.
     void set_global_spike_callback(spike_export_function = spike_export_function{});
@@ -44,8 +44,10 @@ void lif_cell_group::clear_spikes() {
 }
 
 // TODO: implement sampler
-void lif_cell_group::add_sampler(sampler_association_handle h, cell_member_predicate probe_ids,
+void lif_cell_group::add_sampler(sampler_association_handle h, probe_selector probe_ids,
                                     schedule sched, sampler_function fn, sampling_policy policy) {}
+void lif_cell_group::add_sampler(sampler_association_handle h, probe_selector probe_ids,
+                                    schedule sched, bulk_sampler_function fn, sampling_policy policy) {}
 void lif_cell_group::remove_sampler(sampler_association_handle h) {}
 void lif_cell_group::remove_all_samplers() {}
 
@@ -31,7 +31,8 @@ public:
 
     // Sampler association methods below should be thread-safe, as they might be invoked
     // from a sampler call back called from a different cell group running on a different thread.
-    virtual void add_sampler(sampler_association_handle, cell_member_predicate, schedule, sampler_function, sampling_policy) override;
+    virtual void add_sampler(sampler_association_handle, probe_selector, schedule, sampler_function, sampling_policy) override;
+    virtual void add_sampler(sampler_association_handle, probe_selector, schedule, bulk_sampler_function, sampling_policy) override;
     virtual void remove_sampler(sampler_association_handle) override;
     virtual void remove_all_samplers() override;
 
@@ -7,6 +7,8 @@
 #include <memory/memory.hpp>
 #include <util/span.hpp>
 
+#include "execution_context.hpp"
+
 namespace arb {
 
 /// Hines matrix
@@ -45,6 +47,23 @@ public:
         arb_assert(cell_index_[num_cells()] == index_type(parent_index_.size()));
     }
 
+    // Back end states may use the execution resources of the context, e.g.
+    // to solve in parallel.
+    matrix(const std::vector<index_type>& pi,
+           const std::vector<index_type>& ci,
+           const std::vector<value_type>& cv_capacitance,
+           const std::vector<value_type>& face_conductance,
+           const std::vector<value_type>& cv_area,
+           const std::vector<index_type>& cell_to_intdom,
+           const execution_context& context):
+        parent_index_(pi.begin(), pi.end()),
+        cell_index_(ci.begin(), ci.end()),
+        cell_to_intdom_(cell_to_intdom.begin(), cell_to_intdom.end()),
+        state_(pi, ci, cv_capacitance, face_conductance, cv_area, cell_to_intdom, context)
+    {
+        arb_assert(cell_index_[num_cells()] == index_type(parent_index_.size()));
+    }
+
     /// the dimension of the matrix (i.e. the number of rows or colums)
     std::size_t size() const {
         return parent_index_.size();
@@ -66,6 +85,11 @@ public:
         state_.solve();
     }
 
+    /// Solve the linear system, writing the solution to `to`.
+    void solve(array& to) {
+        state_.solve(to);
+    }
+
     /// Assemble the matrix for given dt
     void assemble(const array& dt_cell, const array& voltage, const array& current, const array& conductivity) {
         state_.assemble(dt_cell, voltage, current, conductivity);
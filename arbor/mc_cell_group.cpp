@@ -1,9 +1,11 @@
+#include <algorithm>
 #include <functional>
 #include <unordered_set>
 #include <vector>
 
 #include <arbor/assert.hpp>
 #include <arbor/common_types.hpp>
+#include <arbor/math.hpp>
 #include <arbor/sampling.hpp>
 #include <arbor/recipe.hpp>
 #include <arbor/spike.hpp>
@@ -15,10 +17,10 @@
 #include "mc_cell_group.hpp"
 #include "profile/profiler_macro.hpp"
 #include "sampler_map.hpp"
-#include "util/filter.hpp"
 #include "util/maputil.hpp"
 #include "util/partition.hpp"
 #include "util/range.hpp"
+#include "util/rangeutil.hpp"
 #include "util/span.hpp"
 
 namespace arb {
@@ -50,6 +52,24 @@ mc_cell_group::mc_cell_group(const std::vector<cell_gid_type>& gids, const recip
     // Construct cell implementation, retrieving handles and maps. 
     lowered_->initialize(gids_, rec, cell_to_intdom_, target_handles_, probe_map_);
 
+    util::assign(sorted_probe_ids_, util::keys(probe_map_));
+    util::sort(sorted_probe_ids_);
+
+    // Order cells by integration domain for event staging; intdom ids
+    // are contiguous from zero, so this gives a partition by intdom.
+    util::assign(idx_sorted_by_intdom_, util::make_span(gids_.size()));
+    util::stable_sort_by(idx_sorted_by_intdom_, [&](cell_size_type i) { return cell_to_intdom_[i]; });
+
+    intdom_cell_divs_.push_back(0);
+    for (auto i: util::make_span(1, idx_sorted_by_intdom_.size())) {
+        if (cell_to_intdom_[idx_sorted_by_intdom_[i]]!=cell_to_intdom_[idx_sorted_by_intdom_[i-1]]) {
+            intdom_cell_divs_.push_back(i);
+        }
+    }
+    if (!idx_sorted_by_intdom_.empty()) {
+        intdom_cell_divs_.push_back(idx_sorted_by_intdom_.size());
+    }
+
     // Create a list of the global identifiers for the spike sources
     for (auto source_gid: gids_) {
         for (cell_lid_type lid = 0; lid<rec.num_sources(source_gid); ++lid) {
@@ -62,10 +82,10 @@ mc_cell_group::mc_cell_group(const std::vector<cell_gid_type>& gids, const recip
 void mc_cell_group::reset() {
     spikes_.clear();
 
-    sample_events_.clear();
     for (auto &assoc: sampler_map_) {
         assoc.sched.reset();
     }
+    sampler_plan_valid_ = false;
 
     for (auto& b: binners_) {
         b.reset();
@@ -79,130 +99,199 @@ void mc_cell_group::set_binning_policy(binning_kind policy, time_type bin_interv
     binners_.resize(gids_.size(), event_binner(policy, bin_interval));
 }
 
+void mc_cell_group::stage_intdom_events(util::range<const cell_size_type*> cells, const event_lane_subrange& event_lanes, epoch ep, time_type tstart) {
+    // Take the next event from the lane, binning its delivery time;
+    // events at or after the end of the epoch terminate the lane.
+    auto next_head = [&](lane_cursor& c) {
+        c.head = c.it!=c.end && c.it->time<ep.tfinal?
+            binners_[c.lid].bin(c.it->time, tstart): terminal_time;
+    };
+
+    // Events before tstart were delivered in an earlier call in the same
+    // epoch, when the epoch is integrated in parts.
+    auto lane_cursor_at = [&](cell_size_type lid) {
+        const auto* b = event_lanes[lid].data();
+        const auto* e = b+event_lanes[lid].size();
+        b = std::lower_bound(b, e, tstart, [](const spike_event& ev, time_type t) { return ev.time<t; });
+        return lane_cursor{b, e, 0, lid};
+    };
+
+    auto stage = [&](lane_cursor& c) {
+        auto h = target_handles_[target_handle_divisions_[c.lid]+c.it->target.index];
+        staged_events_.push_back(deliverable_event(c.head, h, c.it->weight));
+        ++c.it;
+        next_head(c);
+    };
+
+    unsigned n_lanes = cells.size();
+    if (n_lanes==1) {
+        auto lid = cells.front();
+        lane_cursor c = lane_cursor_at(lid);
+        for (next_head(c); c.head!=terminal_time; ) {
+            stage(c);
+        }
+        return;
+    }
+
+    // Tournament tree with leaves padded to a power of two, stored in heap
+    // order. Ties are broken by lane order, matching a stable merge of the
+    // lanes taken in cell order.
+    unsigned n_leaves = math::next_pow2(n_lanes);
+    merge_lanes_.resize(n_leaves);
+    merge_tree_.resize(2*n_leaves-1);
+
+    for (unsigned i = 0; i<n_leaves; ++i) {
+        auto& c = merge_lanes_[i];
+        if (i<n_lanes) {
+            auto lid = cells[i];
+            c = lane_cursor_at(lid);
+            next_head(c);
+        }
+        else {
+            c = {nullptr, nullptr, terminal_time, 0};
+        }
+        merge_tree_[n_leaves-1+i] = i;
+    }
+
+    auto merge_up = [&](unsigned i) {
+        unsigned l = merge_tree_[2*i+1], r = merge_tree_[2*i+2];
+        merge_tree_[i] = merge_lanes_[r].head<merge_lanes_[l].head? r: l;
+    };
+
+    for (unsigned i = n_leaves-1; i-->0; ) {
+        merge_up(i);
+    }
+
+    while (merge_lanes_[merge_tree_[0]].head!=terminal_time) {
+        unsigned lane = merge_tree_[0];
+        stage(merge_lanes_[lane]);
+
+        for (unsigned i = n_leaves-1+lane; i>0; ) {
+            i = (i-1)/2;
+            merge_up(i);
+        }
+    }
+}
+
 void mc_cell_group::advance(epoch ep, time_type dt, const event_lane_subrange& event_lanes) {
     time_type tstart = lowered_->time();
 
     PE(advance_eventsetup);
     staged_events_.clear();
 
-    fvm_index_type ev_begin = 0, ev_mid = 0, ev_end = 0;
     // skip event binning if empty lanes are passed
     if (event_lanes.size()) {
-
-        std::vector<cell_size_type> idx_sorted_by_intdom(cell_to_intdom_.size());
-        std::iota(idx_sorted_by_intdom.begin(), idx_sorted_by_intdom.end(), 0);
-        util::sort_by(idx_sorted_by_intdom, [&](cell_size_type i) { return cell_to_intdom_[i]; });
-
-        /// Event merging on integration domain could benefit from the use of the logic from `tree_merge_events`
-        fvm_index_type prev_intdom = -1;
-        for (auto i: util::count_along(gids_)) {
-            unsigned count_staged = 0;
-
-            auto lid = idx_sorted_by_intdom[i];
-            auto& lane = event_lanes[lid];
-            auto curr_intdom = cell_to_intdom_[lid];
-
-            for (auto e: lane) {
-                if (e.time>=ep.tfinal) break;
-                e.time = binners_[lid].bin(e.time, tstart);
-                auto h = target_handles_[target_handle_divisions_[lid]+e.target.index];
-                auto ev = deliverable_event(e.time, h, e.weight);
-                staged_events_.push_back(ev);
-                count_staged++;
-            }
-
-            ev_end += count_staged;
-
-            if (curr_intdom != prev_intdom) {
-                ev_begin = ev_end - count_staged;
-                prev_intdom = curr_intdom;
-            }
-            else {
-                std::inplace_merge(staged_events_.begin() + ev_begin,
-                                   staged_events_.begin() + ev_mid,
-                                   staged_events_.begin() + ev_end);
-            }
-
-            ev_mid = ev_end;
+        for (auto part: util::partition_view(intdom_cell_divs_)) {
+            const cell_size_type* cells = idx_sorted_by_intdom_.data();
+            stage_intdom_events(util::make_range(cells+part.first, cells+part.second), event_lanes, ep, tstart);
         }
     }
     PL();
 
 
-    // Create sample events and delivery information.
+    // Create sample events from the sampling plan.
     //
-    // For each (schedule, sampler, probe set) in the sampler association
-    // map that will be triggered in this integration interval, create
-    // sample events for the lowered cell, one for each scheduled sample
-    // time and probe in the probe set.
+    // For each planned sampler that will be triggered in this integration
+    // interval, create sample events for the lowered cell, one for each
+    // scheduled sample time and probe in the probe set.
     //
-    // Each event is associated with an offset into the sample data and
-    // time buffers; these are assigned contiguously such that one call to
-    // a sampler callback can be represented by a `sampler_call_info`
-    // value as defined below, grouping together all the samples of the
-    // same probe for this callback in this association.
-
-    struct sampler_call_info {
-        sampler_function sampler;
-        cell_member_type probe_id;
-        probe_tag tag;
-
-        // Offsets are into lowered cell sample time and event arrays.
-        sample_size_type begin_offset;
-        sample_size_type end_offset;
-    };
+    // Sample offsets are assigned contiguously per sampler and probe, so that
+    // one call to a sampler callback covers all the samples of one probe.
+    // Sample events are generated per integration domain in time order; only
+    // intdoms with probes under more than one triggered sampler need a sort.
 
     PE(advance_samplesetup);
-    std::vector<sampler_call_info> call_info;
+    if (!sampler_plan_valid_.exchange(true)) {
+        build_sampler_plan();
+    }
 
-    std::vector<sample_event> sample_events;
     sample_size_type n_samples = 0;
+    sample_size_type n_values = 0;
     sample_size_type max_samples_per_call = 0;
 
-    for (auto& sa: sampler_map_) {
-        auto sample_times = util::make_range(sa.sched.events(tstart, ep.tfinal));
-        if (sample_times.empty()) {
-            continue;
-        }
+    for (auto& ps: sampler_plan_) {
+        ps.times = ps.sched->events(tstart, ep.tfinal);
+        ps.offset = n_samples;
+        ps.value_offset = n_values;
 
-        sample_size_type n_times = sample_times.size();
+        sample_size_type n_times = ps.times.second-ps.times.first;
         max_samples_per_call = std::max(max_samples_per_call, n_times);
+        n_samples += n_times*ps.probes.size();
+        n_values += n_times*ps.width;
+    }
 
-        for (cell_member_type pid: sa.probe_ids) {
-            auto cell_index = gid_index_map_.at(pid.gid);
-            auto p = probe_map_[pid];
-
-            call_info.push_back({sa.sampler, pid, p.tag, n_samples, n_samples+n_times});
-
-            for (auto t: sample_times) {
-                sample_event ev{t, (cell_gid_type)cell_to_intdom_[cell_index], {p.handle, n_samples++}};
-                sample_events.push_back(ev);
+    sample_events_.clear();
+    for (auto intdom: util::make_span(sample_stream_divs_.size()-1)) {
+        auto stream_begin = sample_events_.size();
+        unsigned n_runs = 0;
+
+        auto e = sample_stream_divs_[intdom];
+        auto stream_end = sample_stream_divs_[intdom+1];
+        while (e!=stream_end) {
+            auto s = sample_streams_[e].sampler;
+            auto e_end = e;
+            while (e_end!=stream_end && sample_streams_[e_end].sampler==s) ++e_end;
+
+            const auto& ps = sampler_plan_[s];
+            sample_size_type n_times = ps.times.second-ps.times.first;
+            n_runs += n_times>0;
+
+            for (sample_size_type k = 0; k<n_times; ++k) {
+                for (auto j = e; j!=e_end; ++j) {
+                    auto i = sample_streams_[j].probe;
+                    const auto& p = ps.probes[i];
+
+                    sample_size_type offset = ps.offset+sample_size_type(i)*n_times+k;
+                    sample_size_type value_offset = ps.value_offset+p.value_index*n_times+k*p.width;
+                    sample_events_.push_back(sample_event{ps.times.first[k], (cell_gid_type)intdom, {p.handle, offset, value_offset, p.width}});
+                }
             }
+            e = e_end;
         }
-    }
 
-    // Sample events must be ordered by time for the lowered cell.
-    util::sort_by(sample_events, [](const sample_event& ev) { return event_time(ev); });
+        if (n_runs>1) {
+            std::sort(sample_events_.begin()+stream_begin, sample_events_.end(),
+                [](const sample_event& a, const sample_event& b) { return event_time(a)<event_time(b); });
+        }
+    }
     PL();
 
     // Run integration and collect samples, spikes.
-    auto result = lowered_->integrate(ep.tfinal, dt, staged_events_, std::move(sample_events));
+    auto result = lowered_->integrate(ep.tfinal, dt,
+        util::range_pointer_view(staged_events_), util::range_pointer_view(sample_events_));
 
-    // For each sampler callback registered in `call_info`, construct the
+    // For each probe of each sampler in the sampling plan, construct the
     // vector of sample entries from the lowered cell sample times and values
-    // and then call the callback.
+    // and then call the callback. Samples with more than one value are
+    // represented by a pointer to the first value.
 
     PE(advance_sampledeliver);
-    std::vector<sample_record> sample_records;
-    sample_records.reserve(max_samples_per_call);
+    sample_records_.reserve(max_samples_per_call);
 
-    for (auto& sc: call_info) {
-        sample_records.clear();
-        for (auto i = sc.begin_offset; i!=sc.end_offset; ++i) {
-           sample_records.push_back(sample_record{time_type(result.sample_time[i]), &result.sample_value[i]});
+    for (auto& ps: sampler_plan_) {
+        sample_size_type n_times = ps.times.second-ps.times.first;
+        if (!n_times) {
+            continue;
         }
 
-        sc.sampler(sc.probe_id, sc.tag, sc.end_offset-sc.begin_offset, sample_records.data());
+        for (auto i: util::count_along(ps.probes)) {
+            const auto& p = ps.probes[i];
+            auto begin_offset = ps.offset+i*n_times;
+            auto value_offset = ps.value_offset+p.value_index*n_times;
+
+            // Bulk samplers read the sample buffers in place.
+            if (ps.bulk_sampler) {
+                ps.bulk_sampler(p.probe_id, p.tag, n_times, &result.sample_time[begin_offset], &result.sample_value[value_offset]);
+                continue;
+            }
+
+            sample_records_.clear();
+            for (sample_size_type j = 0; j<n_times; ++j) {
+                sample_records_.push_back(sample_record{time_type(result.sample_time[begin_offset+j]), &result.sample_value[value_offset+j*p.width]});
+            }
+
+            ps.sampler(p.probe_id, p.tag, n_times, sample_records_.data());
+        }
     }
     PL();
 
@@ -216,23 +305,65 @@ void mc_cell_group::advance(epoch ep, time_type dt, const event_lane_subrange& e
     }
 }
 
-void mc_cell_group::add_sampler(sampler_association_handle h, cell_member_predicate probe_ids,
+void mc_cell_group::build_sampler_plan() {
+    sampler_plan_.clear();
+
+    std::vector<std::vector<sample_stream_entry>> intdom_streams(intdom_cell_divs_.size()-1);
+
+    for (auto& sa: sampler_map_) {
+        unsigned s = sampler_plan_.size();
+        planned_sampler ps{&sa.sched, sa.sampler, sa.bulk_sampler, {}, 0, {}, 0, 0};
+        ps.probes.reserve(sa.probe_ids.size());
+
+        for (cell_member_type pid: sa.probe_ids) {
+            auto intdom = cell_to_intdom_[gid_index_map_.at(pid.gid)];
+            const auto& p = probe_map_.at(pid);
+
+            intdom_streams[intdom].push_back({s, (unsigned)ps.probes.size()});
+            ps.probes.push_back({pid, p.tag, p.handle, p.width, ps.width});
+            ps.width += p.width;
+        }
+
+        sampler_plan_.push_back(std::move(ps));
+    }
+
+    sample_streams_.clear();
+    sample_stream_divs_.assign(1, 0);
+    for (auto& stream: intdom_streams) {
+        util::append(sample_streams_, stream);
+        sample_stream_divs_.push_back(sample_streams_.size());
+    }
+}
+
+void mc_cell_group::add_sampler_association(sampler_association_handle h, const probe_selector& probe_ids, sampler_association assoc) {
+    assoc.probe_ids = select_probes(probe_ids, sorted_probe_ids_);
+
+    if (!assoc.probe_ids.empty()) {
+        sampler_map_.add(h, std::move(assoc));
+        sampler_plan_valid_ = false;
+    }
+}
+
+void mc_cell_group::add_sampler(sampler_association_handle h, probe_selector probe_ids,
                                 schedule sched, sampler_function fn, sampling_policy policy)
 {
-    std::vector<cell_member_type> probeset =
-        util::assign_from(util::filter(util::keys(probe_map_), probe_ids));
+    add_sampler_association(h, probe_ids, sampler_association{std::move(sched), std::move(fn), {}, {}});
+}
 
-    if (!probeset.empty()) {
-        sampler_map_.add(h, sampler_association{std::move(sched), std::move(fn), std::move(probeset)});
-    }
+void mc_cell_group::add_sampler(sampler_association_handle h, probe_selector probe_ids,
+                                schedule sched, bulk_sampler_function fn, sampling_policy policy)
+{
+    add_sampler_association(h, probe_ids, sampler_association{std::move(sched), {}, {}, std::move(fn)});
 }
 
 void mc_cell_group::remove_sampler(sampler_association_handle h) {
     sampler_map_.remove(h);
+    sampler_plan_valid_ = false;
 }
 
 void mc_cell_group::remove_all_samplers() {
     sampler_map_.clear();
+    sampler_plan_valid_ = false;
 }
 
 } // namespace arb
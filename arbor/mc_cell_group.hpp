@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <iterator>
@@ -9,6 +10,7 @@
 #include <arbor/common_types.hpp>
 #include <arbor/recipe.hpp>
 #include <arbor/sampling.hpp>
+#include <arbor/schedule.hpp>
 #include <arbor/spike.hpp>
 
 #include "backends/event.hpp"
@@ -50,20 +52,44 @@ public:
         spikes_.clear();
     }
 
-    void add_sampler(sampler_association_handle h, cell_member_predicate probe_ids,
+    std::vector<gap_junction_connection> halo_junctions() const override {
+        return lowered_->halo_junctions();
+    }
+
+    void export_halo(std::vector<fvm_value_type>& values) const override {
+        lowered_->export_halo(values);
+    }
+
+    void import_halo(const std::vector<fvm_value_type>& values) override {
+        lowered_->import_halo(values);
+    }
+
+    void add_sampler(sampler_association_handle h, probe_selector probe_ids,
                      schedule sched, sampler_function fn, sampling_policy policy) override;
 
+    void add_sampler(sampler_association_handle h, probe_selector probe_ids,
+                     schedule sched, bulk_sampler_function fn, sampling_policy policy) override;
+
     void remove_sampler(sampler_association_handle h) override;
 
     void remove_all_samplers() override;
 
 private:
+    // Merge the event lanes of the cells in one integration domain into
+    // staged_events_, ordered by (binned) delivery time.
+    void stage_intdom_events(util::range<const cell_size_type*> cells, const event_lane_subrange& event_lanes, epoch ep, time_type tstart);
+
     // List of the gids of the cells in the group.
     std::vector<cell_gid_type> gids_;
 
     // Map from gid to integration domain id
     std::vector<fvm_index_type> cell_to_intdom_;
 
+    // Local cell indices sorted by integration domain, partitioned
+    // by intdom_cell_divs_ (computed once at construction).
+    std::vector<cell_size_type> idx_sorted_by_intdom_;
+    std::vector<cell_size_type> intdom_cell_divs_;
+
     // Hash table for converting gid to local index
     std::unordered_map<cell_gid_type, cell_gid_type> gid_index_map_;
 
@@ -82,8 +108,66 @@ private:
     // List of events to deliver
     std::vector<deliverable_event> staged_events_;
 
+    // Tournament tree state for merging event lanes within an integration
+    // domain: tree nodes hold lane indices; the lanes hold the read position
+    // and binned time of the next event of each participating cell.
+    struct lane_cursor {
+        const spike_event* it;
+        const spike_event* end;
+        time_type head;
+        cell_size_type lid;
+    };
+
+    std::vector<unsigned> merge_tree_;
+    std::vector<lane_cursor> merge_lanes_;
+
     // Pending samples to be taken.
-    event_queue<sample_event> sample_events_;
+    std::vector<sample_event> sample_events_;
+
+    // Sampling plan: the sampler associations resolved against probe
+    // handles and integration domains. The plan is rebuilt only after
+    // samplers are added or removed, or after a reset.
+    struct planned_probe {
+        cell_member_type probe_id;
+        probe_tag tag;
+        probe_handle handle;
+        sample_size_type width;       // Values per sample.
+        sample_size_type value_index; // Sum of widths of preceding probes in sampler.
+    };
+
+    struct planned_sampler {
+        schedule* sched;          // Non-owning; schedule held in sampler_map_.
+        sampler_function sampler;
+        bulk_sampler_function bulk_sampler;
+        std::vector<planned_probe> probes;
+
+        sample_size_type width;   // Sum of probe widths.
+
+        // Sample times in the current epoch, and the offsets of the first
+        // sample time and value in the lowered cell sample buffers. With n
+        // sample times, the times for probe i are stored contiguously from
+        // offset+i*n, and the values from value_offset+value_index*n.
+        time_event_span times;
+        sample_size_type offset;
+        sample_size_type value_offset;
+    };
+
+    // Entries in the per-intdom sample streams refer to a planned
+    // sampler and a probe therein; the streams are grouped by sampler.
+    struct sample_stream_entry {
+        unsigned sampler;
+        unsigned probe;
+    };
+
+    void build_sampler_plan();
+    void add_sampler_association(sampler_association_handle h, const probe_selector& probe_ids, sampler_association assoc);
+
+    std::vector<planned_sampler> sampler_plan_;
+    std::vector<sample_stream_entry> sample_streams_;
+    std::vector<unsigned> sample_stream_divs_; // Partitions sample_streams_ by intdom.
+    std::atomic<bool> sampler_plan_valid_{false};
+
+    std::vector<sample_record> sample_records_;
 
     // Handles for accessing lowered cell.
     std::vector<target_handle> target_handles_;
@@ -91,6 +175,9 @@ private:
     // Maps probe ids to probe handles (from lowered cell) and tags (from probe descriptions).
     probe_association_map<probe_handle> probe_map_;
 
+    // Probe ids in probe_map_, sorted for lookup by probe selectors.
+    std::vector<cell_member_type> sorted_probe_ids_;
+
     // Collection of samplers to be run against probes in this group.
     sampler_association_map sampler_map_;
 
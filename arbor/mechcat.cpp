@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -20,8 +24,9 @@
  *    for a specific backend that have been registered with
  *    register_impl().
  *
- *    It is a two-level map, first indexed by name, and then by the back-end
- *    type (using std::type_index).
+ *    It is a three-level map, first indexed by name, then by the back-end
+ *    type (using std::type_index), and then by the SIMD instruction set for
+ *    which the implementation was compiled.
  *
  * 2. info_map_
  *
@@ -47,7 +52,8 @@
  *
  * When an instance of the mechanism is requested from the catalogue, the
  * instance_impl_() function walks up the derivation tree to find the first
- * entry which has an associated implementation. It then accumulates the set of
+ * entry which has an associated implementation for an instruction set supported
+ * by the CPU, and takes the widest such. It then accumulates the set of
  * global parameter and ion overrides that need to be applied, starting from
  * the top-most (least-derived) ancestor and working down to the requested derived
  * mechanism.
@@ -67,6 +73,7 @@ using std::make_unique;
 using std::make_exception_ptr;
 
 using mechanism_info_ptr = std::unique_ptr<mechanism_info>;
+using isa_map = std::map<simd_isa, mechanism_ptr>;
 
 template <typename V>
 using string_map = std::unordered_map<std::string, V>;
@@ -136,9 +143,11 @@ struct catalogue_state {
 
         impl_map_.clear();
         for (const auto& name_impls: other.impl_map_) {
-            std::unordered_map<std::type_index, std::unique_ptr<mechanism>> impls;
-            for (const auto& tidx_mptr: name_impls.second) {
-                impls[tidx_mptr.first] = tidx_mptr.second->clone();
+            std::unordered_map<std::type_index, isa_map> impls;
+            for (const auto& tidx_impls: name_impls.second) {
+                for (const auto& isa_mptr: tidx_impls.second) {
+                    impls[tidx_impls.first][isa_mptr.first] = isa_mptr.second->clone();
+                }
             }
 
             impl_map_[name_impls.first] = std::move(impls);
@@ -165,14 +174,14 @@ struct catalogue_state {
         derived_map_[name] = std::move(deriv);
     }
 
-    // Register concrete mechanism for a back-end type.
-    hopefully<void> register_impl(std::type_index tidx, const std::string& name, std::unique_ptr<mechanism> mech) {
+    // Register concrete mechanism for a back-end type and instruction set.
+    hopefully<void> register_impl(std::type_index tidx, const std::string& name, std::unique_ptr<mechanism> mech, simd_isa isa) {
         if (auto fptr = fingerprint_ptr(name)) {
             if (mech->fingerprint()!=*fptr.first()) {
                 return make_exception_ptr(fingerprint_mismatch(name));
             }
 
-            impl_map_[name][tidx] = std::move(mech);
+            impl_map_[name][tidx][isa] = std::move(mech);
         }
         else {
             return fptr.second();
@@ -393,8 +402,10 @@ struct catalogue_state {
         return derive(name, base, global_params, ion_remap);
     }
 
-    // Retrieve implementation for this mechanism name or closest ancestor.
-    hopefully<std::unique_ptr<mechanism>> implementation(std::type_index tidx, const std::string& name) const {
+    // Retrieve implementation for this mechanism name or closest ancestor,
+    // compiled for the widest instruction set not wider than isa, together
+    // with that instruction set.
+    hopefully<std::pair<simd_isa, const mechanism*>> implementation(std::type_index tidx, const std::string& name, simd_isa isa) const {
         const std::string* impl_name = &name;
         hopefully<derivation> implicit_deriv;
 
@@ -409,7 +420,11 @@ struct catalogue_state {
         for (;;) {
             if (const auto mech_impls = value_by_key(impl_map_, *impl_name)) {
                 if (auto p = value_by_key(mech_impls.value(), tidx)) {
-                    return p->get()->clone();
+                    auto i = p->upper_bound(isa);
+                    if (i!=p->begin()) {
+                        --i;
+                        return std::pair<simd_isa, const mechanism*>(i->first, i->second.get());
+                    }
                 }
             }
 
@@ -484,10 +499,59 @@ struct catalogue_state {
     // Parent and global setting values for derived mechanisms.
     string_map<derivation> derived_map_;
 
-    // Prototype register, keyed on mechanism name, then backend type (index).
-    string_map<std::unordered_map<std::type_index, mechanism_ptr>> impl_map_;
+    // Prototype register, keyed on mechanism name, then backend type (index),
+    // then instruction set.
+    string_map<std::unordered_map<std::type_index, isa_map>> impl_map_;
 };
 
+std::ostream& operator<<(std::ostream& o, simd_isa isa) {
+    switch (isa) {
+    case simd_isa::none:
+        return o << "none";
+    case simd_isa::avx:
+        return o << "avx";
+    case simd_isa::avx2:
+        return o << "avx2";
+    case simd_isa::avx512:
+        return o << "avx512";
+    }
+    return o;
+}
+
+simd_isa runtime_simd_isa() {
+    simd_isa isa = simd_isa::none;
+
+    // The AVX2 and AVX-512 implementations are compiled with FMA enabled.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("fma")) {
+        isa = simd_isa::avx512;
+    }
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        isa = simd_isa::avx2;
+    }
+    else if (__builtin_cpu_supports("avx")) {
+        isa = simd_isa::avx;
+    }
+#endif
+
+    if (const char* str = std::getenv("ARB_SIMD_ISA")) {
+        const std::pair<const char*, simd_isa> names[] = {
+            {"none", simd_isa::none}, {"avx", simd_isa::avx},
+            {"avx2", simd_isa::avx2}, {"avx512", simd_isa::avx512}
+        };
+
+        auto i = std::find_if(std::begin(names), std::end(names),
+            [str](const auto& entry) { return !std::strcmp(entry.first, str); });
+        if (i==std::end(names)) {
+            throw arbor_exception("ARB_SIMD_ISA: unknown instruction set \""+std::string(str)+"\"");
+        }
+        isa = std::min(isa, i->second);
+    }
+
+    return isa;
+}
+
 // Mechanism catalogue method implementations.
 
 mechanism_catalogue::mechanism_catalogue():
@@ -543,18 +607,22 @@ void mechanism_catalogue::remove(const std::string& name) {
     state_->remove(name);
 }
 
-void mechanism_catalogue::register_impl(std::type_index tidx, const std::string& name, std::unique_ptr<mechanism> mech) {
-    value(state_->register_impl(tidx, name, std::move(mech)));
+void mechanism_catalogue::register_impl(std::type_index tidx, const std::string& name, std::unique_ptr<mechanism> mech, simd_isa isa) {
+    value(state_->register_impl(tidx, name, std::move(mech), isa));
 }
 
 std::pair<mechanism_ptr, mechanism_overrides> mechanism_catalogue::instance_impl(std::type_index tidx, const std::string& name) const {
     std::pair<mechanism_ptr, mechanism_overrides> result;
-    result.first = value(state_->implementation(tidx, name));
+    result.first = value(state_->implementation(tidx, name, runtime_simd_isa())).second->clone();
     result.second = value(state_->overrides(name));
 
     return result;
 }
 
+simd_isa mechanism_catalogue::instance_isa_impl(std::type_index tidx, const std::string& name) const {
+    return value(state_->implementation(tidx, name, runtime_simd_isa())).first;
+}
+
 mechanism_catalogue::~mechanism_catalogue() = default;
 
 } // namespace arb
@@ -76,10 +76,17 @@ domain_decomposition partition_load_balance(
     // Map to track visited cells (cells that already belong to a group)
     std::unordered_set<cell_gid_type> visited;
 
+    // Cells of kinds whose gap junctions may be split across cell groups
+    // are independent.
+    auto split_gap_junctions = [&](cell_kind k) {
+        auto opt_hint = util::value_by_key(hint_map, k);
+        return opt_hint && opt_hint.value().split_gap_junctions;
+    };
+
     // Connected components algorithm using BFS
     std::queue<cell_gid_type> q;
     for (auto gid: make_span(gid_part[domain_id])) {
-        if (!rec.gap_junctions_on(gid).empty()) {
+        if (!rec.gap_junctions_on(gid).empty() && !split_gap_junctions(rec.get_cell_kind(gid))) {
             // If cell hasn't been visited yet, must belong to new super_cell
             // Perform BFS starting from that cell
             if (!visited.count(gid)) {
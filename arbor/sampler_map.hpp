@@ -5,9 +5,12 @@
  * cell group classes (see sampling_api doc).
  */
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <arbor/common_types.hpp>
 #include <arbor/sampling.hpp>
@@ -20,10 +23,13 @@ namespace arb {
 // An association between a samplers, schedule, and set of probe ids, as provided
 // to e.g. `model::add_sampler()`.
 
+// Exactly one of `sampler` and `bulk_sampler` is set.
+
 struct sampler_association {
     schedule sched;
     sampler_function sampler;
     std::vector<cell_member_type> probe_ids;
+    bulk_sampler_function bulk_sampler;
 };
 
 // Maintain a set of associations paired with handles used for deletion.
@@ -67,9 +73,52 @@ struct probe_association {
     using probe_handle_type = Handle;
     probe_handle_type handle;
     probe_tag tag;
+    sample_size_type width = 1; // Number of values per sample.
 };
 
 template <typename Handle>
 using probe_association_map = std::unordered_map<cell_member_type, probe_association<Handle>>;
 
+// Select probe ids from a sorted sequence of probe ids. Structured selectors
+// are resolved by binary search; predicate selectors by testing every id.
+
+inline std::vector<cell_member_type> select_probes(const probe_selector& sel, const std::vector<cell_member_type>& sorted_ids) {
+    using kind = probe_selector::selector_kind;
+
+    auto first = sorted_ids.begin();
+    auto last = sorted_ids.end();
+    auto gid_lower = [&](cell_gid_type gid) {
+        return std::lower_bound(first, last, gid, [](cell_member_type x, cell_gid_type g) { return x.gid<g; });
+    };
+    auto gid_upper = [&](cell_gid_type gid) {
+        return std::upper_bound(first, last, gid, [](cell_gid_type g, cell_member_type x) { return g<x.gid; });
+    };
+
+    std::vector<cell_member_type> selected;
+    switch (sel.kind) {
+    case kind::all:
+        selected = sorted_ids;
+        break;
+    case kind::one:
+        if (std::binary_search(first, last, sel.id)) {
+            selected.push_back(sel.id);
+        }
+        break;
+    case kind::gid_range:
+        if (sel.gid_begin<sel.gid_end) {
+            selected.assign(gid_lower(sel.gid_begin), gid_lower(sel.gid_end));
+        }
+        break;
+    case kind::gid_set:
+        for (auto gid: sel.gids) {
+            selected.insert(selected.end(), gid_lower(gid), gid_upper(gid));
+        }
+        break;
+    case kind::predicate:
+        std::copy_if(first, last, std::back_inserter(selected), sel.pred);
+        break;
+    }
+    return selected;
+}
+
 } // namespace arb
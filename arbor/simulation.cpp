@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include <arbor/context.hpp>
@@ -12,6 +14,7 @@
 #include "cell_group.hpp"
 #include "cell_group_factory.hpp"
 #include "communication/communicator.hpp"
+#include "communication/halo_exchange.hpp"
 #include "execution_context.hpp"
 #include "merge_events.hpp"
 #include "thread_private_spike_store.hpp"
@@ -20,6 +23,7 @@
 #include "util/filter.hpp"
 #include "util/maputil.hpp"
 #include "util/partition.hpp"
+#include "util/rangeutil.hpp"
 #include "util/span.hpp"
 #include "profile/profiler_macro.hpp"
 
@@ -57,8 +61,10 @@ public:
 
     time_type run(time_type tfinal, time_type dt);
 
-    sampler_association_handle add_sampler(cell_member_predicate probe_ids,
-        schedule sched, sampler_function f, sampling_policy policy = sampling_policy::lax);
+    // SamplerFn is one of sampler_function or bulk_sampler_function.
+    template <typename SamplerFn>
+    sampler_association_handle add_sampler(probe_selector probe_ids,
+        schedule sched, SamplerFn f, sampling_policy policy = sampling_policy::lax);
 
     void remove_sampler(sampler_association_handle);
 
@@ -70,6 +76,10 @@ public:
 
     void set_binning_policy(binning_kind policy, time_type bin_interval);
 
+    void set_gap_junction_interval(time_type interval) {
+        halo_interval_ = interval;
+    }
+
     void inject_events(const pse_vector& events);
 
     spike_export_function global_export_callback_;
@@ -99,8 +109,18 @@ private:
     // Hash table for looking up the the local index of a cell with a given gid
     std::unordered_map<cell_gid_type, cell_size_type> gid_to_local_;
 
+    // (gid, cell group index) pairs for local cells, sorted by gid.
+    std::vector<std::pair<cell_gid_type, cell_size_type>> gid_to_group_;
+
     communicator communicator_;
 
+    // Voltages at the sites of gap junctions between cell groups are
+    // exchanged every halo_interval_, or every step if zero. Groups without
+    // such gap junctions are listed in other_groups_.
+    halo_exchange halo_;
+    time_type halo_interval_ = 0;
+    std::vector<cell_size_type> other_groups_;
+
     task_system_handle task_system_;
 
     // Pending events to be delivered.
@@ -146,16 +166,21 @@ simulation_state::simulation_state(
 
     event_generators_.resize(num_local_cells);
     cell_local_size_type lidx = 0;
+    cell_size_type grpidx = 0;
+    gid_to_group_.reserve(num_local_cells);
     for (const auto& group_info: decomp.groups) {
         for (auto gid: group_info.gids) {
-            // Store mapping of gid to local cell index.
+            // Store mapping of gid to local cell index and cell group.
             gid_to_local_[gid] = lidx;
+            gid_to_group_.push_back({gid, grpidx});
 
             // Set up the event generators for cell gid.
             event_generators_[lidx] = rec.event_generators(gid);
             ++lidx;
         }
+        ++grpidx;
     }
+    util::sort(gid_to_group_);
 
     // Generate the cell groups in parallel, with one task per cell group.
     cell_groups_.resize(decomp.groups.size());
@@ -166,6 +191,13 @@ simulation_state::simulation_state(
             group = factory(group_info.gids, rec);
         });
 
+    halo_ = halo_exchange(cell_groups_, ctx);
+    for (auto i: util::count_along(cell_groups_)) {
+        if (!util::binary_search_index(halo_.groups(), i)) {
+            other_groups_.push_back(i);
+        }
+    }
+
     // Create event lane buffers.
     // There is one set for each epoch: current (0) and next (1).
     // For each epoch there is one lane for each cell in the cell group.
@@ -212,18 +244,41 @@ time_type simulation_state::run(time_type tfinal, time_type dt) {
     // to overlap communication and computation.
     const time_type t_interval = min_delay_/2;
 
+    // Advance cell group i to the end of ep, which may end before the
+    // current epoch.
+    auto advance_group = [&](cell_size_type i, epoch ep) {
+        auto& group = cell_groups_[i];
+        auto queues = util::subrange_view(event_lanes(epoch_.id), communicator_.group_queue_range(i));
+        group->advance(ep, dt, queues);
+
+        PE(advance_spikes);
+        local_spikes_->current().insert(group->spikes());
+        group->clear_spikes();
+        PL();
+    };
+
     // task that updates cell state in parallel.
     auto update_cells = [&] () {
         foreach_group_index(
-            [&](cell_group_ptr& group, int i) {
-                auto queues = util::subrange_view(event_lanes(epoch_.id), communicator_.group_queue_range(i));
-                group->advance(epoch_, dt, queues);
-
-                PE(advance_spikes);
-                local_spikes_->current().insert(group->spikes());
-                group->clear_spikes();
-                PL();
-            });
+            [&](cell_group_ptr&, int i) { advance_group(i, epoch_); });
+    };
+
+    // With gap junctions between cell groups, the groups with halo
+    // junctions are advanced through the epoch in steps of the halo
+    // interval, with a halo exchange before each step.
+    auto update_cells_halo = [&] () {
+        threading::parallel_for::apply(0, other_groups_.size(), task_system_.get(),
+            [&](int k) { advance_group(other_groups_[k], epoch_); });
+
+        const auto& groups = halo_.groups();
+        const time_type interval = halo_interval_>0? halo_interval_: dt;
+        for (time_type t = t_; t<epoch_.tfinal; ) {
+            t = std::min(t+interval, epoch_.tfinal);
+            halo_.exchange(cell_groups_);
+
+            threading::parallel_for::apply(0, groups.size(), task_system_.get(),
+                [&](int k) { advance_group(groups[k], epoch(epoch_.id, t)); });
+        }
     };
 
     // task that performs spike exchange with the spikes generated in
@@ -265,11 +320,19 @@ time_type simulation_state::run(time_type tfinal, time_type dt) {
         local_spikes_->current().clear();
 
         // run the tasks, overlapping if the threading model and number of
-        // available threads permits it.
-        threading::task_group g(task_system_.get());
-        g.run(exchange);
-        g.run(update_cells);
-        g.wait();
+        // available threads permits it. The halo exchange is collective, as
+        // is the spike exchange, so with gap junctions between cell groups
+        // the two are not overlapped.
+        if (halo_.empty()) {
+            threading::task_group g(task_system_.get());
+            g.run(exchange);
+            g.run(update_cells);
+            g.wait();
+        }
+        else {
+            exchange();
+            update_cells_halo();
+        }
 
         t_ = tuntil;
 
@@ -369,16 +432,53 @@ void simulation_state::setup_events(time_type t_from, time_type t_to, std::size_
             });
 }
 
+template <typename SamplerFn>
 sampler_association_handle simulation_state::add_sampler(
-        cell_member_predicate probe_ids,
+        probe_selector probe_ids,
         schedule sched,
-        sampler_function f,
+        SamplerFn f,
         sampling_policy policy)
 {
     sampler_association_handle h = sassoc_handles_.acquire();
 
-    foreach_group(
-        [&](cell_group_ptr& group) { group->add_sampler(h, probe_ids, sched, f, policy); });
+    if (!probe_ids.is_gid_indexed()) {
+        foreach_group(
+            [&](cell_group_ptr& group) { group->add_sampler(h, probe_ids, sched, f, policy); });
+
+        return h;
+    }
+
+    // Pass the sampler only to the cell groups that own the selected gids.
+    using kind = probe_selector::selector_kind;
+
+    std::vector<cell_size_type> groups;
+    auto add_groups = [&](cell_gid_type gid_begin, cell_gid_type gid_end) {
+        auto by_gid = [](const std::pair<cell_gid_type, cell_size_type>& x, cell_gid_type gid) { return x.first<gid; };
+        auto i = std::lower_bound(gid_to_group_.begin(), gid_to_group_.end(), gid_begin, by_gid);
+        for (; i!=gid_to_group_.end() && i->first<gid_end; ++i) {
+            groups.push_back(i->second);
+        }
+    };
+
+    switch (probe_ids.kind) {
+    case kind::one:
+        add_groups(probe_ids.id.gid, probe_ids.id.gid+1);
+        break;
+    case kind::gid_range:
+        add_groups(probe_ids.gid_begin, probe_ids.gid_end);
+        break;
+    case kind::gid_set:
+        for (auto gid: probe_ids.gids) {
+            add_groups(gid, gid+1);
+        }
+        break;
+    default: ;
+    }
+    util::sort(groups);
+    groups.erase(std::unique(groups.begin(), groups.end()), groups.end());
+
+    threading::parallel_for::apply(0, groups.size(), task_system_.get(),
+        [&](int i) { cell_groups_[groups[i]]->add_sampler(h, probe_ids, sched, f, policy); });
 
     return h;
 }
@@ -435,7 +535,7 @@ time_type simulation::run(time_type tfinal, time_type dt) {
 }
 
 sampler_association_handle simulation::add_sampler(
-    cell_member_predicate probe_ids,
+    probe_selector probe_ids,
     schedule sched,
     sampler_function f,
     sampling_policy policy)
@@ -443,6 +543,15 @@ sampler_association_handle simulation::add_sampler(
     return impl_->add_sampler(std::move(probe_ids), std::move(sched), std::move(f), policy);
 }
 
+sampler_association_handle simulation::add_sampler(
+    probe_selector probe_ids,
+    schedule sched,
+    bulk_sampler_function f,
+    sampling_policy policy)
+{
+    return impl_->add_sampler(std::move(probe_ids), std::move(sched), std::move(f), policy);
+}
+
 void simulation::remove_sampler(sampler_association_handle h) {
     impl_->remove_sampler(h);
 }
@@ -459,6 +568,10 @@ void simulation::set_binning_policy(binning_kind policy, time_type bin_interval)
     impl_->set_binning_policy(policy, bin_interval);
 }
 
+void simulation::set_gap_junction_interval(time_type interval) {
+    impl_->set_gap_junction_interval(interval);
+}
+
 void simulation::set_global_spike_callback(spike_export_function export_callback) {
     impl_->global_export_callback_ = std::move(export_callback);
 }
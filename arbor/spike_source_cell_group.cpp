@@ -62,7 +62,11 @@ void spike_source_cell_group::clear_spikes() {
     spikes_.clear();
 }
 
-void spike_source_cell_group::add_sampler(sampler_association_handle, cell_member_predicate, schedule, sampler_function, sampling_policy) {
+void spike_source_cell_group::add_sampler(sampler_association_handle, probe_selector, schedule, sampler_function, sampling_policy) {
+    std::logic_error("A spike_source_cell group doen't support sampling of internal state!");
+}
+
+void spike_source_cell_group::add_sampler(sampler_association_handle, probe_selector, schedule, bulk_sampler_function, sampling_policy) {
     std::logic_error("A spike_source_cell group doen't support sampling of internal state!");
 }
 
@@ -504,6 +504,8 @@ std::string ProcedureExpression::to_string() const {
     str += blue("  args") + "    : ";
     for(auto& arg : args_)
         str += arg->to_string() + " ";
+    if(table_)
+        str += "\n  "+blue("table")+" : "+table_->to_string();
     str += "\n  "+blue("body")+" :";
     str += body_->to_string();
 
@@ -818,6 +820,34 @@ expression_ptr ConductanceExpression::clone() const {
     return expression_ptr{s};
 }
 
+/*******************************************************************************
+  TableExpression
+*******************************************************************************/
+
+std::string TableExpression::to_string() const {
+    auto names = [](const std::vector<std::string>& v) {
+        std::string str;
+        for (auto& n: v) {
+            str += (str.empty()? "": ", ") + yellow(n);
+        }
+        return str;
+    };
+
+    return blue("table") + "(" + names(vars_) + "; " + blue("depend") + " " + names(depend_)
+        + "; " + pprintf("% to % with %", from_, to_, n_) + ")";
+}
+
+void TableExpression::semantic(scope_ptr scp) {
+    scope_ = scp;
+    // The parser moves TABLE statements out of the body of a procedure;
+    // anywhere else they are misplaced.
+    error("TABLE statements are only allowed at the top level of a PROCEDURE");
+}
+
+expression_ptr TableExpression::clone() const {
+    return make_expression<TableExpression>(location_, vars_, depend_, from_, to_, n_);
+}
+
 /*******************************************************************************
   BlockExpression
 *******************************************************************************/
@@ -942,6 +972,9 @@ void SolveExpression::accept(Visitor *v) {
 void ConductanceExpression::accept(Visitor *v) {
     v->visit(this);
 }
+void TableExpression::accept(Visitor *v) {
+    v->visit(this);
+}
 void DerivativeExpression::accept(Visitor *v) {
     v->visit(this);
 }
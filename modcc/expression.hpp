@@ -43,6 +43,7 @@ class InitialBlock;
 class SolveExpression;
 class Symbol;
 class ConductanceExpression;
+class TableExpression;
 class PDiffExpression;
 class VariableExpression;
 class ProcedureExpression;
@@ -186,6 +187,7 @@ public:
     virtual SolveExpression*       is_solve_statement()   {return nullptr;}
     virtual Symbol*                is_symbol()            {return nullptr;}
     virtual ConductanceExpression* is_conductance_statement() {return nullptr;}
+    virtual TableExpression*       is_table_statement()   {return nullptr;}
     virtual PDiffExpression*       is_pdiff()             {return nullptr;}
 
     virtual bool is_lvalue() const {return false;}
@@ -721,6 +723,66 @@ private:
     std::string ion_channel_;
 };
 
+// a TABLE statement
+//
+// The parser moves the statement from the body of a PROCEDURE to the procedure
+// itself: the listed variables are then tabulated as functions of the first
+// argument of the procedure at n+1 equally spaced points in [from, to].
+// The variables are resolved against the module symbols by Module::semantic().
+class TableExpression : public Expression {
+public:
+    TableExpression(
+            Location loc,
+            std::vector<std::string> vars,
+            std::vector<std::string> depend,
+            double from,
+            double to,
+            int n)
+    :   Expression(loc), vars_(std::move(vars)), depend_(std::move(depend)),
+        from_(from), to_(to), n_(n)
+    {}
+
+    std::string to_string() const override;
+
+    std::vector<std::string> const& vars() const { return vars_; }
+    std::vector<std::string> const& depend() const { return depend_; }
+    double from() const { return from_; }
+    double to() const { return to_; }
+    int n() const { return n_; }
+
+    // Tabulated range variables.
+    std::vector<VariableExpression*>& outputs() { return outputs_; }
+
+    // Range and indexed variables that must have the same value in every
+    // instance for the table to be used.
+    std::vector<Symbol*>& uniform() { return uniform_; }
+
+    // Module variables passed as the second and later arguments at every
+    // call site of the procedure.
+    std::vector<Symbol*>& arguments() { return arguments_; }
+
+    TableExpression* is_table_statement() override {
+        return this;
+    }
+
+    expression_ptr clone() const override;
+
+    void semantic(scope_ptr scp) override;
+    void accept(Visitor *v) override;
+
+    ~TableExpression() {}
+private:
+    std::vector<std::string> vars_;
+    std::vector<std::string> depend_;
+    double from_;
+    double to_;
+    int n_;
+
+    std::vector<VariableExpression*> outputs_;
+    std::vector<Symbol*> uniform_;
+    std::vector<Symbol*> arguments_;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // recursive if statement
 // requires a BlockExpression that is a simple wrapper around a std::list
@@ -1051,11 +1113,20 @@ public:
     /// from a special block, e.g. BREAKPOINT, INITIAL, NET_RECEIVE, etc
     procedureKind kind() const {return kind_;}
 
+    /// the TABLE statement of the procedure, if any
+    TableExpression* table() {
+        return table_? table_->is_table_statement(): nullptr;
+    }
+    void table(expression_ptr&& t) {
+        table_ = std::move(t);
+    }
+
 protected:
     Symbol* symbol_;
 
     std::vector<expression_ptr> args_;
     expression_ptr body_;
+    expression_ptr table_;
     procedureKind kind_ = procedureKind::normal;
 };
 
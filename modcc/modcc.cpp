@@ -68,6 +68,7 @@ struct Options {
     std::string modulename;
     bool verbose = true;
     bool analysis = false;
+    bool tables = false;
     std::unordered_set<targetKind> targets;
 };
 
@@ -100,7 +101,8 @@ std::ostream& operator<<(std::ostream& out, const Options& opt) {
         table_prefix{"output"} << (opt.outprefix.empty()? "-": opt.outprefix) << line_end <<
         table_prefix{"verbose"} << noyes[opt.verbose] << line_end <<
         table_prefix{"targets"} << targets << line_end <<
-        table_prefix{"analysis"} << noyes[opt.analysis] << line_end;
+        table_prefix{"analysis"} << noyes[opt.analysis] << line_end <<
+        table_prefix{"tables"} << noyes[opt.tables] << line_end;
 }
 
 std::ostream& operator<<(std::ostream& out, const printer_options& popt) {
@@ -110,6 +112,7 @@ std::ostream& operator<<(std::ostream& out, const printer_options& popt) {
     return out <<
         table_prefix{"namespace"} << popt.cpp_namespace << line_end <<
         table_prefix{"profile"} << noyes[popt.profile] << line_end <<
+        table_prefix{"single state"} << noyes[popt.single_state] << line_end <<
         table_prefix{"simd"} << popt.simd << line_end;
 }
 
@@ -188,6 +191,10 @@ int main(int argc, char **argv) {
 
         TCLAP::SwitchArg profile_arg("P","profile","build with profiled kernels", cmd, false);
 
+        TCLAP::SwitchArg single_state_arg("f","single-state","store STATE and ASSIGNED variables in single precision (cpu target)", cmd, false);
+
+        TCLAP::SwitchArg tables_arg("T","tables","tabulate the procedures without a TABLE statement over the voltage where possible (cpu target)", cmd, false);
+
         TCLAP::SwitchArg verbose_arg("V","verbose","toggle verbose mode", cmd, false);
 
         TCLAP::SwitchArg analysis_arg("A","analyse","toggle analysis mode", cmd, false);
@@ -202,9 +209,11 @@ int main(int argc, char **argv) {
         opt.modulename = module_arg.getValue();
         opt.verbose = verbose_arg.getValue();
         opt.analysis = analysis_arg.getValue();
+        opt.tables = tables_arg.getValue();
 
         popt.cpp_namespace = namespace_arg.getValue();
         popt.profile = profile_arg.getValue();
+        popt.single_state = single_state_arg.getValue();
 
         if (simd_arg.getValue()) {
             popt.simd = simd_spec(simd_spec::native);
@@ -247,6 +256,7 @@ int main(int argc, char **argv) {
         if (!opt.modulename.empty()) {
             m.module_name(opt.modulename);
         }
+        m.default_tables(opt.tables);
 
         // Perform parsing and semantic analysis passes.
 
@@ -5,6 +5,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "errorvisitor.hpp"
@@ -136,6 +137,73 @@ void Module::add_callable(symbol_ptr callable) {
     callables_.push_back(std::move(callable));
 }
 
+// Collect the symbols assigned to and read in a procedure body, and the
+// procedure calls it makes.
+class TableVariableCollector: public Visitor {
+public:
+    std::vector<Symbol*> written;
+    std::vector<Symbol*> read;
+    std::vector<CallExpression*> calls;
+
+    void visit(Expression* e) override {}
+
+    void visit(IdentifierExpression* e) override {
+        add(read, e->symbol());
+    }
+
+    void visit(UnaryExpression* e) override {
+        e->expression()->accept(this);
+    }
+
+    void visit(BinaryExpression* e) override {
+        e->lhs()->accept(this);
+        e->rhs()->accept(this);
+    }
+
+    void visit(AssignmentExpression* e) override {
+        if (auto id = e->lhs()->is_identifier()) {
+            add(written, id->symbol());
+        }
+        e->rhs()->accept(this);
+    }
+
+    void visit(CallExpression* e) override {
+        calls.push_back(e);
+        for (auto& arg: e->args()) {
+            arg->accept(this);
+        }
+    }
+
+    void visit(IfExpression* e) override {
+        e->condition()->accept(this);
+        e->true_branch()->accept(this);
+        if (e->false_branch()) {
+            e->false_branch()->accept(this);
+        }
+    }
+
+    void visit(BlockExpression* e) override {
+        for (auto& stmt: e->statements()) {
+            stmt->accept(this);
+        }
+    }
+
+    void visit(ProcedureExpression* e) override {
+        e->body()->accept(this);
+    }
+
+    void visit(APIMethod* e) override {
+        e->body()->accept(this);
+    }
+
+private:
+    static void add(std::vector<Symbol*>& v, Symbol* s) {
+        if (s && std::find(v.begin(), v.end(), s)==v.end()) {
+            v.push_back(s);
+        }
+    }
+};
+
 bool Module::semantic() {
     ////////////////////////////////////////////////////////////////////////////
     // create the symbol table
@@ -515,6 +583,8 @@ bool Module::semantic() {
     // in order to inline calls inside the newly crated API methods.
     semantic_func_proc();
 
+    check_tables();
+
     return !has_error();
 }
 
@@ -900,3 +970,213 @@ void Module::check_revpot_mechanism() {
 }
 
 
+
+// Tables depend only upon parameters and the temperature or diameter,
+// which are fixed by the time nrn_init() is called.
+static bool is_fixed(Symbol* s) {
+    if (auto v = s->is_variable()) {
+        return !v->is_state() && !v->is_writeable();
+    }
+    if (auto i = s->is_indexed_variable()) {
+        return i->data_source()==sourceKind::temperature || i->data_source()==sourceKind::diameter;
+    }
+    return false;
+}
+
+// Resolve the variables of the TABLE of the procedure `proc` with the given
+// call sites and DEPEND variables, returning a description of the first
+// problem found, if any.
+// With `is_default` set, the table was not given explicitly: every variable
+// the procedure assigns is tabulated, and every parameter it depends upon is
+// implicitly in DEPEND.
+static std::string resolve_table(
+    ProcedureExpression* proc,
+    const std::vector<CallExpression*>& calls,
+    const std::vector<Symbol*>& depend,
+    bool is_default)
+{
+    auto table = proc->table();
+    auto name = yellow(proc->name());
+    auto& args = proc->args();
+
+    if (args.empty()) {
+        return pprintf("a tabulated procedure requires an argument: '%'", name);
+    }
+    if (calls.empty()) {
+        return pprintf("tabulated procedure '%' is never called", name);
+    }
+
+    TableVariableCollector body;
+    proc->body()->accept(&body);
+
+    if (!body.calls.empty()) {
+        return pprintf("tabulated procedure '%' can't call other procedures", name);
+    }
+
+    auto is_scalar = [](Symbol* s) {
+        return s->is_variable() && s->is_variable()->is_scalar();
+    };
+
+    auto in_depend = [&](Symbol* s) {
+        auto& d = table->depend();
+        return is_default || std::find(d.begin(), d.end(), s->name())!=d.end();
+    };
+
+    auto add_uniform = [table](Symbol* s) {
+        auto& u = table->uniform();
+        if (std::find(u.begin(), u.end(), s)==u.end()) {
+            u.push_back(s);
+        }
+    };
+
+    for (auto s: depend) {
+        if (!is_fixed(s)) {
+            return pprintf("DEPEND variable '%' is not a parameter", yellow(s->name()));
+        }
+        if (!is_scalar(s)) add_uniform(s);
+    }
+
+    for (auto s: body.written) {
+        if (s->is_local_variable()) continue;
+
+        auto v = s->is_variable();
+        if (!v || !v->is_range() || v->is_state()) {
+            return pprintf("tabulated procedure '%' can only assign to ASSIGNED range variables, not '%'", name, yellow(s->name()));
+        }
+        table->outputs().push_back(v);
+    }
+    if (table->outputs().empty()) {
+        return pprintf("tabulated procedure '%' assigns no range variables", name);
+    }
+
+    if (!is_default) {
+        auto& outputs = table->outputs();
+        auto is_output = [&outputs](const std::string& n) {
+            return std::any_of(outputs.begin(), outputs.end(), [&n](VariableExpression* v) { return v->name()==n; });
+        };
+        for (auto& n: table->vars()) {
+            if (!is_output(n)) {
+                return pprintf("TABLE variable '%' is not assigned in procedure '%'", yellow(n), name);
+            }
+        }
+        for (auto v: outputs) {
+            auto& vars = table->vars();
+            if (std::find(vars.begin(), vars.end(), v->name())==vars.end()) {
+                return pprintf("'%' is assigned in procedure '%', but is not listed in its TABLE", yellow(v->name()), name);
+            }
+        }
+    }
+
+    for (auto s: body.read) {
+        if (s->is_local_variable()) continue;
+        if (s->is_variable() && std::find(table->outputs().begin(), table->outputs().end(), s->is_variable())!=table->outputs().end()) continue;
+
+        if (!is_fixed(s)) {
+            return pprintf("tabulated procedure '%' depends on '%', which is not a parameter", name, yellow(s->name()));
+        }
+        if (is_scalar(s)) continue;
+
+        if (!in_depend(s)) {
+            return pprintf("'%' must be listed in the DEPEND of the TABLE in procedure '%'", yellow(s->name()), name);
+        }
+        add_uniform(s);
+    }
+
+    // The module variable passed as an argument at a call site, if any.
+    auto bound_variable = [](Expression* arg) -> Symbol* {
+        auto id = arg->is_identifier();
+        Symbol* s = id? id->symbol(): nullptr;
+        if (s && s->is_local_variable()) {
+            s = s->is_local_variable()->external_variable();
+        }
+        return s;
+    };
+
+    for (auto call: calls) {
+        if (call->args().size()!=args.size()) {
+            return pprintf("wrong number of arguments in call to tabulated procedure '%'", name);
+        }
+        if (is_default) {
+            auto s = bound_variable(call->args()[0].get());
+            auto i = s? s->is_indexed_variable(): nullptr;
+            if (!i || i->data_source()!=sourceKind::voltage) {
+                return pprintf("the first argument of procedure '%' is not the membrane voltage", name);
+            }
+        }
+    }
+
+    for (unsigned k = 1; k<args.size(); ++k) {
+        Symbol* bound = nullptr;
+        for (auto call: calls) {
+            auto s = bound_variable(call->args()[k].get());
+            if (!s || !is_fixed(s) || (bound && s!=bound)) {
+                return pprintf("argument '%' of tabulated procedure '%' must be the same parameter at every call",
+                    yellow(args[k]->is_argument()->name()), name);
+            }
+            bound = s;
+        }
+        if (!is_scalar(bound)) {
+            if (!in_depend(bound)) {
+                return pprintf("'%' must be listed in the DEPEND of the TABLE in procedure '%'", yellow(bound->name()), name);
+            }
+            add_uniform(bound);
+        }
+        table->arguments().push_back(bound);
+    }
+
+    return "";
+}
+
+void Module::check_tables() {
+    // Voltage range and intervals of tables added by default_tables().
+    constexpr double default_from = -100;
+    constexpr double default_to = 100;
+    constexpr int default_n = 200;
+
+    // Call sites of each procedure.
+    std::unordered_map<std::string, std::vector<CallExpression*>> calls;
+    for (auto& e: symbols_) {
+        if (auto proc = e.second->is_procedure()) {
+            TableVariableCollector c;
+            proc->accept(&c);
+            for (auto call: c.calls) {
+                calls[call->name()].push_back(call);
+            }
+        }
+    }
+
+    for (auto& e: symbols_) {
+        auto proc = e.second->is_procedure();
+        if (!proc || proc->kind()!=procedureKind::normal) continue;
+
+        bool is_default = !proc->table();
+        std::vector<Symbol*> depend;
+        if (is_default) {
+            if (!default_tables_) continue;
+
+            proc->table(make_expression<TableExpression>(proc->location(),
+                std::vector<std::string>{}, std::vector<std::string>{},
+                default_from, default_to, default_n));
+        }
+        else {
+            for (auto& name: proc->table()->depend()) {
+                if (!symbols_.count(name)) {
+                    error(pprintf("unknown DEPEND variable '%'", yellow(name)), proc->table()->location());
+                    return;
+                }
+                depend.push_back(symbols_[name].get());
+            }
+        }
+
+        auto msg = resolve_table(proc, calls[proc->name()], depend, is_default);
+        if (!msg.empty()) {
+            if (is_default) {
+                // Not eligible: keep the exact procedure.
+                proc->table(nullptr);
+            }
+            else {
+                error(msg, proc->table()->location());
+            }
+        }
+    }
+}
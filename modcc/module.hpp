@@ -105,6 +105,11 @@ public:
 
     bool is_linear() const { return linear_; }
 
+    // Tabulate eligible procedures that have no TABLE statement?
+    // Set before semantic().
+    void default_tables(bool t) { default_tables_ = t; }
+    bool default_tables() const { return default_tables_; }
+
 private:
     moduleKind kind_;
     std::string title_;
@@ -118,6 +123,7 @@ private:
     ParameterBlock parameter_block_;
     AssignedBlock assigned_block_;
     bool linear_;
+    bool default_tables_ = false;
 
     // AST storage.
     std::vector<symbol_ptr> callables_;
@@ -142,6 +148,10 @@ private:
     // Check requirements for reversal potential setters.
     void check_revpot_mechanism();
 
+    // Resolve the variables of TABLE statements, and add a table to each
+    // eligible procedure without one if default_tables() is set.
+    void check_tables();
+
     // Perform semantic analysis on functions and procedures.
     // Returns the number of errors that were encountered.
     int semantic_func_proc();
@@ -946,10 +946,34 @@ symbol_ptr Parser::parse_procedure() {
     expression_ptr body = parse_block(false);
     if(body==nullptr) return nullptr;
 
+    // move a TABLE statement from the body to the procedure
+    expression_ptr table;
+    auto& stmts = body->is_block()->statements();
+    for (auto it = stmts.begin(); it!=stmts.end();) {
+        if (!(*it)->is_table_statement()) {
+            ++it;
+            continue;
+        }
+        if (kind != procedureKind::normal) {
+            error("TABLE statements are only allowed in a PROCEDURE", (*it)->location());
+            return nullptr;
+        }
+        if (table) {
+            error("a PROCEDURE can have only one TABLE statement", (*it)->location());
+            return nullptr;
+        }
+        table = std::move(*it);
+        it = stmts.erase(it);
+    }
+
     auto proto = p->is_prototype();
     if(kind != procedureKind::net_receive) {
-        return make_symbol<ProcedureExpression>
+        auto proc = make_symbol<ProcedureExpression>
             (proto->location(), proto->name(), std::move(proto->args()), std::move(body), kind);
+        if (table) {
+            proc->is_procedure()->table(std::move(table));
+        }
+        return proc;
     }
     else {
         return make_symbol<NetReceiveExpression>
@@ -976,6 +1000,14 @@ symbol_ptr Parser::parse_function() {
     auto body = parse_block(false);
     if(body==nullptr) return nullptr;
 
+    // functions are inlined at their call sites, and can't be tabulated
+    for (auto& e: body->is_block()->statements()) {
+        if (e->is_table_statement()) {
+            error("TABLE statements are only allowed in a PROCEDURE", e->location());
+            return nullptr;
+        }
+    }
+
     PrototypeExpression *proto = p->is_prototype();
     return make_symbol<FunctionExpression>
         (proto->location(), proto->name(), std::move(proto->args()), std::move(body));
@@ -1002,6 +1034,8 @@ expression_ptr Parser::parse_statement() {
             return parse_conserve_expression();
         case tok::compartment :
             return parse_compartment_statement();
+        case tok::table :
+            return parse_table_statement();
         case tok::tilde :
             return parse_tilde_expression();
         case tok::initial :
@@ -1788,3 +1822,65 @@ expression_ptr Parser::parse_compartment_statement() {
     get_token(); // consume the rbrace
     return make_expression<CompartmentExpression>(here, std::move(scale_factor), std::move(states));
 }
+
+/*
+  TABLE minf, mtau DEPEND celsius FROM -100 TO 100 WITH 200
+*/
+expression_ptr Parser::parse_table_statement() {
+    auto here = location_;
+
+    if(token_.type!=tok::table) {
+        error(pprintf("expected '%', found '%'", yellow("TABLE"), yellow(token_.spelling)));
+        return nullptr;
+    }
+
+    std::vector<std::string> vars, depend;
+
+    // comma_separated_identifiers() consumes 'TABLE' and the list
+    for (auto& t: comma_separated_identifiers()) vars.push_back(t.spelling);
+    if (status_==lexerStatus::error) return nullptr;
+    if (vars.empty()) {
+        error("TABLE statement requires a list of variables");
+        return nullptr;
+    }
+
+    if (token_.type==tok::depend) {
+        for (auto& t: comma_separated_identifiers()) depend.push_back(t.spelling);
+        if (status_==lexerStatus::error) return nullptr;
+        if (depend.empty()) {
+            error("DEPEND requires a list of variables");
+            return nullptr;
+        }
+    }
+
+    if(token_.type != tok::from) {
+        error(pprintf("expected '%', found '%'", yellow("FROM"), yellow(token_.spelling)));
+        return nullptr;
+    }
+    get_token(); // consume 'FROM'
+    auto from = value_literal();
+    if (from.empty()) return nullptr;
+
+    if(token_.type != tok::to) {
+        error(pprintf("expected '%', found '%'", yellow("TO"), yellow(token_.spelling)));
+        return nullptr;
+    }
+    get_token(); // consume 'TO'
+    auto to = value_literal();
+    if (to.empty()) return nullptr;
+
+    if(token_.type != tok::with) {
+        error(pprintf("expected '%', found '%'", yellow("WITH"), yellow(token_.spelling)));
+        return nullptr;
+    }
+    get_token(); // consume 'WITH'
+    int n = value_signed_integer();
+    if (status_==lexerStatus::error) return nullptr;
+
+    if (!(std::stod(from)<std::stod(to)) || n<1) {
+        error("TABLE requires FROM < TO and at least one interval in WITH", here);
+        return nullptr;
+    }
+
+    return make_expression<TableExpression>(here, std::move(vars), std::move(depend), std::stod(from), std::stod(to), n);
+}
@@ -39,6 +39,7 @@ public:
     expression_ptr parse_block(bool);
     expression_ptr parse_initial();
     expression_ptr parse_compartment_statement();
+    expression_ptr parse_table_statement();
     expression_ptr parse_if();
 
     symbol_ptr parse_procedure();
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <regex>
@@ -27,7 +28,10 @@ constexpr bool with_profiling() {
 void emit_procedure_proto(std::ostream&, ProcedureExpression*, const std::string& qualified = "");
 void emit_simd_procedure_proto(std::ostream&, ProcedureExpression*, const std::string& qualified = "");
 
-void emit_api_body(std::ostream&, APIMethod*);
+void emit_api_body(std::ostream&, APIMethod*, bool single_state);
+void emit_table_fill(std::ostream&, ProcedureExpression*, const std::string& qualified);
+void emit_table_lookup(std::ostream&, ProcedureExpression*, const std::string& qualified);
+void emit_simd_table_lookup(std::ostream&, ProcedureExpression*, const std::string& qualified);
 void emit_simd_api_body(std::ostream&, APIMethod*, moduleKind);
 
 void emit_index_initialize(std::ostream& out, const std::unordered_set<std::string>& indices,
@@ -46,10 +50,12 @@ void emit_for_loop_per_constraint(std::ostream& out, BlockExpression* body,
 
 struct cprint {
     Expression* expr_;
-    explicit cprint(Expression* expr): expr_(expr) {}
+    bool single_state_;
+    explicit cprint(Expression* expr, bool single_state = false): expr_(expr), single_state_(single_state) {}
 
     friend std::ostream& operator<<(std::ostream& out, const cprint& w) {
         CPrinter printer(out);
+        printer.set_single_state(w.single_state_);
         return w.expr_->accept(&printer), out;
     }
 };
@@ -75,6 +81,41 @@ struct simdprint {
     }
 };
 
+// Range parameters whose values are the same for every instance are stored
+// as a single value; the flag is set by the mechanism on instantiation.
+
+static std::string uniform_flag(const std::string& name) {
+    return name+"_uniform_";
+}
+
+// Procedures with a TABLE: the outputs are tabulated by tabulate_<proc>() in
+// nrn_init(), if the parameters the table depends upon are the same for every
+// instance, and calls are then replaced by an interpolated <proc>_lookup().
+
+static std::string table_data(const std::string& proc) {
+    return proc+"_table_";
+}
+
+static std::string table_valid_flag(const std::string& proc) {
+    return proc+"_table_valid_";
+}
+
+static std::string table_fill(const std::string& proc) {
+    return "tabulate_"+proc;
+}
+
+static std::string table_lookup(const std::string& proc) {
+    return proc+"_lookup";
+}
+
+static std::vector<ProcedureExpression*> tabulated_procedures(const Module& m) {
+    std::vector<ProcedureExpression*> procs;
+    for (auto proc: normal_procedures(m)) {
+        if (proc->table()) procs.push_back(proc);
+    }
+    return procs;
+}
+
 static std::string ion_state_field(std::string ion_name) {
     return "ion_"+ion_name+"_";
 }
@@ -96,6 +137,14 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
 
     bool with_simd = opt.simd.abi!=simd_spec::none;
 
+    // With single_state, STATE and ASSIGNED range variables are stored in
+    // single precision and listed in the single field and state tables;
+    // range parameters keep double precision (and uniform) storage.
+
+    auto is_single = [&opt](const VariableExpression* v) {
+        return opt.single_state && v->is_range() && !is_range_parameter(v);
+    };
+
     // init_api, state_api, current_api methods are mandatory:
 
     assert_has_scope(init_api, "nrn_init");
@@ -135,6 +184,7 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         "#include <cmath>\n"
         "#include <cstddef>\n"
         "#include <memory>\n"
+        "#include <vector>\n"
         "#include <" << arb_private_header_prefix() << "backends/multicore/mechanism.hpp>\n"
         "#include <" << arb_header_prefix() << "math.hpp>\n";
 
@@ -152,7 +202,12 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         "using base = ::arb::multicore::mechanism;\n"
         "using value_type = base::value_type;\n"
         "using size_type = base::size_type;\n"
-        "using index_type = base::index_type;\n"
+        "using index_type = base::index_type;\n";
+
+    opt.single_state &&
+        out << "using single_type = base::single_type;\n";
+
+    out <<
         "using ::arb::math::exprelr;\n"
         "using ::std::abs;\n"
         "using ::std::cos;\n"
@@ -209,6 +264,10 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         "void nrn_current() override;\n"
         "void write_ions() override;\n";
 
+    with_simd && out <<
+        "unsigned simd_width() const override { return simd_width_; }\n"
+        "unsigned data_alignment() const override { return sizeof(value_type)*simd_width_; }\n";
+
     net_receive && out <<
         "void deliver_events(deliverable_event_stream::state events) override;\n"
         "void net_receive(int i_, value_type weight);\n";
@@ -239,10 +298,40 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         sep.reset();
         for (const auto& array: vars.arrays) {
             auto memb = array->name();
-            out << sep << "{" << quote(memb) << ", &" << memb << "}";
+            if (!is_single(array)) {
+                out << sep << "{" << quote(memb) << ", &" << memb << "}";
+            }
         }
         out << popindent << "\n};" << popindent << "\n}\n";
 
+        if (std::any_of(vars.arrays.begin(), vars.arrays.end(), is_single)) {
+            out <<
+                "mechanism_single_field_table single_field_table() override {\n" << indent <<
+                "return {" << indent;
+
+            sep.reset();
+            for (const auto& array: vars.arrays) {
+                auto memb = array->name();
+                if (is_single(array)) {
+                    out << sep << "{" << quote(memb) << ", &" << memb << "}";
+                }
+            }
+            out << popindent << "\n};" << popindent << "\n}\n";
+
+            out <<
+                "mechanism_single_state_table single_state_table() override {\n" << indent <<
+                "return {" << indent;
+
+            sep.reset();
+            for (const auto& array: vars.arrays) {
+                auto memb = array->name();
+                if (is_single(array) && array->is_state()) {
+                    out << sep << "{" << quote(memb) << ", &" << memb << "}";
+                }
+            }
+            out << popindent << "\n};" << popindent << "\n}\n";
+        }
+
         out <<
             "mechanism_field_default_table field_default_table() override {\n" << indent <<
             "return {" << indent;
@@ -257,6 +346,21 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         }
         out << popindent << "\n};" << popindent << "\n}\n";
 
+        if (std::any_of(vars.arrays.begin(), vars.arrays.end(), is_range_parameter)) {
+            out <<
+                "mechanism_uniform_table uniform_table() override {\n" << indent <<
+                "return {" << indent;
+
+            sep.reset();
+            for (const auto& array: vars.arrays) {
+                if (is_range_parameter(array)) {
+                    auto memb = array->name();
+                    out << sep << "{" << quote(memb) << ", &" << uniform_flag(memb) << "}";
+                }
+            }
+            out << popindent << "\n};" << popindent << "\n}\n";
+        }
+
         out <<
             "mechanism_state_table state_table() override {\n" << indent <<
             "return {" << indent;
@@ -264,7 +368,7 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         sep.reset();
         for (const auto& array: vars.arrays) {
             auto memb = array->name();
-            if(array->is_state()) {
+            if(array->is_state() && !is_single(array)) {
                 out << sep << "{" << quote(memb) << ", &" << memb << "}";
             }
         }
@@ -298,7 +402,10 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         out << "value_type " << scalar->name() <<  " = " << as_c_double(scalar->value()) << ";\n";
     }
     for (const auto& array: vars.arrays) {
-        out << "value_type* " << array->name() << ";\n";
+        out << (is_single(array)? "single_type* ": "value_type* ") << array->name() << ";\n";
+        if (is_range_parameter(array)) {
+            out << "bool " << uniform_flag(array->name()) << " = false;\n";
+        }
     }
     for (const auto& dep: ion_deps) {
         out << "ion_state_view " << ion_state_field(dep.name) << ";\n";
@@ -314,6 +421,17 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         }
     }
 
+    for (auto proc: tabulated_procedures(module_)) {
+        auto name = proc->name();
+        out <<
+            "std::vector<value_type> " << table_data(name) << ";\n"
+            "bool " << table_valid_flag(name) << " = false;\n"
+            "void " << table_fill(name) << "();\n"
+            "void " << table_lookup(name) << "(int i_, value_type x);\n";
+        with_simd && out <<
+            "void " << table_lookup(name) << "(index_type i_, const simd_value& x);\n";
+    }
+
     out << popindent <<
         "};\n\n"
         "template <typename B> ::arb::concrete_mech_ptr<B> make_mechanism_" <<name << "();\n"
@@ -336,7 +454,7 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         "}\n"
         "\n"
         "void " << class_name << "::net_receive(int i_, value_type weight) {\n" << indent <<
-        cprint(net_receive->body()) << popindent <<
+        cprint(net_receive->body(), opt.single_state) << popindent <<
         "}\n\n";
 
     auto emit_body = [&](APIMethod *p) {
@@ -344,11 +462,14 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
             emit_simd_api_body(out, p, module_.kind());
         }
         else {
-            emit_api_body(out, p);
+            emit_api_body(out, p, opt.single_state);
         }
     };
 
     out << "void " << class_name << "::nrn_init() {\n" << indent;
+    for (auto proc: tabulated_procedures(module_)) {
+        out << table_fill(proc->name()) << "();\n";
+    }
     emit_body(init_api);
     out << popindent << "}\n\n";
 
@@ -374,7 +495,7 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
         emit_procedure_proto(out, proc, class_name);
         out <<
             " {\n" << indent <<
-            cprint(proc->body()) << popindent <<
+            cprint(proc->body(), opt.single_state) << popindent <<
             "}\n\n";
 
         if (with_simd) {
@@ -384,6 +505,14 @@ std::string emit_cpp_source(const Module& module_, const printer_options& opt) {
                 simdprint(proc->body()) << popindent <<
                 "}\n\n";
         }
+
+        if (proc->table()) {
+            emit_table_fill(out, proc, class_name);
+            emit_table_lookup(out, proc, class_name);
+            if (with_simd) {
+                emit_simd_table_lookup(out, proc, class_name);
+            }
+        }
     }
 
     out << namespace_declaration_close(ns_components);
@@ -401,16 +530,55 @@ void CPrinter::visit(LocalVariable* sym) {
 }
 
 void CPrinter::visit(VariableExpression *sym) {
-    out_ << sym->name() << (sym->is_range()? "[i_]": "");
+    if (is_range_parameter(sym)) {
+        out_ << "(" << uniform_flag(sym->name()) << "? " << sym->name() << "[0]: " << sym->name() << "[i_])";
+    }
+    else if (single_state_ && sym->is_range()) {
+        out_ << "value_type(" << sym->name() << "[i_])";
+    }
+    else {
+        out_ << sym->name() << (sym->is_range()? "[i_]": "");
+    }
+}
+
+void CPrinter::visit(AssignmentExpression* e) {
+    if (!single_state_) {
+        cexpr_emit(e, out_, this);
+        return;
+    }
+
+    // Store to a range variable without the conversion applied on read.
+    auto id = e->lhs()->is_identifier();
+    Symbol* lhs = id? id->symbol(): nullptr;
+
+    if (lhs && lhs->is_variable() && lhs->is_variable()->is_range()) {
+        out_ << lhs->name() << "[i_]";
+    }
+    else {
+        e->lhs()->accept(this);
+    }
+    out_ << " = ";
+    e->rhs()->accept(this);
 }
 
 void CPrinter::visit(CallExpression* e) {
+    auto proc = e->procedure();
+    bool tabulated = proc && proc->table();
+
+    if (tabulated) {
+        out_ << "(" << table_valid_flag(e->name()) << "? " << table_lookup(e->name()) << "(i_, ";
+        e->args()[0]->accept(this);
+        out_ << "): ";
+    }
     out_ << e->name() << "(i_";
     for (auto& arg: e->args()) {
         out_ << ", ";
         arg->accept(this);
     }
     out_ << ")";
+    if (tabulated) {
+        out_ << ")";
+    }
 }
 
 void CPrinter::visit(BlockExpression* block) {
@@ -498,19 +666,19 @@ void emit_state_update(std::ostream& out, Symbol* from, IndexedVariable* externa
     }
 }
 
-void emit_api_body(std::ostream& out, APIMethod* method) {
+void emit_api_body(std::ostream& out, APIMethod* method, bool single_state) {
     auto body = method->body();
     auto indexed_vars = indexed_locals(method->scope());
 
     if (!body->statements().empty()) {
         out <<
-            "int n_ = width_;\n"
-            "for (int i_ = 0; i_ < n_; ++i_) {\n" << indent;
+            "int n_ = end_;\n"
+            "for (int i_ = begin_; i_ < n_; ++i_) {\n" << indent;
 
         for (auto& sym: indexed_vars) {
             emit_state_read(out, sym);
         }
-        out << cprint(body);
+        out << cprint(body, single_state);
 
         for (auto& sym: indexed_vars) {
             emit_state_update(out, sym, sym->external_variable());
@@ -519,6 +687,142 @@ void emit_api_body(std::ostream& out, APIMethod* method) {
     }
 }
 
+// Tabulation of procedures:
+
+namespace {
+    // Convenience I/O wrapper for emitting the value of a table dependency in
+    // the first instance.
+
+    struct first_value {
+        Symbol* sym;
+        first_value(Symbol* sym): sym(sym) {}
+
+        friend std::ostream& operator<<(std::ostream& o, const first_value& wrap) {
+            if (auto v = wrap.sym->is_variable()) {
+                return o << v->name() << (v->is_range()? "[0]": "");
+            }
+            auto d = decode_indexed_variable(wrap.sym->is_indexed_variable());
+            if (d.scale != 1) {
+                o << as_c_double(d.scale) << "*";
+            }
+            return o << d.data_var << '[' << (d.scalar()? "0": d.index_var+"[0]") << ']';
+        }
+    };
+}
+
+void emit_table_fill(std::ostream& out, ProcedureExpression* proc, const std::string& qualified) {
+    auto table = proc->table();
+    auto name = proc->name();
+    auto& outputs = table->outputs();
+    int n = table->n();
+    double dx = (table->to()-table->from())/n;
+
+    out <<
+        "void " << qualified << "::" << table_fill(name) << "() {\n" << indent <<
+        table_valid_flag(name) << " = false;\n"
+        "if (!width_) return;\n\n";
+
+    // The table is computed for the first instance, and can only be used
+    // if the other instances have the same parameters.
+
+    std::vector<std::string> differ;
+    for (auto s: table->uniform()) {
+        if (auto v = s->is_variable()) {
+            auto memb = v->name();
+            differ.push_back(is_range_parameter(v)?
+                "(!"+uniform_flag(memb)+" && "+memb+"[i_]!="+memb+"[0])":
+                memb+"[i_]!="+memb+"[0]");
+        }
+        else {
+            auto d = decode_indexed_variable(s->is_indexed_variable());
+            if (!d.scalar()) {
+                differ.push_back(d.data_var+"["+d.index_var+"[i_]]!="+d.data_var+"["+d.index_var+"[0]]");
+            }
+        }
+    }
+    if (!differ.empty()) {
+        io::separator sep("", " || ");
+        out << "for (size_type i_ = 1; i_<width_; ++i_) {\n" << indent << "if (";
+        for (auto& d: differ) {
+            out << sep << d;
+        }
+        out << ") return;\n" << popindent << "}\n\n";
+    }
+
+    // The procedure writes to the outputs of the first instance, which are
+    // restored afterwards.
+
+    io::separator sep("", ", ");
+    out << "value_type saved_[] = {";
+    for (auto v: outputs) {
+        out << sep << v->name() << "[0]";
+    }
+    out << "};\n";
+
+    out <<
+        table_data(name) << ".resize(" << outputs.size()*(n+1) << ");\n"
+        "for (int j_ = 0; j_<=" << n << "; ++j_) {\n" << indent <<
+        name << "(0, " << as_c_double(table->from()) << "+j_*" << as_c_double(dx);
+    for (auto s: table->arguments()) {
+        out << ", " << first_value(s);
+    }
+    out << ");\n";
+    for (unsigned k = 0; k<outputs.size(); ++k) {
+        out << table_data(name) << "[" << k*(n+1) << "+j_] = " << outputs[k]->name() << "[0];\n";
+    }
+    out << popindent << "}\n";
+
+    for (unsigned k = 0; k<outputs.size(); ++k) {
+        out << outputs[k]->name() << "[0] = saved_[" << k << "];\n";
+    }
+    out << table_valid_flag(name) << " = true;\n" << popindent << "}\n\n";
+}
+
+void emit_table_lookup(std::ostream& out, ProcedureExpression* proc, const std::string& qualified) {
+    auto table = proc->table();
+    auto name = proc->name();
+    auto& outputs = table->outputs();
+    int n = table->n();
+    double rdx = n/(table->to()-table->from());
+
+    out <<
+        "void " << qualified << "::" << table_lookup(name) << "(int i_, value_type x) {\n" << indent <<
+        "value_type u_ = min(max((x-(" << as_c_double(table->from()) << "))*" << as_c_double(rdx) << ", 0.), " << n << ".);\n"
+        "int j_ = min(int(u_), " << n-1 << ");\n"
+        "value_type t_ = u_-j_;\n"
+        "const value_type* p_ = " << table_data(name) << ".data()+j_;\n";
+
+    for (unsigned k = 0; k<outputs.size(); ++k) {
+        auto a = k*(n+1);
+        out << outputs[k]->name() << "[i_] = p_[" << a << "]+t_*(p_[" << a+1 << "]-p_[" << a << "]);\n";
+    }
+    out << popindent << "}\n\n";
+}
+
+void emit_simd_table_lookup(std::ostream& out, ProcedureExpression* proc, const std::string& qualified) {
+    auto table = proc->table();
+    auto name = proc->name();
+    auto& outputs = table->outputs();
+    int n = table->n();
+    double rdx = n/(table->to()-table->from());
+
+    out <<
+        "void " << qualified << "::" << table_lookup(name) << "(index_type i_, const simd_value& x) {\n" << indent <<
+        "simd_value u_ = min(max((x-simd_value(" << as_c_double(table->from()) << "))*simd_value(" << as_c_double(rdx) << "), simd_value(0.)), simd_value(" << n << ".));\n"
+        "simd_index j_ = min(S::simd_cast<simd_index>(u_), simd_index(" << n-1 << "));\n"
+        "simd_value t_ = u_-S::simd_cast<simd_value>(j_);\n"
+        "simd_value a_, b_;\n";
+
+    for (unsigned k = 0; k<outputs.size(); ++k) {
+        auto a = k*(n+1);
+        out <<
+            "a_ = simd_value(S::indirect(" << table_data(name) << ".data()+" << a << ", j_));\n"
+            "b_ = simd_value(S::indirect(" << table_data(name) << ".data()+" << a+1 << ", j_));\n"
+            "simd_value(a_+t_*(b_-a_)).copy_to(" << outputs[k]->name() << "+i_);\n";
+    }
+    out << popindent << "}\n\n";
+}
+
 // SIMD printing:
 
 static std::string index_i_name(const std::string& index_var) {
@@ -535,10 +839,16 @@ void SimdPrinter::visit(LocalVariable* sym) {
 
 void SimdPrinter::visit(VariableExpression *sym) {
     if (sym->is_range()) {
+        if (is_range_parameter(sym)) {
+            out_ << "(" << uniform_flag(sym->name()) << "? simd_value(" << sym->name() << "[0]): ";
+        }
         if(is_indirect_index_)
             out_ << "simd_value(" << sym->name() << "+index_)";
         else
             out_ << "simd_value(" << sym->name() << "+i_)";
+        if (is_range_parameter(sym)) {
+            out_ << ")";
+        }
     }
     else {
         out_ << sym->name();
@@ -567,15 +877,24 @@ void SimdPrinter::visit(AssignmentExpression* e) {
 }
 
 void SimdPrinter::visit(CallExpression* e) {
-    if(is_indirect_index_)
-        out_ << e->name() << "(index_";
-    else
-        out_ << e->name() << "(i_";
+    auto proc = e->procedure();
+    bool tabulated = proc && proc->table();
+    const char* index = is_indirect_index_? "index_": "i_";
+
+    if (tabulated) {
+        out_ << "(" << table_valid_flag(e->name()) << "? " << table_lookup(e->name()) << "(" << index << ", ";
+        e->args()[0]->accept(this);
+        out_ << "): ";
+    }
+    out_ << e->name() << "(" << index;
     for (auto& arg: e->args()) {
         out_ << ", ";
         arg->accept(this);
     }
     out_ << ")";
+    if (tabulated) {
+        out_ << ")";
+    }
 }
 
 void SimdPrinter::visit(BlockExpression* block) {
@@ -665,6 +984,14 @@ void emit_simd_state_update(std::ostream& out, Symbol* from, IndexedVariable* ex
             out << from->name() << ";\n"
                 << tempvar << ".copy_to(" << d.data_var << " + " << d.index_var << "[index_]);\n";
         }
+        else if (constraint == simd_expr_constraint::none) {
+            // Repeated indices are summed in register before the update.
+            out << "S::reduce_by_key(w_*";
+
+            if (coeff!=1) out << as_c_double(coeff) << "*";
+
+            out << from->name() << ", " << d.data_var << ", " << index_i_name(d.index_var) << ");\n";
+        }
         else {
             out << "S::indirect(" << d.data_var << ", " << index_i_name(d.index_var) << ", constraint_category_)"
                 << " += w_*";
@@ -707,6 +1034,7 @@ void emit_index_initialize(std::ostream& out, const std::unordered_set<std::stri
         }
         break;
     case simd_expr_constraint::other:
+    case simd_expr_constraint::none:
         for (auto& index: indices) {
             out << index_i_name(index) << ".copy_from(" << index << ".data() + index_);\n";
         }
@@ -742,8 +1070,8 @@ void emit_for_loop_per_constraint(std::ostream& out, BlockExpression* body,
                                   std::string underlying_constraint_name) {
 
     out << "constraint_category_ = index_constraint::"<< underlying_constraint_name << ";\n";
-    out << "for (unsigned i_ = 0; i_ < index_constraints_." << underlying_constraint_name
-        << ".size(); i_++) {\n"
+    out << "for (unsigned i_ = constraints_begin_." << underlying_constraint_name
+        << "; i_ < constraints_end_." << underlying_constraint_name << "; i_++) {\n"
         << indent;
 
     out << "index_type index_ = index_constraints_." << underlying_constraint_name << "[i_];\n";
@@ -799,7 +1127,7 @@ void emit_simd_api_body(std::ostream& out, APIMethod* method, moduleKind module_
                                          constraint, underlying_constraint);
 
             //Generate for loop for all simd_vectors that have no optimizing constraints
-            constraint = simd_expr_constraint::other;
+            constraint = simd_expr_constraint::none;
             underlying_constraint = "none";
 
             emit_for_loop_per_constraint(out, body, indexed_vars, requires_weight, indices, constraint,
@@ -821,8 +1149,8 @@ void emit_simd_api_body(std::ostream& out, APIMethod* method, moduleKind module_
             }
 
             out <<
-                "unsigned n_ = width_;\n\n"
-                "for (unsigned i_ = 0; i_ < n_; i_ += simd_width_) {\n" << indent <<
+                "unsigned n_ = end_;\n\n"
+                "for (unsigned i_ = begin_; i_ < n_; i_ += simd_width_) {\n" << indent <<
                 simdprint(body) << popindent <<
                 "}\n";
         }
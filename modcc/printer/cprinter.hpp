@@ -21,11 +21,18 @@ public:
         throw compiler_exception("CPrinter cannot translate expression "+e->to_string());
     }
 
+    // Range variables other than parameters are stored in single precision:
+    // convert to value_type on read.
+    void set_single_state(bool single_state) {
+        single_state_ = single_state;
+    }
+
     void visit(BlockExpression*) override;
     void visit(CallExpression*) override;
     void visit(IdentifierExpression*) override;
     void visit(VariableExpression*) override;
     void visit(LocalVariable*) override;
+    void visit(AssignmentExpression*) override;
 
     // Delegate low-level emits to cexpr_emit:
     void visit(NumberExpression* e) override { cexpr_emit(e, out_, this); }
@@ -35,13 +42,15 @@ public:
 
 protected:
     std::ostream& out_;
+    bool single_state_ = false;
 };
 
 
 enum class simd_expr_constraint{
     constant,
     contiguous,
-    other
+    other,
+    none      // as other, but with indices that may repeat
 };
 
 class SimdPrinter: public Visitor {
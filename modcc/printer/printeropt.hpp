@@ -17,4 +17,9 @@ struct printer_options {
     // Currently only supported for C printer.
 
     bool profile = false;
+
+    // Store STATE and ASSIGNED range variables in single precision?
+    // Computation remains in double precision. (C printer only.)
+
+    bool single_state = false;
 };
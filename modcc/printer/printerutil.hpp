@@ -102,6 +102,12 @@ struct module_variables_t {
 
 module_variables_t local_module_variables(const Module&);
 
+// Range parameters: array variables that the mechanism reads but never writes.
+
+inline bool is_range_parameter(const VariableExpression* v) {
+    return v->is_range() && !v->is_state() && !v->is_writeable();
+}
+
 // "normal" procedures in a module.
 // A normal procedure is one that has been declared with the
 // PROCEDURE keyword in NMODL.
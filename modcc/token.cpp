@@ -54,6 +54,11 @@ static Keyword keywords[] = {
     {"COMPARTMENT", tok::compartment},
     {"METHOD",      tok::method},
     {"STEADYSTATE", tok::steadystate},
+    {"TABLE",       tok::table},
+    {"DEPEND",      tok::depend},
+    {"FROM",        tok::from},
+    {"TO",          tok::to},
+    {"WITH",        tok::with},
     {"if",          tok::if_stmt},
     {"else",        tok::else_stmt},
     {"cnexp",       tok::cnexp},
@@ -127,6 +132,11 @@ static TokenString token_strings[] = {
     {"COMPARTMENT", tok::compartment},
     {"METHOD",      tok::method},
     {"STEADYSTATE", tok::steadystate},
+    {"TABLE",       tok::table},
+    {"DEPEND",      tok::depend},
+    {"FROM",        tok::from},
+    {"TO",          tok::to},
+    {"WITH",        tok::with},
     {"if",          tok::if_stmt},
     {"else",        tok::else_stmt},
     {"eof",         tok::eof},
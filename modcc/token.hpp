@@ -64,6 +64,7 @@ enum class tok {
     solve, method, steadystate,
     threadsafe, global,
     point_process,
+    table, depend, from, to, with,
 
     // prefix binary operators
     min, max,
@@ -48,7 +48,7 @@ struct sampler_state {
     }
 };
 
-// A functor that models arb::sampler_function.
+// A functor that models arb::bulk_sampler_function.
 // Holds a shared pointer to the trace_entry used to store the samples, so that if
 // the trace_entry in sampler is garbage collected in Python, stores will
 // not seg fault.
@@ -60,15 +60,10 @@ struct sample_callback {
         sample_store(state)
     {}
 
-    void operator() (arb::cell_member_type probe_id, arb::probe_tag tag, std::size_t n, const arb::sample_record* recs) {
+    void operator() (arb::cell_member_type probe_id, arb::probe_tag tag, std::size_t n, const double* time, const double* value) {
         auto& v = sample_store->probe_buffer(probe_id);
         for (std::size_t i = 0; i<n; ++i) {
-            if (auto p = arb::util::any_cast<const double*>(recs[i].data)) {
-                v.push_back({recs[i].time, *p});
-            }
-            else {
-                throw std::runtime_error("unexpected sample type");
-            }
+            v.push_back({arb::time_type(time[i]), value[i]});
         }
     };
 };
@@ -0,0 +1,206 @@
+// Compare the time per integration step of a cable cell group under the CV
+// orderings of cable_cell_global_properties::cv_order.
+//
+// Two cell groups are simulated: a single cell with the morphology of the
+// SWC file of the `single` example, and a group of random branching cells
+// as generated by the `ring` example. Both have passive dendrites, HH soma
+// and synapses scattered over the dendrites.
+
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <arbor/cable_cell.hpp>
+#include <arbor/morph/morphology.hpp>
+#include <arbor/recipe.hpp>
+#include <arbor/swcio.hpp>
+
+#include "backends/multicore/fvm.hpp"
+#include "benchmark/benchmark.h"
+#include "execution_context.hpp"
+#include "fvm_lowered_cell_impl.hpp"
+
+using namespace arb;
+
+using backend = multicore::backend;
+using fvm_cell = fvm_lowered_cell_impl<backend>;
+
+#ifndef ARB_UBENCH_SWC
+#define ARB_UBENCH_SWC "example.swc"
+#endif
+
+// Place n_synapse expsyn synapses at random dendritic locations.
+void place_synapses(cable_cell& c, unsigned n_synapse, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<unsigned> branch_dist(1, c.num_branches()-1);
+    std::uniform_real_distribution<double> pos_dist(0, 1);
+
+    for (unsigned i = 0; i<n_synapse; ++i) {
+        mlocation loc{branch_dist(gen), pos_dist(gen)};
+        c.place(loc, "expsyn");
+    }
+}
+
+class ordering_recipe: public recipe {
+public:
+    ordering_recipe(cv_ordering ordering) {
+        gprop_.default_parameters = neuron_parameter_defaults;
+        gprop_.cv_order = ordering;
+    }
+
+    cell_kind get_cell_kind(cell_gid_type) const override {
+        return cell_kind::cable;
+    }
+
+    util::any get_global_properties(cell_kind) const override {
+        return gprop_;
+    }
+
+private:
+    cable_cell_global_properties gprop_;
+};
+
+// One cell with the SWC morphology, one CV per sample.
+class swc_recipe: public ordering_recipe {
+public:
+    swc_recipe(cv_ordering ordering): ordering_recipe(ordering) {
+        std::ifstream f(ARB_UBENCH_SWC);
+        if (!f) throw std::runtime_error("unable to open " ARB_UBENCH_SWC);
+        morpho_ = morphology(swc_as_sample_tree(parse_swc_file(f)));
+    }
+
+    cell_size_type num_cells() const override { return 1; }
+    cell_size_type num_targets(cell_gid_type) const override { return 200; }
+
+    util::unique_any get_cell_description(cell_gid_type) const override {
+        label_dict dict;
+        dict.set("soma", reg::tagged(1));
+        dict.set("dend", join(reg::tagged(3), reg::tagged(4), reg::tagged(42)));
+
+        cable_cell c(morpho_, dict, true);
+        c.paint("soma", "hh");
+        c.paint("dend", "pas");
+        place_synapses(c, num_targets(0), 0);
+        return c;
+    }
+
+private:
+    morphology morpho_;
+};
+
+// Random branching cells with the default parameters of the ring example,
+// and more levels and compartments.
+class branch_recipe: public ordering_recipe {
+public:
+    branch_recipe(cv_ordering ordering, unsigned n_cell):
+        ordering_recipe(ordering), n_cell_(n_cell)
+    {}
+
+    cell_size_type num_cells() const override { return n_cell_; }
+    cell_size_type num_targets(cell_gid_type) const override { return 20; }
+
+    util::unique_any get_cell_description(cell_gid_type gid) const override {
+        const unsigned max_depth = 6;
+        const double branch_probs[2] = {1.0, 0.5};
+        const double compartments[2] = {40, 4};
+        const double lengths[2] = {200, 20};
+
+        auto interp = [&](const double* r, unsigned i) {
+            return r[0] + i*(r[1]-r[0])/(max_depth-1);
+        };
+
+        sample_tree tree;
+        double soma_radius = 12.6157/2.0;
+        tree.append(mnpos, {{0, 0, 0, soma_radius}, 1});
+
+        std::mt19937 gen(gid);
+        std::uniform_real_distribution<double> dis(0, 1);
+
+        std::vector<unsigned> level = {0};
+        double z = soma_radius;
+        for (unsigned i = 0; i<max_depth && !level.empty(); ++i) {
+            double l = interp(lengths, i);
+            unsigned nc = std::round(interp(compartments, i));
+
+            std::vector<unsigned> next;
+            for (unsigned sec: level) {
+                for (unsigned j = 0; j<2; ++j) {
+                    if (dis(gen)>=interp(branch_probs, i)) continue;
+
+                    auto p = tree.append(sec, {{0, 0, z, 0.5}, 3});
+                    for (unsigned k = 1; k<nc; ++k) {
+                        p = tree.append(p, {{0, 0, z+k*l/nc, 0.5}, 3});
+                    }
+                    next.push_back(tree.append(p, {{0, 0, z+l, 0.5}, 3}));
+                }
+            }
+            level = std::move(next);
+            z += l;
+        }
+
+        label_dict dict;
+        dict.set("soma", reg::tagged(1));
+        dict.set("dend", reg::tagged(3));
+
+        cable_cell c(morphology(tree, true), dict, true);
+        c.paint("soma", "hh");
+        c.paint("dend", "pas");
+        c.default_parameters.axial_resistivity = 100;
+        place_synapses(c, num_targets(gid), gid);
+        return c;
+    }
+
+private:
+    unsigned n_cell_;
+};
+
+// Time 1 ms of integration per iteration.
+void run_cell_group(benchmark::State& state, const recipe& rec) {
+    std::vector<cell_gid_type> gids;
+    for (cell_gid_type i = 0; i<rec.num_cells(); ++i) {
+        gids.push_back(i);
+    }
+
+    execution_context context;
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map<probe_handle> probe_map;
+
+    fvm_cell cell(context);
+    cell.initialize(gids, rec, cell_to_intdom, targets, probe_map);
+
+    fvm_value_type t = 0;
+    while (state.KeepRunning()) {
+        t += 1;
+        cell.integrate(t, 0.025, {}, {});
+    }
+}
+
+void bench_swc(benchmark::State& state) {
+    run_cell_group(state, swc_recipe(cv_ordering(state.range(0))));
+}
+
+void bench_branch_cells(benchmark::State& state) {
+    run_cell_group(state, branch_recipe(cv_ordering(state.range(0)), state.range(1)));
+}
+
+void run_custom_arguments(benchmark::internal::Benchmark* b) {
+    for (auto ordering: {cv_ordering::segment, cv_ordering::depth_first, cv_ordering::cuthill_mckee, cv_ordering::branch_contiguous}) {
+        b->Args({int(ordering)});
+    }
+}
+
+void run_branch_arguments(benchmark::internal::Benchmark* b) {
+    for (auto n_cell: {1, 64}) {
+        for (auto ordering: {cv_ordering::segment, cv_ordering::depth_first, cv_ordering::cuthill_mckee, cv_ordering::branch_contiguous}) {
+            b->Args({int(ordering), n_cell});
+        }
+    }
+}
+
+BENCHMARK(bench_swc)->Apply(run_custom_arguments);
+BENCHMARK(bench_branch_cells)->Apply(run_branch_arguments);
+
+BENCHMARK_MAIN();
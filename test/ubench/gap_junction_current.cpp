@@ -0,0 +1,83 @@
+// Compare the gap junction current of the multicore back end, computed over
+// junctions sorted by CV with SIMD gathers, with the scalar loop over
+// unsorted junctions it replaces.
+//
+// 10^5 CVs each have the number of junctions given by the benchmark
+// argument, to peers chosen at random. As in the lowered cell, junctions are
+// listed cell by cell; cells here have 1000 CVs, and list their junctions in
+// random order.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+
+#include "backends/multicore/shared_state.hpp"
+#include "benchmark/benchmark.h"
+
+using namespace arb;
+
+constexpr unsigned n_cv = 100000;
+
+std::vector<fvm_gap_junction> make_junctions(unsigned per_cv) {
+    std::minstd_rand gen(0);
+    std::uniform_int_distribution<fvm_index_type> peer(0, n_cv-1);
+    std::uniform_real_distribution<fvm_value_type> weight(0.1, 1);
+
+    std::vector<fvm_gap_junction> gj;
+    for (unsigned cv = 0; cv<n_cv; ++cv) {
+        for (unsigned k = 0; k<per_cv; ++k) {
+            gj.push_back(fvm_gap_junction({fvm_index_type(cv), peer(gen)}, weight(gen)));
+        }
+    }
+
+    const unsigned block = 1000*per_cv;
+    for (unsigned i = 0; i<gj.size(); i += block) {
+        std::shuffle(gj.begin()+i, gj.begin()+std::min<unsigned>(i+block, gj.size()), gen);
+    }
+    return gj;
+}
+
+// The previous implementation, one junction at a time.
+void bench_scalar(benchmark::State& state) {
+    auto gj = make_junctions(state.range(0));
+
+    std::vector<fvm_value_type> voltage(n_cv), current_density(n_cv, 0);
+    std::minstd_rand gen(1);
+    std::uniform_real_distribution<fvm_value_type> U(-70, -50);
+    std::generate(voltage.begin(), voltage.end(), [&] { return U(gen); });
+
+    while (state.KeepRunning()) {
+        for (unsigned i = 0; i<gj.size(); i++) {
+            auto g = gj[i];
+            auto curr = g.weight*(voltage[g.loc.second] - voltage[g.loc.first]);
+
+            current_density[g.loc.first] -= curr;
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+void bench_csr(benchmark::State& state) {
+    auto gj = make_junctions(state.range(0));
+
+    std::vector<fvm_index_type> cv_to_intdom(n_cv, 0);
+    std::vector<fvm_value_type> vinit(n_cv), temp(n_cv, 300), diam(n_cv, 1);
+    std::minstd_rand gen(1);
+    std::uniform_real_distribution<fvm_value_type> U(-70, -50);
+    std::generate(vinit.begin(), vinit.end(), [&] { return U(gen); });
+
+    multicore::shared_state s(1, cv_to_intdom, gj, vinit, temp, diam, 1);
+    s.reset();
+
+    while (state.KeepRunning()) {
+        s.add_gj_current();
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(bench_scalar)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_csr)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
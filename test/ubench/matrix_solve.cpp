@@ -0,0 +1,140 @@
+// Compare the scalar and SIMD-interleaved Hines matrix solvers of the
+// multicore back end, and measure the strong scaling of the branch-parallel
+// solver on one large cell.
+//
+// Each benchmark assembles and solves the matrix of a group of cells with
+// random tree structure.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+
+#include "backends/multicore/matrix_state.hpp"
+#include "backends/multicore/matrix_state_fine.hpp"
+#include "backends/multicore/matrix_state_interleaved.hpp"
+#include "benchmark/benchmark.h"
+#include "execution_context.hpp"
+
+using namespace arb;
+
+using value_type = fvm_value_type;
+using index_type = fvm_index_type;
+
+using flat_state = multicore::matrix_state<value_type, index_type>;
+using interleaved_state = multicore::matrix_state_interleaved<value_type, index_type>;
+using fine_state = multicore::matrix_state_fine<value_type, index_type>;
+using array = flat_state::array;
+
+struct cell_group {
+    std::vector<index_type> p, cell_cv_divs, cell_to_intdom;
+    std::vector<value_type> cap, cond, area;
+
+    // n_cell cells with sizes drawn uniformly from [min_size, max_size].
+    cell_group(unsigned n_cell, unsigned min_size, unsigned max_size) {
+        std::minstd_rand gen;
+        std::uniform_int_distribution<index_type> size_dist(min_size, max_size);
+
+        cell_cv_divs.push_back(0);
+        for (unsigned c = 0; c<n_cell; ++c) {
+            index_type first = p.size();
+            index_type size = size_dist(gen);
+
+            // Unbranched section from the root, then random branching.
+            for (index_type i = 0; i<size; ++i) {
+                index_type parent = i<8? std::max(i-1, 0): std::uniform_int_distribution<index_type>(0, i-1)(gen);
+                p.push_back(first+parent);
+            }
+            cell_cv_divs.push_back(p.size());
+            cell_to_intdom.push_back(c);
+        }
+
+        cap.assign(p.size(), 0.01);
+        cond.assign(p.size(), 1.0);
+        area.assign(p.size(), 1e3);
+    }
+};
+
+template <typename State>
+void bench_solve(benchmark::State& state) {
+    const unsigned n_cell = state.range(0);
+    const unsigned max_size = state.range(1);
+
+    cell_group g(n_cell, max_size/2, max_size);
+    State m(g.p, g.cell_cv_divs, g.cap, g.cond, g.area, g.cell_to_intdom);
+
+    auto n = g.p.size();
+    array dt(n_cell, 0.025), v(n, -65), i(n, 0.1), c(n, 0.01);
+
+    while (state.KeepRunning()) {
+        m.assemble(dt, v, i, c);
+        m.solve();
+        benchmark::DoNotOptimize(m.solution().data());
+    }
+}
+
+void run_custom_arguments(benchmark::internal::Benchmark* b) {
+    for (auto n_cell: {64, 1024}) {
+        for (auto max_size: {16, 128, 1024}) {
+            b->Args({n_cell, max_size});
+        }
+    }
+}
+
+// One cell of 65536 CVs in unbranched sections of 50 CVs on average.
+struct large_cell: cell_group {
+    large_cell(): cell_group(0, 0, 0) {
+        const index_type n = 65536;
+
+        std::minstd_rand gen;
+        std::bernoulli_distribution branch_dist(0.02);
+
+        p.assign(n, 0);
+        for (index_type i = 1; i<n; ++i) {
+            p[i] = branch_dist(gen)? std::uniform_int_distribution<index_type>(0, i-1)(gen): i-1;
+        }
+        cell_cv_divs = {0, n};
+        cell_to_intdom = {0};
+
+        cap.assign(n, 0.01);
+        cond.assign(n, 1.0);
+        cond[0] = 0;
+        area.assign(n, 1e3);
+    }
+};
+
+template <typename State>
+void run_large_cell(benchmark::State& state, State& m) {
+    auto n = m.solution().size();
+    array dt(1, 0.025), v(n, -65), i(n, 0.1), c(n, 0.01);
+
+    while (state.KeepRunning()) {
+        m.assemble(dt, v, i, c);
+        m.solve();
+        benchmark::DoNotOptimize(m.solution().data());
+    }
+}
+
+void bench_large_cell_flat(benchmark::State& state) {
+    large_cell g;
+    flat_state m(g.p, g.cell_cv_divs, g.cap, g.cond, g.area, g.cell_to_intdom);
+    run_large_cell(state, m);
+}
+
+// Solve with the number of threads given by the argument.
+void bench_large_cell_fine(benchmark::State& state) {
+    const unsigned n_thread = state.range(0);
+
+    large_cell g;
+    execution_context context(proc_allocation{n_thread, -1});
+    fine_state m(g.p, g.cell_cv_divs, g.cap, g.cond, g.area, g.cell_to_intdom, context);
+    run_large_cell(state, m);
+}
+
+BENCHMARK_TEMPLATE(bench_solve, flat_state)->Apply(run_custom_arguments);
+BENCHMARK_TEMPLATE(bench_solve, interleaved_state)->Apply(run_custom_arguments);
+BENCHMARK(bench_large_cell_flat);
+BENCHMARK(bench_large_cell_fine)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,82 @@
+// Compare the SIMD reduce-by-key of indexed additions with repeated indices
+// against the scalar loop over runs of equal indices that it replaces.
+//
+// 10^5 values are added to an array at indices in ascending order. Each index
+// repeats the previous one with a probability given in percent by the
+// benchmark argument, as when many synapses in a SIMD block share a CV.
+// The generic ABI of the native width keeps the scalar loop over runs.
+
+#include <random>
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+#include <arbor/simd/simd.hpp>
+
+#include "benchmark/benchmark.h"
+
+using namespace arb;
+
+constexpr unsigned n_value = 100000;
+constexpr unsigned simd_width = simd::simd_abi::native_width<fvm_value_type>::value;
+
+struct problem {
+    std::vector<fvm_value_type> values, data;
+    std::vector<fvm_index_type> index;
+
+    problem(double repeat) {
+        std::minstd_rand gen(0);
+        std::uniform_real_distribution<double> U(0, 1);
+
+        fvm_index_type j = 0;
+        for (unsigned i = 0; i<n_value; ++i) {
+            if (i && U(gen)>=repeat) ++j;
+            index.push_back(j);
+            values.push_back(U(gen));
+        }
+        data.assign(j+1, 0.);
+    }
+};
+
+template <template <class, unsigned> class Abi>
+void run_reduce(benchmark::State& state) {
+    using simd_value = simd::simd<fvm_value_type, simd_width, Abi>;
+    using simd_index = simd::simd<fvm_index_type, simd_width, Abi>;
+
+    problem P(state.range(0)/100.);
+    fvm_value_type* data = P.data.data();
+
+    while (state.KeepRunning()) {
+        for (unsigned i = 0; i<n_value; i += simd_width) {
+            simd_value v(P.values.data()+i);
+            simd_index k(P.index.data()+i);
+            simd::indirect(data, k, simd::index_constraint::none) += v;
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+void bench_scalar(benchmark::State& state) {
+    problem P(state.range(0)/100.);
+    fvm_value_type* data = P.data.data();
+
+    while (state.KeepRunning()) {
+        for (unsigned i = 0; i<n_value; ++i) {
+            data[P.index[i]] += P.values[i];
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+void bench_generic(benchmark::State& state) {
+    run_reduce<simd::simd_abi::generic>(state);
+}
+
+void bench_native(benchmark::State& state) {
+    run_reduce<simd::simd_abi::default_abi>(state);
+}
+
+BENCHMARK(bench_scalar)->Arg(0)->Arg(25)->Arg(50)->Arg(75)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bench_generic)->Arg(0)->Arg(25)->Arg(50)->Arg(75)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bench_native)->Arg(0)->Arg(25)->Arg(50)->Arg(75)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
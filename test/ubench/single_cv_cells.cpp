@@ -0,0 +1,145 @@
+// Compare the matrix solvers of the multicore back end on groups of
+// single-CV cells, and time the integration of such a group.
+//
+// bench_matrix assembles and solves the matrix of 10^5 single-CV cells with
+// the flat, interleaved and diagonal matrix states, with the integration
+// domains either the cells themselves or pairs of cells. bench_integrate
+// integrates a group of 10^5 single-CV cells with HH channels, which the
+// lowered cell solves with the diagonal matrix state.
+
+#include <random>
+#include <vector>
+
+#include <arbor/cable_cell.hpp>
+#include <arbor/morph/morphology.hpp>
+#include <arbor/recipe.hpp>
+
+#include "backends/multicore/fvm.hpp"
+#include "backends/multicore/matrix_state.hpp"
+#include "backends/multicore/matrix_state_diagonal.hpp"
+#include "backends/multicore/matrix_state_interleaved.hpp"
+#include "benchmark/benchmark.h"
+#include "execution_context.hpp"
+#include "fvm_lowered_cell_impl.hpp"
+
+using namespace arb;
+
+using backend = multicore::backend;
+using fvm_cell = fvm_lowered_cell_impl<backend>;
+
+using value_type = fvm_value_type;
+using index_type = fvm_index_type;
+using array = multicore::array;
+
+constexpr unsigned n_cell = 100000;
+
+template <typename State>
+void run_matrix(benchmark::State& state) {
+    bool paired = state.range(0);
+    std::vector<index_type> p(n_cell), divs(n_cell+1), intdom(n_cell);
+    std::vector<value_type> cap(n_cell), cond(n_cell, 0), area(n_cell);
+
+    std::minstd_rand gen(0);
+    std::uniform_real_distribution<value_type> dist(1, 2);
+    for (unsigned i = 0; i<n_cell; ++i) {
+        p[i] = i;
+        divs[i+1] = i+1;
+        intdom[i] = paired? i/2: i;
+        cap[i] = dist(gen);
+        area[i] = 1e3*dist(gen);
+    }
+
+    State m(p, divs, cap, cond, area, intdom);
+
+    unsigned n_intdom = paired? (n_cell+1)/2: n_cell;
+    array dt(n_intdom, 0.025);
+    array v(n_cell), i(n_cell), g(n_cell);
+    for (unsigned k = 0; k<n_cell; ++k) {
+        v[k] = -65+dist(gen);
+        i[k] = 0.1*dist(gen);
+        g[k] = 0.01*dist(gen);
+    }
+
+    while (state.KeepRunning()) {
+        m.assemble(dt, v, i, g);
+        m.solve(v);
+        benchmark::ClobberMemory();
+    }
+}
+
+void bench_matrix_flat(benchmark::State& state) {
+    run_matrix<multicore::matrix_state<value_type, index_type>>(state);
+}
+
+void bench_matrix_interleaved(benchmark::State& state) {
+    run_matrix<multicore::matrix_state_interleaved<value_type, index_type>>(state);
+}
+
+void bench_matrix_diagonal(benchmark::State& state) {
+    run_matrix<multicore::matrix_state_diagonal<value_type, index_type>>(state);
+}
+
+class point_cell_recipe: public recipe {
+public:
+    point_cell_recipe() {
+        gprop_.default_parameters = neuron_parameter_defaults;
+    }
+
+    cell_size_type num_cells() const override { return n_cell; }
+
+    cell_kind get_cell_kind(cell_gid_type) const override {
+        return cell_kind::cable;
+    }
+
+    util::any get_global_properties(cell_kind) const override {
+        return gprop_;
+    }
+
+    util::unique_any get_cell_description(cell_gid_type gid) const override {
+        sample_tree tree;
+        tree.append(mnpos, {{0, 0, 0, 12.6157/2.0}, 1});
+
+        label_dict dict;
+        dict.set("soma", reg::tagged(1));
+
+        cable_cell c(morphology(tree, true), dict, true);
+        c.paint("soma", "hh");
+        if (gid%2) {
+            c.place(mlocation{0, 0.5}, i_clamp{0, 1e9, 0.1});
+        }
+        return c;
+    }
+
+private:
+    cable_cell_global_properties gprop_;
+};
+
+// Time 1 ms of integration per iteration.
+void bench_integrate(benchmark::State& state) {
+    point_cell_recipe rec;
+    std::vector<cell_gid_type> gids;
+    for (cell_gid_type i = 0; i<n_cell; ++i) {
+        gids.push_back(i);
+    }
+
+    execution_context context;
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map<probe_handle> probe_map;
+
+    fvm_cell cell(context);
+    cell.initialize(gids, rec, cell_to_intdom, targets, probe_map);
+
+    fvm_value_type t = 0;
+    while (state.KeepRunning()) {
+        t += 1;
+        cell.integrate(t, 0.025, {}, {});
+    }
+}
+
+BENCHMARK(bench_matrix_flat)->Arg(0)->Arg(1);
+BENCHMARK(bench_matrix_interleaved)->Arg(0)->Arg(1);
+BENCHMARK(bench_matrix_diagonal)->Arg(0)->Arg(1);
+BENCHMARK(bench_integrate)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
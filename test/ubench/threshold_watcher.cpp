@@ -0,0 +1,145 @@
+// Compare the vectorized threshold watcher of the multicore back end with
+// the scalar state machine it replaces.
+//
+// 10^5 detectors watch 10^5 CVs with a threshold of 0 mV. Each iteration
+// tests the detectors 100 times, with the voltages alternating between a
+// resting state and one in which a fraction of the CVs, given in 1/1000 by
+// the benchmark argument, are depolarized; that fraction of the detectors
+// cross their threshold on every second test.
+
+#include <random>
+#include <vector>
+
+#include <arbor/fvm_types.hpp>
+#include <arbor/math.hpp>
+
+#include "backends/multicore/threshold_watcher.hpp"
+#include "backends/threshold_crossing.hpp"
+#include "benchmark/benchmark.h"
+#include "execution_context.hpp"
+
+using namespace arb;
+
+constexpr unsigned n_cv = 100000;
+constexpr unsigned n_test = 100;
+
+// The scalar state machine, with one flag per detector.
+class scalar_watcher {
+public:
+    scalar_watcher(
+        const fvm_index_type* cv_to_intdom,
+        const fvm_value_type* t_before,
+        const fvm_value_type* t_after,
+        const fvm_value_type* values,
+        const std::vector<fvm_index_type>& cv_index,
+        const std::vector<fvm_value_type>& thresholds
+    ):
+        cv_to_intdom_(cv_to_intdom),
+        t_before_(t_before),
+        t_after_(t_after),
+        values_(values),
+        n_cv_(cv_index.size()),
+        cv_index_(cv_index),
+        is_crossed_(n_cv_),
+        thresholds_(thresholds),
+        v_prev_(n_cv_)
+    {
+        for (fvm_size_type i = 0; i<n_cv_; ++i) {
+            v_prev_[i] = values_[cv_index_[i]];
+            is_crossed_[i] = v_prev_[i]>=thresholds_[i];
+        }
+    }
+
+    void clear_crossings() {
+        crossings_.clear();
+    }
+
+    void test() {
+        for (fvm_size_type i = 0; i<n_cv_; ++i) {
+            auto cv     = cv_index_[i];
+            auto cell   = cv_to_intdom_[cv];
+            auto v_prev = v_prev_[i];
+            auto v      = values_[cv];
+            auto thresh = thresholds_[i];
+
+            if (!is_crossed_[i]) {
+                if (v>=thresh) {
+                    auto pos = (thresh - v_prev)/(v - v_prev);
+                    auto crossing_time = math::lerp(t_before_[cell], t_after_[cell], pos);
+                    crossings_.push_back({i, crossing_time});
+
+                    is_crossed_[i] = true;
+                }
+            }
+            else {
+                if (v<thresh) {
+                    is_crossed_[i] = false;
+                }
+            }
+
+            v_prev_[i] = v;
+        }
+    }
+
+private:
+    const fvm_index_type* cv_to_intdom_;
+    const fvm_value_type* t_before_;
+    const fvm_value_type* t_after_;
+    const fvm_value_type* values_;
+
+    fvm_size_type n_cv_;
+    std::vector<fvm_index_type> cv_index_;
+    std::vector<fvm_size_type> is_crossed_;
+    std::vector<fvm_value_type> thresholds_;
+    std::vector<fvm_value_type> v_prev_;
+    std::vector<threshold_crossing> crossings_;
+};
+
+template <typename Watcher, typename... Args>
+void run_watcher(benchmark::State& state, Args&&... args) {
+    double fraction = state.range(0)/1000.;
+
+    std::vector<fvm_index_type> cv_to_intdom(n_cv), cv_index(n_cv);
+    for (unsigned i = 0; i<n_cv; ++i) {
+        cv_to_intdom[i] = i;
+        cv_index[i] = i;
+    }
+    std::vector<fvm_value_type> thresholds(n_cv, 0);
+    std::vector<fvm_value_type> t_before(n_cv, 0), t_after(n_cv, 0.025);
+
+    std::vector<fvm_value_type> values(n_cv);
+    std::vector<unsigned> active;
+    std::minstd_rand gen(0);
+    std::uniform_real_distribution<fvm_value_type> U(0, 1);
+    for (unsigned i = 0; i<n_cv; ++i) {
+        values[i] = -70+U(gen);
+        if (U(gen)<fraction) active.push_back(i);
+    }
+
+    Watcher watch(cv_to_intdom.data(), t_before.data(), t_after.data(), values.data(), cv_index, thresholds, args...);
+
+    while (state.KeepRunning()) {
+        for (unsigned k = 0; k<n_test; ++k) {
+            for (auto i: active) {
+                values[i] = k%2? -70: 20;
+            }
+            watch.test();
+        }
+        watch.clear_crossings();
+        benchmark::ClobberMemory();
+    }
+}
+
+void bench_scalar(benchmark::State& state) {
+    run_watcher<scalar_watcher>(state);
+}
+
+void bench_simd(benchmark::State& state) {
+    execution_context context;
+    run_watcher<multicore::threshold_watcher>(state, context);
+}
+
+BENCHMARK(bench_scalar)->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_simd)->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
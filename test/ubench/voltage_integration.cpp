@@ -0,0 +1,148 @@
+// Compare the cost and accuracy of the voltage integration schemes of
+// cable_cell_global_properties::voltage_scheme over a range of time steps.
+//
+// Each iteration simulates 20 ms of a single cell, sampling the soma voltage
+// every 0.2 ms. The counter `error` is the largest difference of the samples
+// [mV] from a Crank–Nicolson reference run with a time step of 0.2/256 ms.
+// Two cells are simulated: a passive ball-and-stick cell, and one with HH
+// channels on the soma that fires repeatedly; both are driven by a current
+// clamp at the end of the dendrite.
+//
+// The script validation/convergence/plot_convergence.py plots error against
+// run time from the JSON output of the benchmark.
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <arbor/cable_cell.hpp>
+#include <arbor/morph/morphology.hpp>
+#include <arbor/recipe.hpp>
+
+#include "backends/multicore/fvm.hpp"
+#include "benchmark/benchmark.h"
+#include "execution_context.hpp"
+#include "fvm_lowered_cell_impl.hpp"
+
+using namespace arb;
+
+using backend = multicore::backend;
+using fvm_cell = fvm_lowered_cell_impl<backend>;
+
+constexpr double t_end = 20;
+constexpr double t_sample = 0.2;
+
+class ball_and_stick_recipe: public recipe {
+public:
+    ball_and_stick_recipe(bool active, voltage_integration scheme): active_(active) {
+        gprop_.default_parameters = neuron_parameter_defaults;
+        gprop_.voltage_scheme = scheme;
+    }
+
+    cell_size_type num_cells() const override { return 1; }
+    cell_size_type num_probes(cell_gid_type) const override { return 1; }
+
+    cell_kind get_cell_kind(cell_gid_type) const override {
+        return cell_kind::cable;
+    }
+
+    util::any get_global_properties(cell_kind) const override {
+        return gprop_;
+    }
+
+    probe_info get_probe(cell_member_type id) const override {
+        return {id, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage}};
+    }
+
+    util::unique_any get_cell_description(cell_gid_type) const override {
+        const double soma_radius = 12.6157/2.0;
+        const unsigned n_cv = 20;
+        const double length = 200;
+
+        sample_tree tree;
+        tree.append(mnpos, {{0, 0, 0, soma_radius}, 1});
+        auto p = tree.append(0, {{0, 0, soma_radius, 0.5}, 3});
+        for (unsigned k = 1; k<=n_cv; ++k) {
+            p = tree.append(p, {{0, 0, soma_radius+k*length/n_cv, 0.5}, 3});
+        }
+
+        label_dict dict;
+        dict.set("soma", reg::tagged(1));
+        dict.set("dend", reg::tagged(3));
+
+        cable_cell c(morphology(tree, true), dict, true);
+        c.paint("soma", active_? "hh": "pas");
+        c.paint("dend", "pas");
+        c.place(mlocation{1, 1}, i_clamp{1, t_end, active_? 0.4: 0.1});
+        return c;
+    }
+
+private:
+    bool active_;
+    cable_cell_global_properties gprop_;
+};
+
+// Soma voltage at each sample time.
+std::vector<fvm_value_type> run(const recipe& rec, fvm_value_type dt) {
+    execution_context context;
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map<probe_handle> probe_map;
+
+    fvm_cell cell(context);
+    cell.initialize({0}, rec, cell_to_intdom, targets, probe_map);
+    auto handle = probe_map.at({0, 0}).handle;
+
+    std::vector<fvm_value_type> trace;
+    for (unsigned i = 1; i*t_sample<=t_end+1e-9; ++i) {
+        cell.integrate(i*t_sample, dt, {}, {});
+        trace.push_back(*handle);
+    }
+    return trace;
+}
+
+const std::vector<fvm_value_type>& reference(bool active) {
+    static std::map<bool, std::vector<fvm_value_type>> refs;
+    auto& ref = refs[active];
+    if (ref.empty()) {
+        ref = run(ball_and_stick_recipe(active, voltage_integration::crank_nicolson), t_sample/256);
+    }
+    return ref;
+}
+
+void bench_voltage_integration(benchmark::State& state) {
+    bool active = state.range(0);
+    auto scheme = voltage_integration(state.range(1));
+    fvm_value_type dt = t_sample/state.range(2);
+
+    ball_and_stick_recipe rec(active, scheme);
+    const auto& ref = reference(active);
+
+    std::vector<fvm_value_type> trace;
+    while (state.KeepRunning()) {
+        trace = run(rec, dt);
+    }
+
+    double error = 0;
+    for (unsigned i = 0; i<trace.size(); ++i) {
+        error = std::max(error, std::abs(trace[i]-ref[i]));
+    }
+    state.counters["dt"] = dt;
+    state.counters["error"] = error;
+}
+
+void run_custom_arguments(benchmark::internal::Benchmark* b) {
+    for (auto active: {0, 1}) {
+        for (auto scheme: {voltage_integration::backward_euler, voltage_integration::crank_nicolson}) {
+            for (auto steps_per_sample: {1, 2, 4, 8, 16, 32}) {
+                b->Args({active, int(scheme), steps_per_sample});
+            }
+        }
+    }
+}
+
+BENCHMARK(bench_voltage_integration)->Apply(run_custom_arguments)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
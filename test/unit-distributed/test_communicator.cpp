@@ -179,6 +179,30 @@ TEST(communicator, gather_gids_variant) {
     }
 }
 
+// Test low level halo gather function when the number of values per domain
+// are not equal.
+TEST(communicator, gather_halo_variant) {
+    const auto num_domains = g_context->distributed->size();
+    const auto rank = g_context->distributed->id();
+
+    // Rank r contributes r+1 copies of the value r.
+    std::vector<fvm_value_type> local_values(rank+1, fvm_value_type(rank));
+
+    const auto global_values = g_context->distributed->gather_halo(local_values);
+
+    const auto& part = global_values.partition();
+    ASSERT_EQ(unsigned(num_domains+1), part.size());
+    for (auto i=0u; i<part.size(); ++i) {
+        EXPECT_EQ(i*(i+1)/2, part[i]);
+    }
+
+    for (auto domain=0; domain<num_domains; ++domain) {
+        for (auto j: util::make_span(part[domain], part[domain+1])) {
+            EXPECT_EQ(fvm_value_type(domain), global_values.values()[j]);
+        }
+    }
+}
+
 namespace {
     // Population of cable and rss cells with ring connection topology.
     // Even gid are rss, and odd gid are cable cells.
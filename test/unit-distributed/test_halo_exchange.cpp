@@ -0,0 +1,116 @@
+#include "../gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <arbor/cable_cell.hpp>
+#include <arbor/context.hpp>
+#include <arbor/domain_decomposition.hpp>
+#include <arbor/load_balance.hpp>
+#include <arbor/recipe.hpp>
+#include <arbor/sampling.hpp>
+#include <arbor/schedule.hpp>
+#include <arbor/simulation.hpp>
+#include <arbor/util/any_ptr.hpp>
+
+#include "util/span.hpp"
+
+#include "../common_cells.hpp"
+#include "test.hpp"
+
+using namespace arb;
+
+namespace {
+    // A chain of soma-only HH cells, two per domain, coupled by gap
+    // junctions between neighbours, with a stimulus on the first cell.
+    class gj_chain_recipe: public recipe {
+    public:
+        gj_chain_recipe(cell_size_type n): n_(n) {
+            gprop_.default_parameters = neuron_parameter_defaults;
+        }
+
+        cell_size_type num_cells() const override { return n_; }
+
+        cell_kind get_cell_kind(cell_gid_type) const override {
+            return cell_kind::cable;
+        }
+
+        util::unique_any get_cell_description(cell_gid_type gid) const override {
+            auto c = make_cell_soma_only(gid==0);
+            c.place(mlocation{0, 0.5}, gap_junction_site{});
+            return c;
+        }
+
+        cell_size_type num_probes(cell_gid_type) const override { return 1; }
+
+        probe_info get_probe(cell_member_type id) const override {
+            return {id, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage}};
+        }
+
+        std::vector<gap_junction_connection> gap_junctions_on(cell_gid_type gid) const override {
+            std::vector<gap_junction_connection> conns;
+            if (gid>0) {
+                conns.push_back(gap_junction_connection({gid-1, 0}, {gid, 0}, 0.01));
+            }
+            if (gid+1<n_) {
+                conns.push_back(gap_junction_connection({gid+1, 0}, {gid, 0}, 0.01));
+            }
+            return conns;
+        }
+
+        util::any get_global_properties(cell_kind) const override {
+            return gprop_;
+        }
+
+    private:
+        cell_size_type n_;
+        cable_cell_global_properties gprop_;
+    };
+
+    // Sample the voltage of each local cell every 0.5 ms for 30 ms.
+    std::vector<std::vector<double>> run_chain(const recipe& rec, const context& ctx, const partition_hint_map& hints) {
+        auto decomp = partition_load_balance(rec, ctx, hints);
+
+        std::vector<std::vector<double>> traces(rec.num_cells());
+        sampler_function sampler = [&](cell_member_type pid, probe_tag, std::size_t n, const sample_record* records) {
+            for (std::size_t i = 0; i<n; ++i) {
+                traces[pid.gid].push_back(*util::any_cast<const double*>(records[i].data));
+            }
+        };
+
+        simulation sim(rec, decomp, ctx);
+        sim.add_sampler(all_probes, regular_schedule(0.5), sampler);
+        sim.run(30, 0.025);
+
+        return traces;
+    }
+}
+
+TEST(halo_exchange, chain) {
+    const auto n_domain = num_ranks(g_context);
+    gj_chain_recipe rec(2*n_domain);
+
+    // Reference: the whole chain in one cell group on a local context.
+    auto ref = run_chain(rec, make_context(), {});
+
+    // One cell per group, with the chain split across groups and domains.
+    partition_hint_map hints;
+    hints[cell_kind::cable].cpu_group_size = 1;
+    hints[cell_kind::cable].prefer_gpu = false;
+    hints[cell_kind::cable].split_gap_junctions = true;
+    auto split = run_chain(rec, g_context, hints);
+
+    auto decomp = partition_load_balance(rec, g_context, hints);
+    for (const auto& group: decomp.groups) {
+        for (auto gid: group.gids) {
+            ASSERT_EQ(ref[gid].size(), split[gid].size());
+
+            double d = 0;
+            for (auto i: util::count_along(ref[gid])) {
+                d = std::max(d, std::abs(ref[gid][i]-split[gid][i]));
+            }
+            EXPECT_GT(0.5, d);
+        }
+    }
+}
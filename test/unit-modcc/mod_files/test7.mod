@@ -0,0 +1,43 @@
+NEURON {
+    SUFFIX test7
+    USEION k READ ek WRITE ik
+    RANGE gbar, sh
+}
+
+PARAMETER {
+    gbar = 0.01
+    sh = 0
+    k = 2
+    celsius
+}
+
+ASSIGNED {
+    v
+    minf
+    mtau
+}
+
+STATE {
+    m
+}
+
+BREAKPOINT {
+    SOLVE states METHOD cnexp
+    ik = gbar*m*(v - ek)
+}
+
+INITIAL {
+    rates(v, sh, celsius)
+    m = minf
+}
+
+DERIVATIVE states {
+    rates(v, sh, celsius)
+    m' = (minf-m)/mtau
+}
+
+PROCEDURE rates(vm, sh2, temp) {
+    TABLE minf, mtau DEPEND sh, celsius FROM -100 TO 100 WITH 200
+    minf = 1/(1+exp(-(vm-sh2)/k))
+    mtau = 3^((temp-6.3)/10)
+}
@@ -1,6 +1,7 @@
 #include "common.hpp"
 #include "io/bulkio.hpp"
 #include "module.hpp"
+#include "parser.hpp"
 
 TEST(Module, open) {
     Module m(io::read_all(DATADIR "/mod_files/test0.mod"), "test0.mod");
@@ -43,3 +44,126 @@ TEST(Module, linear_mechanisms) {
         }
     }
 }
+
+// Parse and analyse a mechanism with a rate procedure with the given TABLE
+// statement (if any) and body.
+static bool table_module(Module& m) {
+    Parser p(m, false);
+    return p.parse() && m.semantic();
+}
+
+static std::string table_source(const std::string& table, const std::string& body, const std::string& call = "v, sh, celsius") {
+    return
+        "NEURON {\n"
+        "    SUFFIX tab\n"
+        "    RANGE g, sh\n"
+        "}\n"
+        "PARAMETER {\n"
+        "    g = 1\n"
+        "    sh = 0\n"
+        "    k = 2\n"
+        "    celsius\n"
+        "}\n"
+        "ASSIGNED {\n"
+        "    v\n"
+        "    minf\n"
+        "    mtau\n"
+        "    x\n"
+        "}\n"
+        "STATE {\n"
+        "    m\n"
+        "}\n"
+        "BREAKPOINT {\n"
+        "    SOLVE states METHOD cnexp\n"
+        "}\n"
+        "INITIAL {\n"
+        "    rates("+call+")\n"
+        "    m = minf\n"
+        "}\n"
+        "DERIVATIVE states {\n"
+        "    rates("+call+")\n"
+        "    m' = (minf-m)/mtau\n"
+        "}\n"
+        "PROCEDURE rates(vm, sh2, temp) {\n"
+        "    "+table+"\n"
+        "    "+body+"\n"
+        "}\n";
+}
+
+TEST(Module, table) {
+    const std::string body = "minf = 1/(1+exp(-(vm-sh2)/k))\n    mtau = 3^((temp-6.3)/10)";
+
+    {
+        Module m(table_source("TABLE minf, mtau DEPEND sh, celsius FROM -100 TO 100 WITH 200", body), "tab.mod");
+        EXPECT_TRUE(table_module(m));
+
+        auto table = m.symbols().at("rates")->is_procedure()->table();
+        ASSERT_TRUE(table);
+        EXPECT_EQ(2u, table->outputs().size());
+        EXPECT_EQ(2u, table->uniform().size());
+        ASSERT_EQ(2u, table->arguments().size());
+        EXPECT_EQ("sh", table->arguments()[0]->name());
+        EXPECT_EQ("celsius", table->arguments()[1]->name());
+    }
+
+    // Arguments bound to range variables or the temperature must be in DEPEND.
+    {
+        Module m(table_source("TABLE minf, mtau DEPEND sh FROM -100 TO 100 WITH 200", body), "tab.mod");
+        EXPECT_FALSE(table_module(m));
+    }
+
+    // The TABLE lists exactly the range variables assigned in the procedure.
+    {
+        Module m(table_source("TABLE minf DEPEND sh, celsius FROM -100 TO 100 WITH 200", body), "tab.mod");
+        EXPECT_FALSE(table_module(m));
+    }
+    {
+        Module m(table_source("TABLE minf, mtau, x DEPEND sh, celsius FROM -100 TO 100 WITH 200", body), "tab.mod");
+        EXPECT_FALSE(table_module(m));
+    }
+
+    // Range parameters read in the procedure must be in DEPEND.
+    {
+        Module m(table_source("TABLE minf, mtau DEPEND sh, celsius FROM -100 TO 100 WITH 200", body+"\n    minf = g*minf"), "tab.mod");
+        EXPECT_FALSE(table_module(m));
+    }
+    {
+        Module m(table_source("TABLE minf, mtau DEPEND g, sh, celsius FROM -100 TO 100 WITH 200", body+"\n    minf = g*minf"), "tab.mod");
+        EXPECT_TRUE(table_module(m));
+    }
+
+    // Arguments must be the same parameter at every call.
+    {
+        Module m(table_source("TABLE minf, mtau DEPEND sh, celsius FROM -100 TO 100 WITH 200", body, "v, 1, celsius"), "tab.mod");
+        EXPECT_FALSE(table_module(m));
+    }
+}
+
+TEST(Module, default_tables) {
+    const std::string body = "minf = 1/(1+exp(-(vm-sh2)/k))\n    mtau = 3^((temp-6.3)/10)";
+
+    {
+        Module m(table_source("", body), "tab.mod");
+        m.default_tables(true);
+        EXPECT_TRUE(table_module(m));
+
+        auto table = m.symbols().at("rates")->is_procedure()->table();
+        ASSERT_TRUE(table);
+        EXPECT_EQ(2u, table->outputs().size());
+        EXPECT_EQ(2u, table->uniform().size());
+    }
+
+    // Procedures are only tabulated over the membrane voltage.
+    {
+        Module m(table_source("", body, "sh, sh, celsius"), "tab.mod");
+        m.default_tables(true);
+        EXPECT_TRUE(table_module(m));
+        EXPECT_FALSE(m.symbols().at("rates")->is_procedure()->table());
+    }
+
+    {
+        Module m(table_source("", body), "tab.mod");
+        EXPECT_TRUE(table_module(m));
+        EXPECT_FALSE(m.symbols().at("rates")->is_procedure()->table());
+    }
+}
@@ -226,6 +226,73 @@ TEST(Parser, parse_conductance) {
     }
 }
 
+TEST(Parser, parse_table) {
+    std::unique_ptr<TableExpression> s;
+
+    EXPECT_TRUE(check_parse(s, &Parser::parse_table_statement, "TABLE minf, mtau DEPEND celsius, sh FROM -100 TO 100 WITH 200"));
+    if (s) {
+        EXPECT_EQ((std::vector<std::string>{"minf", "mtau"}), s->vars());
+        EXPECT_EQ((std::vector<std::string>{"celsius", "sh"}), s->depend());
+        EXPECT_EQ(-100., s->from());
+        EXPECT_EQ(100., s->to());
+        EXPECT_EQ(200, s->n());
+    }
+
+    EXPECT_TRUE(check_parse(s, &Parser::parse_table_statement, "TABLE ninf FROM -80.5 TO 40 WITH 10"));
+    if (s) {
+        EXPECT_EQ(std::vector<std::string>{"ninf"}, s->vars());
+        EXPECT_TRUE(s->depend().empty());
+        EXPECT_EQ(-80.5, s->from());
+        EXPECT_EQ(10, s->n());
+    }
+
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_table_statement, "TABLE FROM -100 TO 100 WITH 200"));
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_table_statement, "TABLE minf DEPEND FROM -100 TO 100 WITH 200"));
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_table_statement, "TABLE minf FROM -100 TO 100"));
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_table_statement, "TABLE minf FROM -100 TO 100 WITH 2.5"));
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_table_statement, "TABLE minf FROM 100 TO -100 WITH 200"));
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_table_statement, "TABLE minf FROM -100 TO 100 WITH 0"));
+}
+
+TEST(Parser, procedure_table) {
+    const char* with_table =
+        "PROCEDURE rates(v) {\n"
+        "    TABLE minf FROM -100 TO 100 WITH 200\n"
+        "    minf = 1/(1+exp(-v))\n"
+        "}";
+
+    std::unique_ptr<ProcedureExpression> proc;
+    EXPECT_TRUE(check_parse(proc, &Parser::parse_procedure, with_table));
+    if (proc) {
+        ASSERT_TRUE(proc->table());
+        EXPECT_EQ(std::vector<std::string>{"minf"}, proc->table()->vars());
+        // The TABLE statement is moved out of the body.
+        EXPECT_EQ(1u, proc->body()->is_block()->statements().size());
+    }
+
+    const char* two_tables =
+        "PROCEDURE rates(v) {\n"
+        "    TABLE minf FROM -100 TO 100 WITH 200\n"
+        "    TABLE minf FROM -100 TO 100 WITH 200\n"
+        "    minf = 1/(1+exp(-v))\n"
+        "}";
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_procedure, two_tables));
+
+    const char* in_function =
+        "FUNCTION f(v) {\n"
+        "    TABLE x FROM -100 TO 100 WITH 200\n"
+        "    f = 1/(1+exp(-v))\n"
+        "}";
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_function, in_function));
+
+    const char* in_initial =
+        "INITIAL {\n"
+        "    TABLE minf FROM -100 TO 100 WITH 200\n"
+        "    minf = 1\n"
+        "}";
+    EXPECT_TRUE(check_parse_fail(&Parser::parse_procedure, in_initial));
+}
+
 TEST(Parser, parse_if) {
     std::unique_ptr<IfExpression> s;
 
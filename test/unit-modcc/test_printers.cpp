@@ -160,6 +160,42 @@ TEST(CPrinter, proc_body) {
     }
 }
 
+TEST(CPrinter, proc_body_single_state) {
+    const char* source =
+        "PROCEDURE trates(v) {\n"
+        "    minf = 1-1/(1+exp((v-m)/m))\n"
+        "    m = m + minf\n"
+        "}";
+
+    // Range variables stored in single precision are converted on read.
+    const char* expected =
+        "minf[i_] = 1-1/(1+exp((v-value_type(m[i_]))/value_type(m[i_])));\n"
+        "m[i_] = value_type(m[i_])+value_type(minf[i_]);\n";
+
+    Scope<Symbol>::symbol_map globals;
+    globals["minf"] = make_symbol<VariableExpression>(Location(), "minf");
+    globals["m"] = make_symbol<VariableExpression>(Location(), "m");
+    globals["m"]->is_variable()->state(true);
+
+    expression_ptr e = parse_procedure(source);
+    ASSERT_TRUE(e->is_symbol());
+
+    auto procname = e->is_symbol()->name();
+    auto& proc = (globals[procname] = symbol_ptr(e.release()->is_symbol()));
+
+    proc->semantic(globals);
+    std::stringstream out;
+    auto v = std::make_unique<CPrinter>(out);
+    v->set_single_state(true);
+    proc->is_procedure()->body()->accept(v.get());
+    std::string text = out.str();
+
+    verbose_print(proc->is_procedure()->body()->to_string());
+    verbose_print(" :--: ", text);
+
+    EXPECT_EQ(strip(expected), strip(text));
+}
+
 TEST(CPrinter, proc_body_const) {
     std::vector<testcase> testcases = {
             {
@@ -255,4 +291,30 @@ TEST(CPrinter, proc_body_inlined) {
     proc_with_locals.erase(0, proc_with_locals.find(";") + 1);
 
     EXPECT_EQ(strip(expected), proc_with_locals);
-}
\ No newline at end of file
+}
+TEST(CPrinter, table) {
+    Module m(io::read_all(DATADIR "/mod_files/test7.mod"), "test7.mod");
+    Parser p(m, false);
+    p.parse();
+    ASSERT_TRUE(m.semantic());
+
+    printer_options opt;
+    opt.cpp_namespace = "testing";
+    auto text = strip(emit_cpp_source(m, opt));
+    verbose_print(text);
+
+    // The table is filled on initialization, and calls are replaced by a
+    // lookup when it is valid.
+    auto expected = {
+        "std::vector<value_type> rates_table_;",
+        "void mechanism_cpu_test7::nrn_init() {tabulate_rates();",
+        "(rates_table_valid_? rates_lookup(i_, v): rates(i_, v, (sh_uniform_? sh[0]: sh[i_]), celsius));",
+        "if ((!sh_uniform_ && sh[i_]!=sh[0]) || temperature_degC_[node_index_[i_]]!=temperature_degC_[node_index_[0]]) return;",
+        "rates(0, -100+j_*1, sh[0], temperature_degC_[node_index_[0]]);",
+        "minf[i_] = p_[0]+t_*(p_[1]-p_[0]);",
+        "mtau[i_] = p_[201]+t_*(p_[202]-p_[201]);",
+    };
+    for (auto e: expected) {
+        EXPECT_NE(std::string::npos, text.find(strip(e))) << e;
+    }
+}
@@ -0,0 +1,99 @@
+// Interposed malloc-family functions for malloc instrumentation
+// with glibc versions that no longer provide malloc hooks.
+//
+// Allocation requests are forwarded to the glibc implementations;
+// if a `with_instrumented_malloc` object is active, its callback
+// is invoked first, with instrumentation suspended for the
+// duration of the callback.
+
+#include <cerrno>
+#include <cstddef>
+
+#include "instrument_malloc.hpp"
+
+#ifdef INSTRUMENT_MALLOC_INTERPOSE
+
+extern "C" {
+void* __libc_malloc(std::size_t);
+void* __libc_realloc(void*, std::size_t);
+void* __libc_memalign(std::size_t, std::size_t);
+void __libc_free(void*);
+}
+
+using testing::with_instrumented_malloc;
+
+namespace {
+
+struct suspend_guard {
+    with_instrumented_malloc* p;
+
+    suspend_guard(with_instrumented_malloc* p): p(p) { with_instrumented_malloc::instance() = nullptr; }
+    ~suspend_guard() { with_instrumented_malloc::instance() = p; }
+};
+
+bool valid_alignment(std::size_t alignment) {
+    return alignment && !(alignment&(alignment-1));
+}
+
+} // anonymous namespace
+
+extern "C" void* malloc(std::size_t size) {
+    if (auto p = with_instrumented_malloc::instance()) {
+        suspend_guard g(p);
+        p->on_malloc(size, __builtin_return_address(0));
+    }
+    return __libc_malloc(size);
+}
+
+extern "C" void* realloc(void* ptr, std::size_t size) {
+    if (auto p = with_instrumented_malloc::instance()) {
+        suspend_guard g(p);
+        p->on_realloc(ptr, size, __builtin_return_address(0));
+    }
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void* ptr) {
+    if (auto p = with_instrumented_malloc::instance()) {
+        suspend_guard g(p);
+        p->on_free(ptr, __builtin_return_address(0));
+    }
+    __libc_free(ptr);
+}
+
+extern "C" void* memalign(std::size_t alignment, std::size_t size) {
+    if (auto p = with_instrumented_malloc::instance()) {
+        suspend_guard g(p);
+        p->on_memalign(alignment, size, __builtin_return_address(0));
+    }
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" void* aligned_alloc(std::size_t alignment, std::size_t size) {
+    if (!valid_alignment(alignment)) {
+        errno = EINVAL;
+        return nullptr;
+    }
+    return memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) {
+    if (!valid_alignment(alignment) || alignment%sizeof(void*)) {
+        return EINVAL;
+    }
+
+    if (auto p = with_instrumented_malloc::instance()) {
+        suspend_guard g(p);
+        p->on_memalign(alignment, size, __builtin_return_address(0));
+    }
+
+    void* mem = __libc_memalign(alignment, size);
+    if (!mem) {
+        return ENOMEM;
+    }
+
+    *ptr = mem;
+    return 0;
+}
+
+#endif // def INSTRUMENT_MALLOC_INTERPOSE
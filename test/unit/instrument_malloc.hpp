@@ -17,12 +17,21 @@
 //
 // Calling code should check CAN_INSTRUMENT_MALLOC preprocessor
 // symbol to see if this functionality is available.
+//
+// glibc 2.34 removed the malloc hooks; with newer versions the unit
+// test executable instead interposes the malloc-family functions
+// (see instrument_malloc.cpp), which forward to the glibc
+// implementations.
 
 #include <cstddef>
+#include <stdexcept>
 
 #if (__GLIBC__==2)
 #include <malloc.h>
 #define CAN_INSTRUMENT_MALLOC
+#if (__GLIBC_MINOR__>=34)
+#define INSTRUMENT_MALLOC_INTERPOSE
+#endif
 #endif
 
 // Disable if using address sanitizer though:
@@ -40,7 +49,34 @@
 
 namespace testing {
 
-#ifdef CAN_INSTRUMENT_MALLOC
+#if defined(CAN_INSTRUMENT_MALLOC) && defined(INSTRUMENT_MALLOC_INTERPOSE)
+
+// Totally not thread safe!
+struct with_instrumented_malloc {
+    with_instrumented_malloc(): prev_(instance()) {
+        instance() = this;
+    }
+
+    ~with_instrumented_malloc() {
+        instance() = prev_;
+    }
+
+    virtual void on_malloc(std::size_t, const void*) {}
+    virtual void on_realloc(void*, std::size_t, const void*) {}
+    virtual void on_free(void*, const void*) {}
+    virtual void on_memalign(std::size_t, std::size_t, const void*) {}
+
+    // Instance notified by the interposed allocation functions, if any.
+    static with_instrumented_malloc*& instance() {
+        static with_instrumented_malloc* ptr = nullptr;
+        return ptr;
+    }
+
+private:
+    with_instrumented_malloc* prev_;
+};
+
+#elif defined(CAN_INSTRUMENT_MALLOC)
 
 // For run-time, temporary intervention in the malloc-family calls,
 // there is still no better alternative than to use the
@@ -18,13 +18,31 @@ using field_table_type = std::vector<std::pair<const char*, fvm_value_type**>>;
 
 // Multicore mechanisms:
 
+using uniform_table_type = std::vector<std::pair<const char*, bool*>>;
+using single_field_table_type = std::vector<std::pair<const char*, multicore::mechanism::single_type**>>;
+
 ACCESS_BIND(field_table_type (multicore::mechanism::*)(), multicore_field_table_ptr, &multicore::mechanism::field_table)
+ACCESS_BIND(uniform_table_type (multicore::mechanism::*)(), multicore_uniform_table_ptr, &multicore::mechanism::uniform_table)
+ACCESS_BIND(single_field_table_type (multicore::mechanism::*)(), multicore_single_field_table_ptr, &multicore::mechanism::single_field_table)
 
 std::vector<fvm_value_type> mechanism_field(multicore::mechanism* m, const std::string& key) {
     auto opt_ptr = util::value_by_key((m->*multicore_field_table_ptr)(), key);
-    if (!opt_ptr) throw std::logic_error("internal error: no such field in mechanism");
+    if (!opt_ptr) {
+        // Fields stored in single precision are converted on copy.
+        auto opt_single_ptr = util::value_by_key((m->*multicore_single_field_table_ptr)(), key);
+        if (!opt_single_ptr) throw std::logic_error("internal error: no such field in mechanism");
+
+        const multicore::mechanism::single_type* field_data = *opt_single_ptr.value();
+        return std::vector<fvm_value_type>(field_data, field_data+m->size());
+    }
 
     const fvm_value_type* field_data = *opt_ptr.value();
+
+    // A uniform range parameter holds one value for all instances.
+    auto opt_uniform = util::value_by_key((m->*multicore_uniform_table_ptr)(), key);
+    if (opt_uniform && *opt_uniform.value()) {
+        return std::vector<fvm_value_type>(m->size(), field_data[0]);
+    }
     return std::vector<fvm_value_type>(field_data, field_data+m->size());
 }
 
@@ -352,4 +352,17 @@ TEST(domain_decomposition, compulsory_groups)
 
     EXPECT_EQ(expected_groups2, D2.groups[0].gids);
 
+    // With gap junctions split, cells are grouped in gid order.
+    hints[cell_kind::cable].cpu_group_size = 4;
+    hints[cell_kind::cable].split_gap_junctions = true;
+
+    const auto D3 = partition_load_balance(R, ctx, hints);
+    EXPECT_EQ(4u, D3.groups.size());
+
+    std::vector<std::vector<cell_gid_type>> expected_groups3 =
+            { {0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}, {12, 13, 14} };
+
+    for (unsigned i = 0; i < 4u; i++) {
+        EXPECT_EQ(expected_groups3[i], D3.groups[i].gids);
+    }
 }
@@ -117,3 +117,23 @@ TEST(dry_run_context, gather_gids)
     EXPECT_EQ(part[3], gids.size()*3);
     EXPECT_EQ(part[4], gids.size()*4);
 }
+
+TEST(dry_run_context, gather_halo)
+{
+    distributed_context_handle ctx = arb::make_dry_run_context(4, 4);
+    using hvec = std::vector<arb::fvm_value_type>;
+
+    hvec values = {-65., -70.};
+    hvec gathered_values = {-65., -70., -65., -70., -65., -70., -65., -70.};
+
+    auto s = ctx->gather_halo(values);
+    auto& part = s.partition();
+
+    EXPECT_EQ(s.values(), gathered_values);
+    EXPECT_EQ(part.size(), 5u);
+    EXPECT_EQ(part[0], 0u);
+    EXPECT_EQ(part[1], values.size());
+    EXPECT_EQ(part[2], values.size()*2);
+    EXPECT_EQ(part[3], values.size()*3);
+    EXPECT_EQ(part[4], values.size()*4);
+}
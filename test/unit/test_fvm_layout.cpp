@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <arbor/util/optional.hpp>
@@ -8,6 +10,7 @@
 
 #include "fvm_layout.hpp"
 #include "util/maputil.hpp"
+#include "util/partition.hpp"
 #include "util/rangeutil.hpp"
 #include "util/span.hpp"
 #include "io/sepval.hpp"
@@ -400,6 +403,46 @@ struct exp_instance {
     }
 };
 
+TEST(fvm_layout, colocated) {
+    soma_cell_builder b(6);
+    b.add_branch(0, 200, 0.5, 0.5, 8, "dend");
+    b.add_branch(0, 200, 0.5, 0.5, 8, "dend");
+    cable_cell c = b.make_cell();
+
+    c.paint("soma", "hh");
+    c.paint("soma", "kamt");
+    c.paint("dend", "pas");
+    c.paint("dend", "nax");
+    c.paint("dend", "kdrmt");
+    c.paint(reg::branch(2), "hh");
+    c.place(mlocation{1, 0.5}, "expsyn");
+
+    std::vector<cable_cell> cells = {c, c};
+
+    cable_cell_global_properties gprop;
+    gprop.default_parameters = neuron_parameter_defaults;
+
+    fvm_discretization D = fvm_discretize(cells, gprop.default_parameters);
+    fvm_mechanism_data M = fvm_build_mechanism_data(gprop, cells, D);
+
+    // Density mechanisms on the same CVs of both cells are grouped, by name.
+    // hh is on the soma and one of the branches, and the synapse is not a
+    // density mechanism.
+
+    using groups = std::vector<std::vector<std::string>>;
+    EXPECT_EQ(groups({{"kdrmt", "nax", "pas"}}), M.colocated);
+
+    cells[1].paint(reg::branch(2), "kamt");
+    D = fvm_discretize(cells, gprop.default_parameters);
+    M = fvm_build_mechanism_data(gprop, cells, D);
+    EXPECT_EQ(groups({{"kdrmt", "nax", "pas"}}), M.colocated);
+
+    cells[0].paint(reg::branch(2), "kamt");
+    D = fvm_discretize(cells, gprop.default_parameters);
+    M = fvm_build_mechanism_data(gprop, cells, D);
+    EXPECT_EQ(groups({{"hh", "kamt"}, {"kdrmt", "nax", "pas"}}), M.colocated);
+}
+
 TEST(fvm_layout, coalescing_synapses) {
     using ivec = std::vector<fvm_index_type>;
 
@@ -921,6 +964,10 @@ TEST(fvm_layout, ion_weights) {
         EXPECT_TRUE(testing::seq_almost_eq<fvm_value_type>(expected_init_iconc[run], ca.init_iconc));
 
         EXPECT_TRUE(util::all_of(ca.init_econc, [cao](fvm_value_type v) { return v==cao; }));
+
+        // test_ca writes cai but not cao.
+        EXPECT_TRUE(ca.iconc_written);
+        EXPECT_FALSE(ca.econc_written);
     }
 }
 
@@ -993,3 +1040,148 @@ TEST(fvm_layout, revpot) {
     ASSERT_EQ(1u, M.mechanisms.count(write_eb_ec.name()));
     EXPECT_EQ((std::vector<fvm_index_type>(1, soma1_index)), M.mechanisms.at(write_eb_ec.name()).cv);
 }
+
+TEST(fvm_layout, cv_order) {
+    using ivec = std::vector<fvm_index_type>;
+
+    // Cell 0:          Cell 1:
+    //
+    //   0 - 1 - 2 - 4    7 - 8 - 10
+    //        \   \        \
+    //         3   5        9
+    //          \
+    //           6
+
+    ivec parent_cv = {0, 0, 1, 1, 2, 2, 3, 7, 7, 7, 8};
+    ivec cell_cv_bounds = {0, 7, 11};
+
+    EXPECT_EQ((ivec{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}),
+        fvm_cv_order(cv_ordering::segment, parent_cv, cell_cv_bounds));
+    EXPECT_EQ((ivec{0, 1, 2, 4, 5, 3, 6, 7, 8, 10, 9}),
+        fvm_cv_order(cv_ordering::depth_first, parent_cv, cell_cv_bounds));
+    EXPECT_EQ((ivec{0, 1, 3, 2, 6, 4, 5, 7, 9, 8, 10}),
+        fvm_cv_order(cv_ordering::cuthill_mckee, parent_cv, cell_cv_bounds));
+    EXPECT_EQ((ivec{0, 1, 2, 3, 6, 4, 5, 7, 8, 10, 9}),
+        fvm_cv_order(cv_ordering::branch_contiguous, parent_cv, cell_cv_bounds));
+}
+
+TEST(fvm_layout, reorder_cvs) {
+    using ivec = std::vector<fvm_index_type>;
+    using fvec = std::vector<fvm_value_type>;
+
+    std::vector<cable_cell> cells = two_cell_system();
+    check_two_cell_system(cells);
+
+    cells[0].place(mlocation{1, 0.4}, "expsyn");
+    cells[0].place(mlocation{1, 0.9}, "expsyn");
+    cells[0].place(mlocation{1, 0.4}, "expsyn");
+    cells[1].place(mlocation{2, 0.4}, "exp2syn");
+    cells[1].place(mlocation{3, 0.4}, "expsyn");
+    cells[1].place(mlocation{2, 0.7}, "expsyn");
+
+    // A third cell whose segment order is neither depth-first nor
+    // breadth-first.
+    soma_cell_builder builder(7.);
+    builder.add_branch(0, 200, 0.5, 0.5, 3, "dend");
+    builder.add_branch(1, 300, 0.4, 0.4, 2, "dend");
+    builder.add_branch(0, 180, 0.35, 0.35, 4, "dend");
+    builder.add_branch(1, 100, 0.35, 0.35, 2, "dend");
+    cells.push_back(builder.make_cell());
+    cells[2].paint("dend", "pas");
+    cells[2].place(mlocation{3, 0.5}, "expsyn");
+
+    cable_cell_global_properties gprop;
+    gprop.default_parameters = neuron_parameter_defaults;
+
+    fvm_discretization D = fvm_discretize(cells, gprop.default_parameters);
+    fvm_mechanism_data M = fvm_build_mechanism_data(gprop, cells, D);
+
+    ivec identity;
+    util::assign(identity, make_span(D.ncv));
+
+    // Entries of a mechanism config as (CV, values, targets), with CVs
+    // renumbered, in a canonical order.
+    using entry = std::tuple<fvm_index_type, fvec, ivec>;
+    auto mech_entries = [](const fvm_mechanism_config& config, const ivec& renumbering) {
+        std::vector<fvm_index_type> multiplicity_divs;
+        auto target_part = util::make_partition(multiplicity_divs, config.multiplicity);
+
+        std::vector<entry> entries;
+        for (auto i: count_along(config.cv)) {
+            fvec values;
+            if (!config.norm_area.empty()) values.push_back(config.norm_area[i]);
+            for (auto& pv: config.param_values) values.push_back(pv.second[i]);
+
+            ivec targets;
+            if (!config.multiplicity.empty()) {
+                util::assign(targets, util::subrange_view(config.target, target_part[i]));
+            }
+            else if (!config.target.empty()) {
+                targets.push_back(config.target[i]);
+            }
+
+            auto cv = renumbering.empty()? config.cv[i]: renumbering[config.cv[i]];
+            entries.emplace_back(cv, values, targets);
+        }
+        util::sort(entries);
+        return entries;
+    };
+
+    auto ion_entries = [](const fvm_ion_config& config, const ivec& renumbering) {
+        std::vector<entry> entries;
+        for (auto i: count_along(config.cv)) {
+            auto cv = renumbering.empty()? config.cv[i]: renumbering[config.cv[i]];
+            entries.emplace_back(cv, fvec{config.init_iconc[i], config.init_econc[i], config.init_revpot[i]}, ivec{});
+        }
+        util::sort(entries);
+        return entries;
+    };
+
+    for (auto ordering: {cv_ordering::depth_first, cv_ordering::cuthill_mckee, cv_ordering::branch_contiguous}) {
+        SCOPED_TRACE(int(ordering));
+
+        auto order = fvm_cv_order(ordering, D.parent_cv, D.cell_cv_bounds);
+        EXPECT_NE(identity, order);
+
+        fvm_discretization D2 = D;
+        fvm_mechanism_data M2 = M;
+        fvm_reorder_cvs(ordering, D2, M2);
+
+        const auto& renumbering = D2.cv_renumbering;
+        ASSERT_EQ(D.ncv, renumbering.size());
+        EXPECT_EQ(D.cell_cv_bounds, D2.cell_cv_bounds);
+
+        for (auto i: make_span(D.ncv)) {
+            auto j = order[i];
+            EXPECT_EQ(fvm_index_type(i), renumbering[j]);
+            EXPECT_EQ(renumbering[D.parent_cv[j]], D2.parent_cv[i]);
+            EXPECT_LE(D2.parent_cv[i], fvm_index_type(i));
+            EXPECT_EQ(D.cv_to_cell[j], D2.cv_to_cell[i]);
+            EXPECT_EQ(D.face_conductance[j], D2.face_conductance[i]);
+            EXPECT_EQ(D.cv_area[j], D2.cv_area[i]);
+            EXPECT_EQ(D.cv_capacitance[j], D2.cv_capacitance[i]);
+            EXPECT_EQ(D.init_membrane_potential[j], D2.init_membrane_potential[i]);
+        }
+
+        mlocation loc{2, 0.4};
+        EXPECT_EQ(renumbering[D.branch_location_cv(1, loc)], D2.branch_location_cv(1, loc));
+
+        ASSERT_EQ(M.mechanisms.size(), M2.mechanisms.size());
+        for (auto& kv: M.mechanisms) {
+            SCOPED_TRACE(kv.first);
+            const auto& config = M2.mechanisms.at(kv.first);
+
+            EXPECT_TRUE(std::is_sorted(config.cv.begin(), config.cv.end()));
+            EXPECT_EQ(mech_entries(kv.second, renumbering), mech_entries(config, {}));
+        }
+
+        ASSERT_EQ(M.ions.size(), M2.ions.size());
+        for (auto& kv: M.ions) {
+            SCOPED_TRACE(kv.first);
+            const auto& config = M2.ions.at(kv.first);
+
+            EXPECT_TRUE(std::is_sorted(config.cv.begin(), config.cv.end()));
+            EXPECT_EQ(ion_entries(kv.second, renumbering), ion_entries(config, {}));
+        }
+    }
+}
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
 #include <string>
 #include <vector>
 
@@ -8,6 +11,7 @@
 #include <arbor/fvm_types.hpp>
 #include <arbor/load_balance.hpp>
 #include <arbor/math.hpp>
+#include <arbor/mechcat.hpp>
 #include <arbor/cable_cell.hpp>
 #include <arbor/segment.hpp>
 #include <arbor/recipe.hpp>
@@ -25,8 +29,11 @@
 #include "util/meta.hpp"
 #include "util/maputil.hpp"
 #include "util/rangeutil.hpp"
+#include "util/span.hpp"
+#include "util/strprintf.hpp"
 
 #include "common.hpp"
+#include "mech_private_field_access.hpp"
 #include "unit_test_catalogue.hpp"
 #include "../common_cells.hpp"
 #include "../simple_recipes.hpp"
@@ -227,8 +234,11 @@ TEST(fvm_lowered, matrix_init)
 
     fvcell.integrate(0.01, 0.01, {}, {});
 
+    // A single cell is solved with the flat matrix state.
+    ASSERT_EQ(multicore::matrix_solver::flat, J.state_.solver());
+
     auto n = J.size();
-    auto& mat = J.state_;
+    auto& mat = J.state_.flat;
 
     EXPECT_FALSE(util::any_of(util::subrange_view(mat.u, 1, n), isnan));
     EXPECT_FALSE(util::any_of(mat.d, isnan));
@@ -301,6 +311,375 @@ TEST(fvm_lowered, target_handles) {
 
 }
 
+TEST(fvm_lowered, point_instance_order) {
+    using namespace arb;
+
+    execution_context context;
+
+    // Many synapses on the soma and a few on the dendrite, each with its
+    // own time constant, so that none are coalesced.
+    cable_cell cell = make_cell_ball_and_stick();
+    std::vector<double> tau;
+    for (unsigned i = 0; i<13; ++i) {
+        tau.push_back(1+0.1*i);
+        cell.place(mlocation{0, 0.5}, mechanism_desc("expsyn").set("tau", tau.back()));
+    }
+    for (unsigned i = 0; i<7; ++i) {
+        tau.push_back(3+0.1*i);
+        cell.place(mlocation{1, 0.1+0.1*i}, mechanism_desc("expsyn").set("tau", tau.back()));
+    }
+
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map<probe_handle> probe_map;
+
+    fvm_cell fvcell(context);
+    fvcell.initialize({0}, cable1d_recipe(cell, false), cell_to_intdom, targets, probe_map);
+
+    auto expsyn = find_mechanism(fvcell, "expsyn");
+    ASSERT_TRUE(expsyn);
+    ASSERT_EQ(tau.size(), expsyn->size());
+
+    // Instances may be reordered to reduce the SIMD blocks with repeated
+    // CV indices, but the number of blocks is unchanged.
+    auto layout = expsyn->layout_index_constraints();
+    auto stored = expsyn->index_constraints();
+    EXPECT_EQ(layout.contiguous+layout.constant+layout.independent+layout.none,
+              stored.contiguous+stored.constant+stored.independent+stored.none);
+    EXPECT_LE(stored.none, layout.none);
+
+    auto instance_index = expsyn->instance_index();
+    if (!instance_index.empty()) {
+        EXPECT_LT(stored.none, layout.none);
+        ASSERT_EQ(tau.size(), instance_index.size());
+        EXPECT_TRUE(std::is_permutation(instance_index.begin(), instance_index.end(),
+                    util::make_span(tau.size()).begin()));
+    }
+
+    // Target handles and parameters follow the stored order.
+    auto cmech = dynamic_cast<multicore::mechanism*>(expsyn);
+    ASSERT_TRUE(cmech);
+    auto opt_tau_ptr = util::value_by_key((cmech->*private_field_table_ptr)(), "tau"s);
+    ASSERT_TRUE(opt_tau_ptr);
+    const fvm_value_type* tau_field = *opt_tau_ptr.value();
+
+    ASSERT_EQ(tau.size(), targets.size());
+    for (auto i: util::count_along(targets)) {
+        EXPECT_EQ(expsyn->mechanism_id(), targets[i].mech_id);
+        EXPECT_EQ(tau[i], tau_field[targets[i].mech_index]);
+    }
+}
+
+TEST(fvm_lowered, uniform_parameters) {
+    using namespace arb;
+
+    execution_context context;
+
+    // Passive dendrite, painted with default parameters; and synapses
+    // with the same or differing time constants.
+    cable_cell cell = make_cell_ball_and_stick();
+    cell.place(mlocation{1, 0.2}, mechanism_desc("expsyn").set("tau", 3.));
+    cell.place(mlocation{1, 0.4}, mechanism_desc("expsyn").set("tau", 3.));
+    cell.place(mlocation{1, 0.6}, mechanism_desc("exp2syn").set("tau1", 0.5));
+    cell.place(mlocation{1, 0.8}, mechanism_desc("exp2syn").set("tau1", 0.7));
+
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map<probe_handle> probe_map;
+
+    fvm_cell fvcell(context);
+    fvcell.initialize({0}, cable1d_recipe(cell, false), cell_to_intdom, targets, probe_map);
+
+    auto pas = find_mechanism(fvcell, "pas");
+    auto expsyn = find_mechanism(fvcell, "expsyn");
+    auto exp2syn = find_mechanism(fvcell, "exp2syn");
+    ASSERT_TRUE(pas);
+    ASSERT_TRUE(expsyn);
+    ASSERT_TRUE(exp2syn);
+
+    auto n = pas->size();
+    ASSERT_LT(1u, n);
+
+    using fvec = std::vector<fvm_value_type>;
+    EXPECT_EQ(fvec(n, 0.001), mechanism_field(pas, "g"));
+    EXPECT_EQ(fvec(2, 3.), mechanism_field(expsyn, "tau"));
+    EXPECT_EQ(fvec({0.5, 0.7}), mechanism_field(exp2syn, "tau1"));
+
+    // A range parameter takes an array only while its values differ.
+    auto mem_uniform = pas->memory();
+
+    fvec g(n);
+    for (auto i: util::count_along(g)) {
+        g[i] = 0.001*(i+1);
+    }
+    pas->set_parameter("g", g);
+    EXPECT_EQ(g, mechanism_field(pas, "g"));
+    EXPECT_LE(mem_uniform+n*sizeof(fvm_value_type), pas->memory());
+
+    pas->set_parameter("g", fvec(n, 0.002));
+    EXPECT_EQ(fvec(n, 0.002), mechanism_field(pas, "g"));
+    EXPECT_EQ(mem_uniform, pas->memory());
+}
+
+TEST(fvm_lowered, single_state) {
+    using namespace arb;
+
+    // A stimulated HH soma with a synapse, with the state of the hh and
+    // expsyn mechanisms stored in double precision (default catalogue) or
+    // in single precision (unit test catalogue).
+    auto run = [](const char* hh, const char* syn, std::size_t& hh_memory) {
+        soma_cell_builder b(6);
+        cable_cell c = b.make_cell();
+        c.paint("soma", hh);
+        c.place(mlocation{0, 0.5}, syn);
+        c.place(mlocation{0, 0.5}, i_clamp{10., 20., 0.1});
+
+        cable1d_recipe rec(c);
+        if (!rec.catalogue().has(hh)) {
+            rec.catalogue() = make_unit_test_catalogue();
+        }
+
+        execution_context context;
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map<probe_handle> probe_map;
+
+        fvm_cell fvcell(context);
+        fvcell.initialize({0}, rec, cell_to_intdom, targets, probe_map);
+        hh_memory = find_mechanism(fvcell, hh)->memory();
+
+        auto& state = *(fvcell.*private_state_ptr).get();
+        std::vector<deliverable_event> evs = {{2., targets.at(0), 0.05f}};
+
+        std::vector<fvm_value_type> v;
+        for (int t = 1; t<=40; ++t) {
+            (void)fvcell.integrate(t, 0.025, util::range_pointer_view(evs), {});
+            evs.clear();
+            v.push_back(state.voltage[0]);
+        }
+        return v;
+    };
+
+    std::size_t mem_double, mem_single;
+    auto v_double = run("hh", "expsyn", mem_double);
+    auto v_single = run("hh_single", "expsyn_single", mem_single);
+
+    // The cell spikes twice; single precision rounding of the gating
+    // variables changes the voltage by less than 0.01 mV.
+    EXPECT_LT(0., util::max_value(v_double));
+    ASSERT_EQ(v_double.size(), v_single.size());
+    for (auto i: util::count_along(v_double)) {
+        EXPECT_NEAR(v_double[i], v_single[i], 1e-2);
+    }
+
+    EXPECT_LT(mem_single, mem_double);
+}
+
+TEST(fvm_lowered, tables) {
+    using namespace arb;
+
+    // Stimulated cells with hh on the soma and nax, kdrmt and kamt on a
+    // dendrite, with exact rate procedures (default catalogue) or with the
+    // rates interpolated from tables (unit test catalogue). The cells have
+    // the same temperature, or a different one each.
+    auto run = [](const char* suffix, std::array<double, 2> temperatures) {
+        std::vector<cable_cell> cells;
+        for (auto t: temperatures) {
+            soma_cell_builder b(6);
+            b.add_branch(0, 200, 0.5, 0.5, 13, "dend");
+            cable_cell c = b.make_cell();
+            c.default_parameters.temperature_K = t;
+            c.paint("soma", std::string("hh")+suffix);
+            for (const char* m: {"nax", "kdrmt", "kamt"}) {
+                c.paint("dend", std::string(m)+suffix);
+            }
+            c.place(mlocation{0, 0.5}, i_clamp{5., 20., 0.2});
+            cells.push_back(std::move(c));
+        }
+
+        cable1d_recipe rec(cells);
+        if (*suffix) {
+            rec.catalogue() = make_unit_test_catalogue();
+        }
+
+        execution_context context;
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map<probe_handle> probe_map;
+
+        fvm_cell fvcell(context);
+        fvcell.initialize({0, 1}, rec, cell_to_intdom, targets, probe_map);
+
+        auto& state = *(fvcell.*private_state_ptr).get();
+
+        std::vector<fvm_value_type> v;
+        for (int t = 1; t<=40; ++t) {
+            (void)fvcell.integrate(t, 0.025, {}, {});
+            util::append(v, state.voltage);
+        }
+        return v;
+    };
+
+    // Linear interpolation over 1 mV intervals shifts the spikes slightly,
+    // changing the voltage on the upstroke by less than 0.5 mV.
+    auto v_exact = run("", {300., 300.});
+    auto v_table = run("_table", {300., 300.});
+
+    EXPECT_LT(0., util::max_value(v_exact));
+    ASSERT_EQ(v_exact.size(), v_table.size());
+    double max_diff = 0;
+    for (auto i: util::count_along(v_exact)) {
+        EXPECT_NEAR(v_exact[i], v_table[i], 0.5);
+        max_diff = std::max(max_diff, std::abs(v_exact[i]-v_table[i]));
+    }
+    EXPECT_LT(1e-6, max_diff);
+
+    // The tables are not used when the temperature differs between instances;
+    // the exact procedures then agree up to rounding.
+    v_exact = run("", {290., 300.});
+    v_table = run("_table", {290., 300.});
+
+    ASSERT_EQ(v_exact.size(), v_table.size());
+    for (auto i: util::count_along(v_exact)) {
+        EXPECT_NEAR(v_exact[i], v_table[i], 1e-9);
+    }
+}
+
+TEST(fvm_lowered, simd_variants) {
+    using namespace arb;
+
+    // A stimulated HH cell with a synapse, with the default catalogue
+    // restricted through ARB_SIMD_ISA to each instruction set in turn.
+    auto run = [](simd_isa isa, simd_isa& selected) {
+        setenv("ARB_SIMD_ISA", util::to_string(isa).c_str(), 1);
+
+        soma_cell_builder b(6);
+        b.add_branch(0, 200, 0.5, 0.5, 13, "dend");
+        cable_cell c = b.make_cell();
+        c.paint("soma", "hh");
+        c.paint("dend", "hh");
+        for (auto pos: {0.1, 0.5, 0.5, 0.9}) {
+            c.place(mlocation{1, pos}, "expsyn");
+        }
+        c.place(mlocation{0, 0.5}, i_clamp{10., 20., 0.1});
+
+        cable1d_recipe rec(c);
+        selected = rec.catalogue().instance_isa<multicore::backend>("hh");
+
+        execution_context context;
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map<probe_handle> probe_map;
+
+        fvm_cell fvcell(context);
+        fvcell.initialize({0}, rec, cell_to_intdom, targets, probe_map);
+
+        auto& state = *(fvcell.*private_state_ptr).get();
+        std::vector<deliverable_event> evs;
+        for (auto& t: targets) {
+            evs.push_back({2., t, 0.05f});
+        }
+
+        std::vector<fvm_value_type> v;
+        for (int t = 1; t<=40; ++t) {
+            (void)fvcell.integrate(t, 0.025, util::range_pointer_view(evs), {});
+            evs.clear();
+            v.insert(v.end(), state.voltage.begin(), state.voltage.end());
+        }
+        return v;
+    };
+
+    const char* env = std::getenv("ARB_SIMD_ISA");
+    std::string saved = env? env: "";
+
+    simd_isa selected;
+    auto v_none = run(simd_isa::none, selected);
+    EXPECT_EQ(simd_isa::none, selected);
+    EXPECT_LT(0., util::max_value(v_none));
+
+    for (auto isa: {simd_isa::avx, simd_isa::avx2, simd_isa::avx512}) {
+        SCOPED_TRACE(util::to_string(isa));
+        auto v = run(isa, selected);
+        EXPECT_LE(selected, isa);
+
+        // Variants differ only in the rounding of vectorized maths functions
+        // and fused multiply-adds.
+        ASSERT_EQ(v_none.size(), v.size());
+        for (auto i: util::count_along(v_none)) {
+            EXPECT_NEAR(v_none[i], v[i], 1e-6);
+        }
+    }
+
+    if (env) {
+        setenv("ARB_SIMD_ISA", saved.c_str(), 1);
+    }
+    else {
+        unsetenv("ARB_SIMD_ISA");
+    }
+}
+
+TEST(fvm_lowered, colocated) {
+    using namespace arb;
+
+    // Five density mechanisms on a dendrite of 1200 CVs are applied in blocks
+    // of instances. Extending pas to the soma with zero conductance leaves
+    // the dynamics unchanged, but stops pas sharing the CVs of the others.
+    auto run = [](bool pas_on_soma, std::size_t& n_group) {
+        soma_cell_builder b(6);
+        b.add_branch(0, 1200, 0.5, 0.5, 1200, "dend");
+        cable_cell c = b.make_cell();
+        for (auto mech: {"hh", "nax", "kdrmt", "kamt"}) {
+            c.paint("dend", mech);
+        }
+        c.paint("dend", mechanism_desc("pas").set("g", 0.001));
+        if (pas_on_soma) {
+            c.paint("soma", mechanism_desc("pas").set("g", 0.));
+        }
+        c.place(mlocation{1, 0}, "expsyn");
+        c.place(mlocation{0, 0.5}, i_clamp{10., 20., 0.2});
+
+        cable1d_recipe rec(c);
+
+        execution_context context;
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map<probe_handle> probe_map;
+
+        fvm_cell fvcell(context);
+        fvcell.initialize({0}, rec, cell_to_intdom, targets, probe_map);
+
+        n_group = 0;
+        for (auto& group: fvcell.mechanism_groups()) {
+            n_group = std::max(n_group, group.size());
+        }
+
+        auto& state = *(fvcell.*private_state_ptr).get();
+        std::vector<deliverable_event> evs = {{2., targets.at(0), 0.05f}};
+
+        std::vector<fvm_value_type> v;
+        for (int t = 1; t<=20; ++t) {
+            (void)fvcell.integrate(t, 0.025, util::range_pointer_view(evs), {});
+            evs.clear();
+            v.insert(v.end(), state.voltage.begin(), state.voltage.end());
+        }
+        return v;
+    };
+
+    std::size_t n_blocked, n_unblocked;
+    auto v_blocked = run(false, n_blocked);
+    auto v_unblocked = run(true, n_unblocked);
+
+    EXPECT_EQ(5u, n_blocked);
+    EXPECT_EQ(4u, n_unblocked);
+    EXPECT_LT(0., util::max_value(v_blocked));
+
+    // Only the order of summation of currents differs.
+    ASSERT_EQ(v_unblocked.size(), v_blocked.size());
+    for (auto i: util::count_along(v_blocked)) {
+        EXPECT_NEAR(v_unblocked[i], v_blocked[i], 1e-8);
+    }
+}
+
 TEST(fvm_lowered, stimulus) {
     // Ball-and-stick with two stimuli:
     //
@@ -620,7 +999,7 @@ TEST(fvm_lowered, point_ionic_current) {
 
     // Only one target, corresponding to our point process on soma.
     double ica_nA = 12.3;
-    deliverable_event ev = {0.04, target_handle{0, 0, 0}, (float)ica_nA};
+    std::vector<deliverable_event> evs = {{0.04, target_handle{0, 0, 0}, (float)ica_nA}};
 
     auto& state = *(fvcell.*private_state_ptr).get();
     auto& ion = state.ion_data.at("ca"s);
@@ -630,7 +1009,7 @@ TEST(fvm_lowered, point_ionic_current) {
 
     // Ionic current should be ica_nA/soma_area after integrating past event time.
     const double time = 0.5; // [ms]
-    (void)fvcell.integrate(time, 0.01, {ev}, {});
+    (void)fvcell.integrate(time, 0.01, util::range_pointer_view(evs), {});
 
     double expected_iX = ica_nA*1e-9/soma_area_m2;
     EXPECT_FLOAT_EQ(expected_iX, ion.iX_[0]);
@@ -729,6 +1108,18 @@ TEST(fvm_lowered, weighted_write_ion) {
     test_ca->write_ions();
     std::vector<double> ion_iconc = util::assign_from(ion.Xi_);
     EXPECT_EQ(expected_iconc, ion_iconc);
+
+    // No mechanism writes the external concentration, so it is left alone
+    // by the per-step reset, but not by a full reset.
+    EXPECT_TRUE(ion.write_Xi_);
+    EXPECT_FALSE(ion.write_Xo_);
+
+    ion.Xo_[0] = -1;
+    ion.init_concentration();
+    EXPECT_EQ(-1, ion.Xo_[0]);
+
+    ion.reset();
+    EXPECT_EQ(con_ext, ion.Xo_[0]);
 }
 
 TEST(fvm_lowered, gj_coords_simple) {
@@ -981,6 +1372,87 @@ TEST(fvm_lowered, cell_group_gj) {
 
 }
 
+TEST(fvm_lowered, gj_current) {
+    // Junctions out of order, with runs of junctions on the same CV that
+    // straddle SIMD blocks of any width.
+    const unsigned n_cv = 12;
+    std::vector<fvm_gap_junction> gj;
+    for (unsigned i = 0; i<40; ++i) {
+        fvm_index_type cv = (7*i)%n_cv;
+        if (i%3==0) cv = 5;
+        gj.push_back(fvm_gap_junction({cv, fvm_index_type((cv+1+i%4)%n_cv)}, 0.1+0.01*i));
+    }
+
+    std::vector<fvm_index_type> cv_to_intdom(n_cv, 0);
+    std::vector<fvm_value_type> vinit(n_cv), temp(n_cv, 300), diam(n_cv, 1);
+    for (unsigned i = 0; i<n_cv; ++i) {
+        vinit[i] = -70+3.*i;
+    }
+
+    shared_state state(1, cv_to_intdom, gj, vinit, temp, diam, 1);
+    state.reset();
+    state.zero_currents();
+    state.add_gj_current();
+
+    std::vector<fvm_value_type> current(n_cv, 0), conductivity(n_cv, 0);
+    for (auto& g: gj) {
+        current[g.loc.first] += g.weight*(vinit[g.loc.first]-vinit[g.loc.second]);
+        conductivity[g.loc.first] += g.weight;
+    }
+
+    for (unsigned i = 0; i<n_cv; ++i) {
+        EXPECT_NEAR(current[i], state.current_density[i], 1e-12);
+        EXPECT_NEAR(conductivity[i], state.conductivity[i], 1e-12);
+    }
+}
+
+TEST(fvm_lowered, gj_stiff_coupling) {
+    // Two passive point cells coupled by a junction strong enough that an
+    // explicit coupling term would diverge at dt = 0.025 ms. With the local
+    // voltage implicit, the cells should approach the same steady state as
+    // a finely stepped run, and stay close to each other.
+    struct gj_pair_recipe: cable1d_recipe {
+        explicit gj_pair_recipe(const std::vector<cable_cell>& cells): cable1d_recipe(cells) {}
+
+        std::vector<gap_junction_connection> gap_junctions_on(cell_gid_type gid) const override {
+            return {gap_junction_connection({gid, 0}, {1-gid, 0}, 1.)};
+        }
+    };
+
+    std::vector<cable_cell> cells;
+    for (int i = 0; i<2; ++i) {
+        cable_cell c = soma_cell_builder(12.6157/2.0).make_cell();
+        c.paint("soma", "pas");
+        c.place(mlocation{0, 0.5}, gap_junction_site{});
+        if (i==0) c.place(mlocation{0, 0.5}, i_clamp{0., 100., 0.1});
+        cells.push_back(std::move(c));
+    }
+
+    auto run = [&](fvm_value_type dt) {
+        gj_pair_recipe rec(cells);
+        rec.add_probe(0, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage});
+        rec.add_probe(1, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage});
+
+        execution_context context;
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map<probe_handle> probe_map;
+
+        fvm_cell fvcell(context);
+        fvcell.initialize({0, 1}, rec, cell_to_intdom, targets, probe_map);
+        fvcell.integrate(50, dt, {}, {});
+        return std::make_pair(*probe_map.at({0, 0}).handle, *probe_map.at({1, 0}).handle);
+    };
+
+    auto v = run(0.025);
+    auto v_ref = run(0.001);
+
+    EXPECT_NEAR(v_ref.first, v.first, 0.1);
+    EXPECT_NEAR(v_ref.second, v.second, 0.1);
+    EXPECT_GT(v.first, v.second);
+    EXPECT_GT(0.1, v.first-v.second);
+}
+
 TEST(fvm_lowered, integration_domains) {
     {
         execution_context context;
@@ -1021,5 +1493,244 @@ TEST(fvm_lowered, integration_domains) {
         EXPECT_EQ(1u, num_dom);
         EXPECT_EQ(expected_doms, cell_to_intdom);
     }
+    {
+        // Peers outside the group do not join integration domains.
+        execution_context context;
+        fvm_cell fvcell(context);
+
+        std::vector<cell_gid_type> gids = {5u, 2u, 3u};
+        std::vector<fvm_index_type> cell_to_intdom;
+
+        auto num_dom = fvcell.fvm_intdom(gap_recipe_0(), gids, cell_to_intdom);
+        std::vector<fvm_index_type> expected_doms= {0u, 1u, 1u};
+
+        EXPECT_EQ(2u, num_dom);
+        EXPECT_EQ(expected_doms, cell_to_intdom);
+    }
+}
+
+TEST(fvm_lowered, gj_halo) {
+    // Gap junctions with cells outside the group become halo junctions,
+    // with the local site first.
+    class gap_recipe: public gap_recipe_0 {
+    public:
+        gap_recipe() {
+            gprop_.default_parameters = neuron_parameter_defaults;
+        }
+
+        util::any get_global_properties(cell_kind) const override {
+            return gprop_;
+        }
+
+    private:
+        cable_cell_global_properties gprop_;
+    };
+    gap_recipe rec;
+
+    execution_context context;
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map<probe_handle> probe_map;
+
+    fvm_cell fvcell(context);
+    fvcell.initialize({2, 5}, rec, cell_to_intdom, targets, probe_map);
+
+    std::vector<gap_junction_connection> expected = {
+        gap_junction_connection({2, 0}, {3, 0}, 0.1),
+        gap_junction_connection({5, 0}, {0, 0}, 0.1)
+    };
+
+    const auto& halo = fvcell.halo_junctions();
+    ASSERT_EQ(expected.size(), halo.size());
+    for (auto i: util::count_along(expected)) {
+        EXPECT_EQ(expected[i].local, halo[i].local);
+        EXPECT_EQ(expected[i].peer, halo[i].peer);
+        EXPECT_EQ(expected[i].ggap, halo[i].ggap);
+    }
+
+    // One voltage is exported per local site.
+    std::vector<fvm_value_type> values;
+    fvcell.export_halo(values);
+    EXPECT_EQ(2u, values.size());
+
+    fvcell.import_halo({-70, -60});
+}
+
+
+TEST(fvm_lowered, cv_ordering) {
+    // The CV ordering must not change the simulated dynamics: compare probe
+    // values and threshold crossings against segment order.
+
+    // Segment order of the third cell is neither depth-first nor breadth-first.
+    soma_cell_builder builder(12.6157/2.0);
+    builder.add_branch(0, 100, 0.5, 0.5, 4, "dend");
+    builder.add_branch(1, 100, 0.5, 0.5, 3, "dend");
+    builder.add_branch(0, 100, 0.5, 0.5, 5, "dend");
+    builder.add_branch(1, 100, 0.5, 0.5, 4, "dend");
+    auto cell = builder.make_cell();
+    cell.paint("soma", "hh");
+    cell.paint("dend", "pas");
+    cell.place(mlocation{4, 1}, i_clamp{5., 80., 0.3});
+
+    std::vector<cable_cell> cells = {make_cell_ball_and_3stick(), make_cell_ball_and_stick(), cell};
+    for (auto& c: cells) {
+        c.place(mlocation{0, 0}, threshold_detector{-10});
+    }
+
+    std::vector<mlocation> probe_locations = {{0, 0.5}, {1, 0.3}, {2, 0.9}, {3, 0.6}};
+
+    struct run_result {
+        std::vector<fvm_value_type> values;
+        std::vector<threshold_crossing> crossings;
+    };
+
+    auto run = [&](cv_ordering ordering) {
+        cable1d_recipe rec(cells);
+        rec.cable_global_properties().cv_order = ordering;
+        for (auto loc: probe_locations) {
+            rec.add_probe(0, 0, cell_probe_address{loc, cell_probe_address::membrane_voltage});
+        }
+        rec.add_probe(1, 0, cell_probe_address{{1, 0.5}, cell_probe_address::membrane_current});
+        for (auto loc: probe_locations) {
+            rec.add_probe(2, 0, cell_probe_address{loc, cell_probe_address::membrane_voltage});
+        }
+
+        execution_context context;
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map<probe_handle> probe_map;
+
+        fvm_cell fvcell(context);
+        fvcell.initialize({0, 1, 2}, rec, cell_to_intdom, targets, probe_map);
+
+        run_result result;
+        auto crossings = fvcell.integrate(20, 0.025, {}, {}).crossings;
+        result.crossings.assign(crossings.begin(), crossings.end());
+
+        for (auto i: util::make_span(probe_locations.size())) {
+            result.values.push_back(*probe_map.at({0, unsigned(i)}).handle);
+        }
+        result.values.push_back(*probe_map.at({1, 0}).handle);
+        for (auto i: util::make_span(probe_locations.size())) {
+            result.values.push_back(*probe_map.at({2, unsigned(i)}).handle);
+        }
+        return result;
+    };
+
+    auto expected = run(cv_ordering::segment);
+    ASSERT_FALSE(expected.crossings.empty());
+
+    for (auto ordering: {cv_ordering::depth_first, cv_ordering::cuthill_mckee, cv_ordering::branch_contiguous}) {
+        SCOPED_TRACE(int(ordering));
+        auto result = run(ordering);
+
+        ASSERT_EQ(expected.values.size(), result.values.size());
+        for (auto i: util::count_along(expected.values)) {
+            EXPECT_NEAR(expected.values[i], result.values[i], 1e-9*std::abs(expected.values[i])+1e-12);
+        }
+
+        ASSERT_EQ(expected.crossings.size(), result.crossings.size());
+        for (auto i: util::count_along(expected.crossings)) {
+            EXPECT_EQ(expected.crossings[i].index, result.crossings[i].index);
+            EXPECT_NEAR(expected.crossings[i].time, result.crossings[i].time, 1e-6);
+        }
+    }
 }
 
+TEST(fvm_lowered, adaptive_dt) {
+    // Adaptive steps should be long while the cell is at rest, and should
+    // reproduce the spike times of fixed steps once it is stimulated.
+    cable_cell cell = make_cell_ball_and_stick();
+    cell.place(mlocation{0, 0}, threshold_detector{-10});
+    cell.place(mlocation{1, 0.5}, "expsyn");
+
+    auto run = [&](bool adaptive, std::vector<threshold_crossing>& crossings) {
+        cable1d_recipe rec(cell);
+        rec.cable_global_properties().adaptive_dt = adaptive;
+        rec.cable_global_properties().adaptive_dt_tolerance = 0.001;
+        rec.cable_global_properties().adaptive_dt_max = 0.5;
+
+        execution_context context;
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map<probe_handle> probe_map;
+
+        auto fvcell = std::make_unique<fvm_cell>(context);
+        fvcell->initialize({0}, rec, cell_to_intdom, targets, probe_map);
+        shared_state& state = *(fvcell.get()->*private_state_ptr);
+
+        // At rest until the stimulus at 5 ms. Adaptive steps end at sample
+        // times, so samples are taken at the requested times.
+        std::vector<sample_event> samples = {
+            {2.01, 0, {state.voltage.data(), 0, 0, 1}},
+            {3.33, 0, {state.voltage.data(), 1, 1, 1}}
+        };
+        auto sample_time = fvcell->integrate(4, 0.025, {}, util::range_pointer_view(samples)).sample_time;
+        if (adaptive) {
+            EXPECT_EQ(samples[0].time, sample_time[0]);
+            EXPECT_EQ(samples[1].time, sample_time[1]);
+        }
+        fvm_value_type dt_rest = adaptive? state.dt_step[0]: 0.025;
+
+        // A synaptic event restarts adaptive steps from the shortest step.
+        std::vector<deliverable_event> events = {{4.5, targets[0], 0.01f}};
+        fvcell->integrate(4.6, 0.025, util::range_pointer_view(events), {});
+        fvm_value_type dt_event = adaptive? state.dt_step[0]: 0.025;
+
+        auto c = fvcell->integrate(40, 0.025, {}, {}).crossings;
+        crossings.assign(c.begin(), c.end());
+        return std::make_pair(dt_rest, dt_event);
+    };
+
+    std::vector<threshold_crossing> fixed, adaptive;
+    run(false, fixed);
+    auto dt = run(true, adaptive);
+
+    EXPECT_EQ(0.5, dt.first);
+    EXPECT_GT(0.1, dt.second);
+
+    ASSERT_LT(2u, fixed.size());
+    ASSERT_EQ(fixed.size(), adaptive.size());
+    for (auto i: util::count_along(fixed)) {
+        EXPECT_NEAR(fixed[i].time, adaptive[i].time, 0.05);
+    }
+}
+
+TEST(fvm_lowered, crank_nicolson) {
+    // On a passive cell the Crank–Nicolson scheme should converge with the
+    // square of the time step, and backward Euler linearly.
+    soma_cell_builder builder(12.6157/2.0);
+    builder.add_branch(0, 200, 1.0, 1.0, 4, "dend");
+    auto cell = builder.make_cell();
+    cell.paint("soma", "pas");
+    cell.paint("dend", "pas");
+    cell.place(mlocation{1, 1}, i_clamp{0., 100., 0.1});
+
+    auto run = [&](voltage_integration scheme, fvm_value_type dt) {
+        cable1d_recipe rec(cell);
+        rec.cable_global_properties().voltage_scheme = scheme;
+        rec.add_probe(0, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage});
+
+        execution_context context;
+        std::vector<target_handle> targets;
+        std::vector<fvm_index_type> cell_to_intdom;
+        probe_association_map<probe_handle> probe_map;
+
+        fvm_cell fvcell(context);
+        fvcell.initialize({0}, rec, cell_to_intdom, targets, probe_map);
+        fvcell.integrate(2, dt, {}, {});
+        return *probe_map.at({0, 0}).handle;
+    };
+
+    auto v_ref = run(voltage_integration::crank_nicolson, 0.001);
+
+    auto be_coarse = std::abs(run(voltage_integration::backward_euler, 0.1)-v_ref);
+    auto be_fine = std::abs(run(voltage_integration::backward_euler, 0.05)-v_ref);
+    auto cn_coarse = std::abs(run(voltage_integration::crank_nicolson, 0.1)-v_ref);
+    auto cn_fine = std::abs(run(voltage_integration::crank_nicolson, 0.05)-v_ref);
+
+    EXPECT_LT(1.5, be_coarse/be_fine);
+    EXPECT_GT(2.5, be_coarse/be_fine);
+    EXPECT_LT(3.5, cn_coarse/cn_fine);
+    EXPECT_GT(be_fine, cn_coarse);
+}
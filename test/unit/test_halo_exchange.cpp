@@ -0,0 +1,185 @@
+#include "../gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
+#include <arbor/cable_cell.hpp>
+#include <arbor/context.hpp>
+#include <arbor/domain_decomposition.hpp>
+#include <arbor/event_generator.hpp>
+#include <arbor/load_balance.hpp>
+#include <arbor/recipe.hpp>
+#include <arbor/sampling.hpp>
+#include <arbor/schedule.hpp>
+#include <arbor/simulation.hpp>
+#include <arbor/util/any_ptr.hpp>
+
+#include "util/span.hpp"
+
+#include "../common_cells.hpp"
+
+using namespace arb;
+
+namespace {
+    // A chain of soma-only HH cells, coupled by gap junctions between
+    // neighbours, with a synaptic event at 2 ms and a stimulus from 10 ms on
+    // the first cell. The gap junctions of the last cell can be left out to
+    // list the junction with its neighbour on that cell only.
+    class gj_chain_recipe: public recipe {
+    public:
+        gj_chain_recipe(cell_size_type n, bool symmetric = true):
+            n_(n), symmetric_(symmetric)
+        {
+            gprop_.default_parameters = neuron_parameter_defaults;
+        }
+
+        cell_size_type num_cells() const override { return n_; }
+
+        cell_kind get_cell_kind(cell_gid_type) const override {
+            return cell_kind::cable;
+        }
+
+        util::unique_any get_cell_description(cell_gid_type gid) const override {
+            auto c = make_cell_soma_only(gid==0);
+            c.place(mlocation{0, 0.5}, gap_junction_site{});
+            if (gid==0) {
+                c.place(mlocation{0, 0.5}, "expsyn");
+            }
+            return c;
+        }
+
+        cell_size_type num_targets(cell_gid_type gid) const override { return gid==0; }
+
+        std::vector<event_generator> event_generators(cell_gid_type gid) const override {
+            if (gid) return {};
+            return {explicit_generator(pse_vector{{{0, 0}, 2.0, 0.05}})};
+        }
+
+        cell_size_type num_probes(cell_gid_type) const override { return 1; }
+
+        probe_info get_probe(cell_member_type id) const override {
+            return {id, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage}};
+        }
+
+        cell_size_type num_gap_junction_sites(cell_gid_type) const override {
+            return 1;
+        }
+
+        std::vector<gap_junction_connection> gap_junctions_on(cell_gid_type gid) const override {
+            std::vector<gap_junction_connection> conns;
+            if (!symmetric_ && gid+1==n_) return conns;
+
+            if (gid>0) {
+                conns.push_back(gap_junction_connection({gid-1, 0}, {gid, 0}, 0.01));
+            }
+            if (gid+1<n_) {
+                conns.push_back(gap_junction_connection({gid+1, 0}, {gid, 0}, 0.01));
+            }
+            return conns;
+        }
+
+        util::any get_global_properties(cell_kind) const override {
+            return gprop_;
+        }
+
+    private:
+        cell_size_type n_;
+        bool symmetric_;
+        cable_cell_global_properties gprop_;
+    };
+
+    // Run the chain for 30 ms, with the cells in one cell group or split
+    // across groups of group_size cells, and sample the voltage of each
+    // cell every 0.5 ms.
+    std::vector<std::vector<double>> run_chain(const gj_chain_recipe& rec, std::size_t group_size, double interval = 0) {
+        auto ctx = make_context();
+
+        partition_hint_map hints;
+        if (group_size) {
+            hints[cell_kind::cable].cpu_group_size = group_size;
+            hints[cell_kind::cable].prefer_gpu = false;
+            hints[cell_kind::cable].split_gap_junctions = true;
+        }
+        auto decomp = partition_load_balance(rec, ctx, hints);
+
+        std::vector<std::vector<double>> traces(rec.num_cells());
+        sampler_function sampler = [&](cell_member_type pid, probe_tag, std::size_t n, const sample_record* records) {
+            for (std::size_t i = 0; i<n; ++i) {
+                traces[pid.gid].push_back(*util::any_cast<const double*>(records[i].data));
+            }
+        };
+
+        simulation sim(rec, decomp, ctx);
+        sim.set_gap_junction_interval(interval);
+        sim.add_sampler(all_probes, regular_schedule(0.5), sampler);
+        sim.run(30, 0.025);
+
+        return traces;
+    }
+
+    double max_difference(const std::vector<double>& a, const std::vector<double>& b) {
+        EXPECT_EQ(a.size(), b.size());
+
+        double d = 0;
+        for (auto i: util::count_along(a)) {
+            d = std::max(d, std::abs(a[i]-b[i]));
+        }
+        return d;
+    }
+}
+
+TEST(halo_exchange, split_groups) {
+    gj_chain_recipe rec(4);
+
+    auto ref = run_chain(rec, 0);
+    auto split = run_chain(rec, 1);
+    auto pairs = run_chain(rec, 2);
+
+    // The synaptic event depolarizes the first cell. The stimulated cell
+    // then spikes, and drives the others through the gap junctions.
+    for (auto gid: util::make_span(rec.num_cells())) {
+        ASSERT_FALSE(ref[gid].empty());
+    }
+    EXPECT_LT(1., ref[0][6]-ref[0][4]);
+    EXPECT_LT(0., *std::max_element(ref[0].begin(), ref[0].end()));
+    EXPECT_LT(5., *std::max_element(ref[1].begin(), ref[1].end())-ref[1].front());
+
+    // Coupling between groups lags one step: the traces match to within
+    // a fraction of a mV.
+    for (auto gid: util::make_span(rec.num_cells())) {
+        EXPECT_GT(0.5, max_difference(ref[gid], split[gid]));
+        EXPECT_GT(0.5, max_difference(ref[gid], pairs[gid]));
+    }
+}
+
+TEST(halo_exchange, interval) {
+    gj_chain_recipe rec(2);
+
+    auto ref = run_chain(rec, 0);
+    auto step = run_chain(rec, 1);
+    auto coarse = run_chain(rec, 1, 0.5);
+
+    // Exchanging less often than every step loses accuracy, but the cells
+    // remain coupled: they spike within a sample of the reference.
+    auto peak = [](const std::vector<double>& trace) {
+        return std::max_element(trace.begin(), trace.end())-trace.begin();
+    };
+
+    for (auto gid: util::make_span(rec.num_cells())) {
+        auto d_step = max_difference(ref[gid], step[gid]);
+        auto d_coarse = max_difference(ref[gid], coarse[gid]);
+        EXPECT_GT(d_coarse, d_step);
+        EXPECT_GE(1, std::abs(peak(ref[gid])-peak(coarse[gid])));
+    }
+}
+
+TEST(halo_exchange, asymmetric_junction) {
+    // A gap junction between cell groups listed on one cell only.
+    gj_chain_recipe rec(2, false);
+    EXPECT_THROW(run_chain(rec, 1), gj_unsupported_domain_decomposition);
+
+    // Within one cell group it is coupled as before.
+    EXPECT_NO_THROW(run_chain(rec, 0));
+}
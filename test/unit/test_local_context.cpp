@@ -93,3 +93,19 @@ TEST(local_context, gather_gids)
     EXPECT_EQ(part[0], 0u);
     EXPECT_EQ(part[1], gids.size());
 }
+
+TEST(local_context, gather_halo)
+{
+    arb::local_context ctx;
+    using hvec = std::vector<arb::fvm_value_type>;
+
+    hvec values = {-65., -64.5, -70.};
+
+    auto s = ctx.gather_halo(values);
+
+    auto& part = s.partition();
+    EXPECT_EQ(s.values(), values);
+    EXPECT_EQ(part.size(), 2u);
+    EXPECT_EQ(part[0], 0u);
+    EXPECT_EQ(part[1], values.size());
+}
@@ -1,4 +1,5 @@
 #include <numeric>
+#include <random>
 #include <vector>
 
 #include "../gtest.h"
@@ -7,6 +8,10 @@
 
 #include "matrix.hpp"
 #include "backends/multicore/fvm.hpp"
+#include "backends/multicore/matrix_state_diagonal.hpp"
+#include "backends/multicore/matrix_state_fine.hpp"
+#include "backends/multicore/matrix_state_interleaved.hpp"
+#include "execution_context.hpp"
 #include "util/rangeutil.hpp"
 #include "util/span.hpp"
 
@@ -14,7 +19,8 @@
 
 using namespace arb;
 
-using matrix_type = matrix<arb::multicore::backend>;
+using matrix_type = matrix<arb::multicore::backend,
+    arb::multicore::matrix_state<fvm_value_type, fvm_index_type>>;
 using index_type = matrix_type::index_type;
 using value_type = matrix_type::value_type;
 
@@ -182,3 +188,256 @@ TEST(matrix, zero_diagonal_assembled)
     EXPECT_TRUE(testing::seq_almost_eq<double>(expected, x));
 }
 
+
+namespace {
+    // Random cell trees of max_size/2 to max_size CVs, with random
+    // capacitance, face conductance and area, for comparing solvers.
+    struct random_cells {
+        std::vector<index_type> p, cell_cv_divs, cell_to_intdom;
+        vvec cap, cond, area;
+
+        // A CV branches off a random earlier CV with probability p_branch,
+        // and otherwise continues from the previous CV.
+        random_cells(unsigned n_cell, unsigned max_size, unsigned seed = 0, double p_branch = 1) {
+            std::minstd_rand gen(seed);
+            std::uniform_int_distribution<index_type> size_dist((max_size+1)/2, max_size);
+            std::uniform_real_distribution<value_type> value_dist(1, 2);
+            std::bernoulli_distribution branch_dist(p_branch);
+
+            cell_cv_divs.push_back(0);
+            for (auto c: util::make_span(n_cell)) {
+                index_type first = p.size();
+                index_type size = size_dist(gen);
+                for (auto i: util::make_span(size)) {
+                    index_type parent = first;
+                    if (i) {
+                        parent += branch_dist(gen)? std::uniform_int_distribution<index_type>(0, i-1)(gen): i-1;
+                    }
+                    p.push_back(parent);
+                }
+                cell_cv_divs.push_back(p.size());
+                cell_to_intdom.push_back(c);
+            }
+
+            // There is no face conductance at the root of a cell.
+            for (auto i: util::make_span(p.size())) {
+                cap.push_back(value_dist(gen));
+                cond.push_back(p[i]==index_type(i)? 0: value_dist(gen));
+                area.push_back(1e3*value_dist(gen));
+            }
+        }
+    };
+
+    template <typename State, typename... Args>
+    void compare_with_flat(const random_cells& cells, Args&&... args) {
+        using flat_state = arb::multicore::matrix_state<value_type, index_type>;
+        using array = flat_state::array;
+
+        flat_state flat(cells.p, cells.cell_cv_divs, cells.cap, cells.cond, cells.area, cells.cell_to_intdom);
+        State state(cells.p, cells.cell_cv_divs, cells.cap, cells.cond, cells.area, cells.cell_to_intdom, args...);
+
+        auto n_cell = cells.cell_to_intdom.size();
+        auto n = cells.p.size();
+
+        // Set every third cell frozen with a zero dt.
+        array dt(n_cell);
+        for (auto c: util::make_span(n_cell)) {
+            dt[c] = c%3==1? 0: 0.025*(1+c%5);
+        }
+
+        array v(n), i(n), g(n);
+        for (auto k: util::make_span(n)) {
+            v[k] = -65.+k%7;
+            i[k] = 0.1*(k%11)-0.5;
+            g[k] = 0.01*(k%13);
+        }
+
+        flat.assemble(dt, v, i, g);
+        flat.solve();
+        state.assemble(dt, v, i, g);
+        state.solve();
+
+        // Sweeps in a different order give different rounding.
+        const auto& x = flat.solution();
+        const auto& y = state.solution();
+        ASSERT_EQ(x.size(), y.size());
+        for (auto k: util::make_span(n)) {
+            EXPECT_NEAR(x[k], y[k], 1e-10*std::fabs(x[k]));
+        }
+
+        // Solving into a separate array gives the same solution, with
+        // frozen cells left at their voltage.
+        State state_to(cells.p, cells.cell_cv_divs, cells.cap, cells.cond, cells.area, cells.cell_to_intdom, args...);
+        array to = v;
+        state_to.assemble(dt, v, i, g);
+        state_to.solve(to);
+        for (auto k: util::make_span(n)) {
+            EXPECT_EQ(y[k], to[k]);
+        }
+    }
+}
+
+TEST(matrix, assemble)
+{
+    using state_type = arb::multicore::matrix_state<value_type, index_type>;
+    using array = state_type::array;
+
+    // Cell sizes are not multiples of the SIMD width.
+    random_cells cells(7, 13);
+    state_type m(cells.p, cells.cell_cv_divs, cells.cap, cells.cond, cells.area, cells.cell_to_intdom);
+
+    auto n = cells.p.size();
+    array dt = {0.025, 0, 0.01, 0.025, -1, 0.1, 0.025};
+    array v(n), i(n), g(n);
+    for (auto k: util::make_span(n)) {
+        v[k] = -65.+k%7;
+        i[k] = 0.1*(k%11)-0.5;
+        g[k] = 0.01*(k%13);
+    }
+
+    m.assemble(dt, v, i, g);
+
+    for (auto c: util::make_span(7)) {
+        for (auto k: util::make_span(cells.cell_cv_divs[c], cells.cell_cv_divs[c+1])) {
+            if (dt[c]>0) {
+                auto area_factor = 1e-3*cells.area[k];
+                auto gi = 1e-3/dt[c]*cells.cap[k] + area_factor*g[k];
+
+                EXPECT_DOUBLE_EQ(gi+m.invariant_d[k], m.d[k]);
+                EXPECT_DOUBLE_EQ(gi*v[k]-area_factor*i[k], m.rhs[k]);
+            }
+            else {
+                EXPECT_EQ(0., m.d[k]);
+                EXPECT_EQ(v[k], m.rhs[k]);
+            }
+        }
+    }
+}
+
+TEST(matrix, solve_to)
+{
+    using state_type = arb::multicore::matrix_state<value_type, index_type>;
+
+    for (auto n_cell: {1u, 7u, 30u}) {
+        compare_with_flat<state_type>(random_cells(n_cell, 13, n_cell));
+    }
+}
+
+TEST(matrix, interleaved_storage)
+{
+    using state_type = arb::multicore::matrix_state_interleaved<value_type, index_type, 4>;
+
+    // Five cells of sizes 2, 3, 1, 3 and 2 are stored in two blocks with
+    // 3 rows and 1 row respectively.
+    std::vector<index_type> p = {0, 0,  2, 2, 3,  5,  6, 6, 7,  9, 9};
+    std::vector<index_type> c = {0, 2, 5, 6, 9, 11};
+    vvec ones(11, 1.);
+
+    state_type m(p, c, ones, ones, ones, {0, 1, 2, 3, 4});
+    EXPECT_TRUE(testing::seq_eq(std::vector<index_type>({0, 12, 16}), m.block_divs));
+    EXPECT_EQ(16u, arb::multicore::interleaved_storage_size(c, 4));
+
+    // Block 0 holds cells 1, 3, 0 and 4 in lanes 0 to 3; block 1 holds cell 2.
+    std::vector<index_type> expected_cv = {
+        2, 6, 0, 9,   3, 7, 1, 10,   4, 8, 0, 9,
+        5, 0, 0, 0
+    };
+    EXPECT_TRUE(testing::seq_eq(expected_cv, m.cv_index));
+
+    // Padding rows are parented by the first row of their lane.
+    std::vector<index_type> expected_parent = {
+        0, 1, 2, 3,   0, 1, 2, 3,   4, 5, 2, 3,
+        12, 13, 14, 15
+    };
+    EXPECT_TRUE(testing::seq_eq(expected_parent, m.parent_index));
+}
+
+TEST(matrix, interleaved_solve)
+{
+    using namespace arb::multicore;
+
+    for (unsigned n_cell: {1u, 3u, 4u, 17u, 64u}) {
+        random_cells cells(n_cell, 40, n_cell);
+
+        compare_with_flat<matrix_state_interleaved<value_type, index_type, 4>>(cells);
+        compare_with_flat<matrix_state_interleaved<value_type, index_type, 8>>(cells);
+        compare_with_flat<matrix_state_interleaved<value_type, index_type>>(cells);
+        compare_with_flat<matrix_state_dispatch<value_type, index_type>>(cells);
+    }
+}
+
+TEST(matrix, fine_solve)
+{
+    using namespace arb::multicore;
+    using state_type = matrix_state_fine<value_type, index_type>;
+
+    execution_context context(proc_allocation{4, -1});
+
+    // Branchy and mostly unbranched cells, large enough that levels are
+    // split over several tasks, mixed with small cells.
+    for (double p_branch: {1., 0.01}) {
+        for (unsigned n_cell: {1u, 5u, 20u}) {
+            random_cells cells(n_cell, 20000/n_cell, n_cell, p_branch);
+
+            state_type m(cells.p, cells.cell_cv_divs, cells.cap, cells.cond, cells.area, cells.cell_to_intdom, context);
+            if (n_cell==1 && p_branch==1) {
+                // Some level has more than one task.
+                EXPECT_GT(m.task_divs.size()-1, m.num_levels());
+            }
+
+            compare_with_flat<state_type>(cells, context);
+        }
+    }
+
+    // Single CV cells.
+    compare_with_flat<state_type>(random_cells(10, 1), context);
+}
+
+TEST(matrix, diagonal_solve)
+{
+    using namespace arb::multicore;
+    using state_type = matrix_state_diagonal<value_type, index_type>;
+
+    for (unsigned n_cell: {1u, 3u, 4u, 17u, 64u}) {
+        random_cells cells(n_cell, 1, n_cell);
+        EXPECT_TRUE(state_type(cells.p, cells.cell_cv_divs, cells.cap, cells.cond, cells.area, cells.cell_to_intdom).intdom_identity);
+        compare_with_flat<state_type>(cells);
+
+        // Pairs of cells in one integration domain, as if coupled by gap
+        // junctions.
+        for (auto& i: cells.cell_to_intdom) i /= 2;
+        EXPECT_EQ(n_cell==1, state_type(cells.p, cells.cell_cv_divs, cells.cap, cells.cond, cells.area, cells.cell_to_intdom).intdom_identity);
+        compare_with_flat<state_type>(cells);
+    }
+}
+
+TEST(matrix, dispatch)
+{
+    using namespace arb::multicore;
+    using state_type = matrix_state_dispatch<value_type, index_type>;
+    constexpr unsigned width = state_type::interleaved_state::block_width;
+
+    // Many cells of equal size interleave, if the target has SIMD support.
+    std::vector<index_type> divs;
+    for (auto c: util::make_span(4*width+1)) {
+        divs.push_back(10*c);
+    }
+    EXPECT_EQ(width>1? matrix_solver::interleaved: matrix_solver::flat, state_type::select_solver(divs, 1));
+
+    // A single cell is never interleaved, nor are large cells.
+    EXPECT_EQ(matrix_solver::flat, state_type::select_solver({0, 100}, 1));
+
+    for (auto& d: divs) d *= 100;
+    EXPECT_EQ(matrix_solver::flat, state_type::select_solver(divs, 1));
+
+    // Very large cells are solved over branches, given threads to do so.
+    index_type n = state_type::min_fine_cell_size;
+    EXPECT_EQ(matrix_solver::flat, state_type::select_solver({0, n}, 1));
+    EXPECT_EQ(matrix_solver::fine, state_type::select_solver({0, n}, 4));
+    EXPECT_EQ(matrix_solver::fine, state_type::select_solver({0, 10, 20, 20+n}, 4));
+
+    // Groups of single-CV cells have a diagonal matrix.
+    EXPECT_EQ(matrix_solver::diagonal, state_type::select_solver({0, 1}, 1));
+    EXPECT_EQ(matrix_solver::diagonal, state_type::select_solver({0, 1, 2, 3}, 4));
+    EXPECT_EQ(matrix_solver::flat, state_type::select_solver({0, 1, 3}, 1));
+}
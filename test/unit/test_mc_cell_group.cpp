@@ -1,13 +1,25 @@
 #include "../gtest.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+
+#include <arbor/binary_trace_writer.hpp>
 #include <arbor/common_types.hpp>
+#include <arbor/load_balance.hpp>
+#include <arbor/schedule.hpp>
+#include <arbor/simple_sampler.hpp>
+#include <arbor/simulation.hpp>
 
 #include "epoch.hpp"
 #include "fvm_lowered_cell.hpp"
+#include "fvm_lowered_cell_blocked.hpp"
 #include "mc_cell_group.hpp"
 #include "util/rangeutil.hpp"
+#include "util/span.hpp"
 
 #include "common.hpp"
+#include "instrument_malloc.hpp"
 #include "../common_cells.hpp"
 #include "../simple_recipes.hpp"
 
@@ -98,3 +110,421 @@ TEST(mc_cell_group, sources) {
     }
 }
 
+TEST(mc_cell_group, sampler_plan) {
+    std::vector<cable_cell> cells;
+    for (int i = 0; i<3; ++i) {
+        cable_cell c = soma_cell_builder(6).make_cell();
+        c.paint("soma", "pas");
+        c.place(mlocation{0, 0.5}, i_clamp{0.2, 5, 0.1*(i+1)});
+        cells.push_back(std::move(c));
+    }
+
+    auto rec = cable1d_recipe(cells);
+    for (cell_gid_type gid: {0u, 1u, 2u}) {
+        rec.add_probe(gid, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage});
+    }
+
+    mc_cell_group group{{0, 1, 2}, rec, lowered_cell()};
+
+    // Sampler a takes every probe on a fine schedule; sampler b takes probe
+    // {1, 0} at times which coincide with a's samples.
+    trace_data<double> a[3], b;
+    auto a_sampler = [&a](cell_member_type pid, probe_tag, std::size_t n, const sample_record* recs) {
+        for (std::size_t i = 0; i<n; ++i) {
+            a[pid.gid].push_back({recs[i].time, *util::any_cast<const double*>(recs[i].data)});
+        }
+    };
+
+    group.add_sampler(0, all_probes, regular_schedule(0.01), a_sampler, sampling_policy::lax);
+    group.add_sampler(1, one_probe({1, 0}), explicit_schedule({0.31f, 0.91f, 1.51f, 2.31f}), make_simple_sampler(b), sampling_policy::lax);
+
+    group.advance(epoch(0, 2), 0.025, {});
+
+    ASSERT_EQ(3u, b.size());
+    for (auto& tr: a) {
+        ASSERT_EQ(200u, tr.size());
+        EXPECT_TRUE(std::is_sorted(tr.begin(), tr.end(), [](auto& x, auto& y) { return x.t<y.t; }));
+    }
+
+    for (auto& e: b) {
+        auto i = std::find_if(a[1].begin(), a[1].end(), [&](auto& x) { return x.t==e.t; });
+        ASSERT_NE(a[1].end(), i);
+        EXPECT_EQ(i->v, e.v);
+    }
+    // Distinct stimuli give distinct traces.
+    EXPECT_NE(a[0].back().v, a[1].back().v);
+
+    // Removing a sampler takes effect in the next epoch.
+    group.remove_sampler(0);
+    group.advance(epoch(1, 3), 0.025, {});
+
+    EXPECT_EQ(200u, a[0].size());
+    EXPECT_EQ(4u, b.size());
+
+    // Samplers added after a reset are included in the plan.
+    group.reset();
+    b.clear();
+    group.add_sampler(2, one_probe({2, 0}), regular_schedule(0.5), a_sampler, sampling_policy::lax);
+    group.advance(epoch(0, 2), 0.025, {});
+
+    EXPECT_EQ(3u, b.size());
+    EXPECT_EQ(4u, a[2].size()-200);
+}
+
+TEST(mc_cell_group, bulk_samplers) {
+    std::vector<cable_cell> cells;
+    for (int i = 0; i<2; ++i) {
+        cable_cell c = soma_cell_builder(6).make_cell();
+        c.paint("soma", "pas");
+        c.place(mlocation{0, 0.5}, i_clamp{0.2, 5, 0.1*(i+1)});
+        cells.push_back(std::move(c));
+    }
+
+    auto rec = cable1d_recipe(cells);
+    for (cell_gid_type gid: {0u, 1u}) {
+        rec.add_probe(gid, 10+gid, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage});
+    }
+
+    mc_cell_group group{{0, 1}, rec, lowered_cell()};
+
+    // General sampler, simple sampler and binary trace writer on the same schedule
+    // should see the same samples.
+    trace_data<double> general[2], simple;
+    group.add_sampler(0, all_probes, regular_schedule(0.1),
+        [&general](cell_member_type pid, probe_tag, std::size_t n, const sample_record* recs) {
+            for (std::size_t i = 0; i<n; ++i) {
+                general[pid.gid].push_back({recs[i].time, *util::any_cast<const double*>(recs[i].data)});
+            }
+        },
+        sampling_policy::lax);
+    group.add_sampler(1, one_probe({1, 0}), regular_schedule(0.1), make_simple_sampler(simple), sampling_policy::lax);
+
+    std::stringstream out;
+    group.add_sampler(2, all_probes, regular_schedule(0.1), binary_trace_writer(out), sampling_policy::lax);
+
+    group.advance(epoch(0, 1), 0.025, {});
+    group.advance(epoch(1, 2), 0.025, {});
+
+    ASSERT_EQ(20u, general[1].size());
+    ASSERT_EQ(general[1].size(), simple.size());
+    for (auto i: util::count_along(simple)) {
+        EXPECT_EQ(general[1][i].t, simple[i].t);
+        EXPECT_EQ(general[1][i].v, simple[i].v);
+    }
+
+    // Expect one record per probe per epoch.
+    trace_data<double> written[2];
+    unsigned n_records = 0;
+    std::uint32_t header[4];
+    while (out.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        ++n_records;
+        cell_member_type pid{header[0], header[1]};
+        EXPECT_EQ(10+pid.gid, header[2]);
+        EXPECT_EQ(0u, pid.index);
+
+        std::vector<double> time(header[3]), value(header[3]);
+        out.read(reinterpret_cast<char*>(time.data()), header[3]*sizeof(double));
+        out.read(reinterpret_cast<char*>(value.data()), header[3]*sizeof(double));
+        for (auto i: util::make_span(header[3])) {
+            written[pid.gid].push_back({time_type(time[i]), value[i]});
+        }
+    }
+
+    EXPECT_EQ(4u, n_records);
+    for (cell_gid_type gid: {0u, 1u}) {
+        ASSERT_EQ(general[gid].size(), written[gid].size());
+        for (auto i: util::count_along(written[gid])) {
+            EXPECT_EQ(general[gid][i].t, written[gid][i].t);
+            EXPECT_EQ(general[gid][i].v, written[gid][i].v);
+        }
+    }
+}
+
+TEST(mc_cell_group, reduction_probes) {
+    cable_cell c = soma_cell_builder(6).make_cell();
+    c.paint("soma", "pas");
+    auto rec = cable1d_recipe(c);
+
+    // One soma CV: a histogram with two bins holds one count.
+    using reduction = cell_probe_reduction;
+    rec.add_probe(0, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage});
+    rec.add_probe(0, 0, reduction{{}, cell_probe_address::membrane_voltage, reduction::histogram, {-1000, -60, 1000}});
+    rec.add_probe(0, 0, reduction{{}, cell_probe_address::membrane_voltage, reduction::mean, {}});
+
+    mc_cell_group group{{0}, rec, lowered_cell()};
+
+    std::vector<std::vector<double>> general(3);
+    group.add_sampler(0, all_probes, regular_schedule(0.1),
+        [&general](cell_member_type pid, probe_tag, std::size_t n, const sample_record* recs) {
+            for (std::size_t i = 0; i<n; ++i) {
+                auto p = util::any_cast<const double*>(recs[i].data);
+                general[pid.index].push_back(p[0]);
+                if (pid.index==1) general[pid.index].push_back(p[1]);
+            }
+        },
+        sampling_policy::lax);
+
+    std::vector<double> bulk;
+    group.add_sampler(1, one_probe({0, 1}), regular_schedule(0.1),
+        [&bulk](cell_member_type pid, probe_tag, std::size_t n, const double*, const double* value) {
+            bulk.insert(bulk.end(), value, value+2*n);
+        },
+        sampling_policy::lax);
+
+    group.advance(epoch(0, 1), 0.025, {});
+
+    ASSERT_EQ(10u, general[0].size());
+    EXPECT_EQ(general[0], general[2]);
+    ASSERT_EQ(20u, general[1].size());
+    EXPECT_EQ(general[1], bulk);
+    for (auto i: util::make_span(10)) {
+        EXPECT_EQ(1., general[1][2*i]+general[1][2*i+1]);
+    }
+}
+
+TEST(mc_cell_group, probe_selectors) {
+    std::vector<cable_cell> cells;
+    for (int i = 0; i<8; ++i) {
+        cable_cell c = soma_cell_builder(6).make_cell();
+        c.paint("soma", "pas");
+        cells.push_back(std::move(c));
+    }
+
+    auto rec = cable1d_recipe(cells);
+    for (cell_gid_type gid: util::make_span(8)) {
+        rec.add_probe(gid, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage});
+        rec.add_probe(gid, 1, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_current});
+    }
+
+    using pvec = std::vector<cell_member_type>;
+    auto sampled = [&](probe_selector sel) {
+        mc_cell_group group{{2, 3, 5, 7}, rec, lowered_cell()};
+
+        pvec ids;
+        group.add_sampler(0, std::move(sel), explicit_schedule({0.5f}),
+            [&ids](cell_member_type pid, probe_tag, std::size_t, const sample_record*) { ids.push_back(pid); },
+            sampling_policy::lax);
+        group.advance(epoch(0, 1), 0.025, {});
+
+        util::sort(ids);
+        return ids;
+    };
+
+    EXPECT_EQ((pvec{{2, 0}, {2, 1}, {3, 0}, {3, 1}, {5, 0}, {5, 1}, {7, 0}, {7, 1}}), sampled(all_probes));
+    EXPECT_EQ((pvec{{5, 1}}), sampled(one_probe({5, 1})));
+    EXPECT_EQ((pvec{}), sampled(one_probe({4, 0})));
+    EXPECT_EQ((pvec{{3, 0}, {3, 1}, {5, 0}, {5, 1}}), sampled(probes_in_gid_range(3, 7)));
+    EXPECT_EQ((pvec{}), sampled(probes_in_gid_range(7, 3)));
+    EXPECT_EQ((pvec{{2, 0}, {2, 1}, {7, 0}, {7, 1}}), sampled(probes_on_gids({7, 0, 2, 7})));
+    EXPECT_EQ((pvec{{2, 1}, {3, 1}, {5, 1}, {7, 1}}), sampled([](cell_member_type pid) { return pid.index==1; }));
+
+    // Selectors on a simulation are passed only to the owning cell groups,
+    // with the same result.
+    auto sim_sampled = [&](probe_selector sel) {
+        auto ctx = make_context();
+        simulation sim(rec, partition_load_balance(rec, ctx), ctx);
+
+        pvec ids;
+        sim.add_sampler(std::move(sel), explicit_schedule({0.5f}),
+            [&ids](cell_member_type pid, probe_tag, std::size_t, const sample_record*) { ids.push_back(pid); });
+        sim.run(1, 0.025);
+
+        util::sort(ids);
+        return ids;
+    };
+
+    EXPECT_EQ((pvec{{5, 1}}), sim_sampled(one_probe({5, 1})));
+    EXPECT_EQ((pvec{{3, 0}, {3, 1}, {4, 0}, {4, 1}}), sim_sampled(probes_in_gid_range(3, 5)));
+    EXPECT_EQ((pvec{{0, 0}, {0, 1}, {6, 0}, {6, 1}}), sim_sampled(probes_on_gids({6, 0})));
+    EXPECT_EQ(16u, sim_sampled(all_probes).size());
+}
+
+TEST(mc_cell_group, integration_blocks) {
+    using svec = std::vector<fvm_size_type>;
+
+    // One cell per integration domain.
+    EXPECT_EQ((svec{0, 2, 4}), fvm_integration_blocks({0, 1, 2, 3}, {3, 3, 3, 3}, 6));
+    EXPECT_EQ((svec{0, 1, 2, 3, 4}), fvm_integration_blocks({0, 1, 2, 3}, {3, 3, 3, 3}, 5));
+    EXPECT_EQ((svec{0, 4}), fvm_integration_blocks({0, 1, 2, 3}, {3, 3, 3, 3}, 100));
+
+    // A cell larger than the block size gets a block of its own.
+    EXPECT_EQ((svec{0, 1, 3}), fvm_integration_blocks({0, 1, 2}, {10, 1, 1}, 4));
+
+    // Cells 1 and 3 share an integration domain.
+    EXPECT_EQ((svec{0, 1, 4, 5}), fvm_integration_blocks({0, 1, 2, 1, 3}, {3, 3, 3, 3, 3}, 3));
+
+    EXPECT_EQ((svec{0}), fvm_integration_blocks({}, {}, 3));
+}
+
+namespace {
+    // Cells 1 and 4 are coupled by a gap junction, and so share an
+    // integration domain.
+    struct gj_span_recipe: cable1d_recipe {
+        template <typename Seq>
+        explicit gj_span_recipe(const Seq& cells): cable1d_recipe(cells) {}
+
+        cell_size_type num_gap_junction_sites(cell_gid_type gid) const override {
+            return gid==1 || gid==4;
+        }
+
+        std::vector<gap_junction_connection> gap_junctions_on(cell_gid_type gid) const override {
+            if (gid==1 || gid==4) return {gap_junction_connection({gid, 0}, {5-gid, 0}, 0.1)};
+            return {};
+        }
+    };
+}
+
+TEST(mc_cell_group, blocked_integration) {
+    std::vector<cable_cell> cells;
+    for (int i = 0; i<6; ++i) {
+        cable_cell c = make_cell();
+        c.place(mlocation{1, 0.5}, "expsyn");
+        if (i==1 || i==4) {
+            c.place(mlocation{0, 0.5}, gap_junction_site{});
+        }
+        if (i==3) {
+            c.place(mlocation{1, 0.3}, threshold_detector{-20});
+        }
+        cells.push_back(std::move(c));
+    }
+
+    using result = std::pair<std::vector<spike>, std::vector<trace_data<double>>>;
+
+    // Integration blocks of at most one cell.
+    auto run = [&cells](bool blocked) {
+        gj_span_recipe rec(cells);
+        rec.nernst_ion("na");
+        rec.nernst_ion("ca");
+        rec.nernst_ion("k");
+        rec.cable_global_properties().blocked_integration = blocked;
+        rec.cable_global_properties().integration_block_cvs = 1;
+        for (cell_gid_type gid: util::make_span(6)) {
+            rec.add_probe(gid, 0, cell_probe_address{{1, 0.5}, cell_probe_address::membrane_voltage});
+        }
+
+        auto cell = lowered_cell();
+        const auto& blocked_cell = dynamic_cast<const fvm_lowered_cell_blocked&>(*cell);
+        mc_cell_group group{{0, 1, 2, 3, 4, 5}, rec, std::move(cell)};
+        EXPECT_EQ(blocked? 3u: 1u, blocked_cell.num_blocks());
+
+        result r;
+        r.second.resize(6);
+        for (cell_gid_type gid: util::make_span(6)) {
+            group.add_sampler(gid, one_probe({gid, 0}), regular_schedule(0.5), make_simple_sampler(r.second[gid]), sampling_policy::lax);
+        }
+
+        // Synaptic input at different times on each cell.
+        std::vector<pse_vector> lanes(6);
+        for (cell_gid_type gid: util::make_span(6)) {
+            lanes[gid].push_back({{gid, 0}, time_type(1+gid), 0.1f});
+        }
+
+        group.advance(epoch(0, 10), 0.025, util::subrange_view(lanes, 0, 6));
+        group.advance(epoch(10, 20), 0.025, {});
+
+        r.first = group.spikes();
+        util::sort_by(r.first, [](const spike& s) { return std::make_pair(s.source, s.time); });
+        return r;
+    };
+
+    result unblocked = run(false);
+    result blocked = run(true);
+
+    ASSERT_FALSE(unblocked.first.empty());
+    ASSERT_EQ(unblocked.first.size(), blocked.first.size());
+    for (auto i: util::count_along(unblocked.first)) {
+        EXPECT_EQ(unblocked.first[i].source, blocked.first[i].source);
+        EXPECT_NEAR(unblocked.first[i].time, blocked.first[i].time, 1e-9);
+    }
+
+    for (cell_gid_type gid: util::make_span(6)) {
+        const auto& a = unblocked.second[gid];
+        const auto& b = blocked.second[gid];
+        ASSERT_EQ(40u, a.size());
+        ASSERT_EQ(a.size(), b.size());
+        for (auto i: util::count_along(a)) {
+            EXPECT_EQ(a[i].t, b[i].t);
+            EXPECT_NEAR(a[i].v, b[i].v, 1e-9);
+        }
+    }
+}
+
+#ifdef CAN_INSTRUMENT_MALLOC
+
+namespace {
+    struct count_group_allocs: testing::with_instrumented_malloc {
+        unsigned n_alloc = 0;
+
+        void on_malloc(std::size_t, const void*) override { ++n_alloc; }
+        void on_realloc(void*, std::size_t, const void*) override { ++n_alloc; }
+        void on_memalign(std::size_t, std::size_t, const void*) override { ++n_alloc; }
+    };
+
+    // Cells 0 and 1 are coupled by a gap junction, and so share
+    // an integration domain.
+    struct gj_pair_recipe: cable1d_recipe {
+        template <typename Seq>
+        explicit gj_pair_recipe(const Seq& cells): cable1d_recipe(cells) {}
+
+        cell_size_type num_gap_junction_sites(cell_gid_type gid) const override {
+            return gid<2;
+        }
+
+        std::vector<gap_junction_connection> gap_junctions_on(cell_gid_type gid) const override {
+            if (gid<2) return {gap_junction_connection({gid, 0}, {1-gid, 0}, 0.1)};
+            return {};
+        }
+    };
+}
+
+TEST(mc_cell_group, advance_no_alloc) {
+    std::vector<cable_cell> cells;
+    for (int i = 0; i<3; ++i) {
+        cable_cell c = soma_cell_builder(6).make_cell();
+        c.paint("soma", "pas");
+        c.place(mlocation{0, 0.5}, "expsyn");
+        c.place(mlocation{0, 0.5}, threshold_detector{-50});
+        c.place(mlocation{0, 0.5}, gap_junction_site{});
+        cells.push_back(std::move(c));
+    }
+
+    gj_pair_recipe rec(cells);
+    for (cell_gid_type gid: {0u, 1u, 2u}) {
+        rec.add_probe(gid, 0, cell_probe_address{{0, 0.5}, cell_probe_address::membrane_voltage});
+    }
+
+    mc_cell_group group{{0, 1, 2}, rec, lowered_cell()};
+
+    trace_data<double> trace;
+    trace.reserve(1000);
+    group.add_sampler(0, all_probes, regular_schedule(0.1), make_simple_sampler(trace), sampling_policy::lax);
+
+    // Lanes for two epochs of equal length, each with events for every cell.
+    const double t_epoch = 2;
+    std::vector<pse_vector> lanes[2];
+    for (unsigned e: {0u, 1u}) {
+        lanes[e].resize(3);
+        for (cell_gid_type gid: {0u, 1u, 2u}) {
+            for (double t: {0.2, 0.7, 1.1, 1.5}) {
+                lanes[e][gid].push_back({{gid, 0}, time_type(e*t_epoch+t+0.1*gid), 0.01f});
+            }
+        }
+    }
+
+    group.advance(epoch(0, t_epoch), 0.025, util::subrange_view(lanes[0], 0, 3));
+    group.clear_spikes();
+    std::size_t n_trace = trace.size();
+
+    auto lanes1 = util::subrange_view(lanes[1], 0, 3);
+    unsigned n_alloc = 0;
+    {
+        count_group_allocs A;
+        group.advance(epoch(1, 2*t_epoch), 0.025, lanes1);
+        n_alloc = A.n_alloc;
+    }
+
+    EXPECT_EQ(0u, n_alloc);
+    EXPECT_EQ(2*n_trace, trace.size());
+}
+
+#endif // def CAN_INSTRUMENT_MALLOC
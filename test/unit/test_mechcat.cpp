@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstdlib>
 #include <string>
 
 #include <arbor/arbexcept.hpp>
@@ -6,6 +8,8 @@
 #include <arbor/mechcat.hpp>
 #include <arbor/mechinfo.hpp>
 
+#include "util/strprintf.hpp"
+
 #include "common.hpp"
 
 using namespace std::string_literals;
@@ -173,6 +177,12 @@ struct fleeb_bar: bar_mechanism {
     mechanism_ptr clone() const override { return mechanism_ptr(new fleeb_bar()); }
 };
 
+// Implementation of fleeb for the bar backend registered for AVX2:
+
+struct avx2_fleeb_bar: fleeb_bar {
+    mechanism_ptr clone() const override { return mechanism_ptr(new avx2_fleeb_bar()); }
+};
+
 // Burble implementation:
 
 struct burble_bar: bar_mechanism {
@@ -443,4 +453,51 @@ TEST(mechcat, copy) {
     EXPECT_EQ(typeid(*fleeb2_inst.mech.get()), typeid(*fleeb2_inst2.mech.get()));
 }
 
+TEST(mechcat, simd_isa) {
+    auto cat = build_fake_catalogue();
+    cat.register_implementation<bar_backend>("fleeb", make_mech<bar_backend, avx2_fleeb_bar>(), simd_isa::avx2);
+
+    const char* env = std::getenv("ARB_SIMD_ISA");
+    std::string saved = env? env: "";
+
+    unsetenv("ARB_SIMD_ISA");
+    simd_isa cpu = runtime_simd_isa();
+
+    for (auto isa: {simd_isa::none, simd_isa::avx, simd_isa::avx2, simd_isa::avx512}) {
+        setenv("ARB_SIMD_ISA", util::to_string(isa).c_str(), 1);
+        EXPECT_EQ(std::min(isa, cpu), runtime_simd_isa());
 
+        // The AVX2 implementation is used by fleeb and its derivations
+        // whenever AVX2 is permitted; the foo backend has no AVX2 variant.
+
+        bool avx2 = std::min(isa, cpu)>=simd_isa::avx2;
+        for (auto name: {"fleeb", "fleeb1", "special_fleeb"}) {
+            auto inst = cat.instance<bar_backend>(name);
+            EXPECT_EQ(avx2, typeid(avx2_fleeb_bar)==typeid(*inst.mech.get()));
+            EXPECT_EQ(avx2? simd_isa::avx2: simd_isa::none, cat.instance_isa<bar_backend>(name));
+        }
+        EXPECT_EQ(simd_isa::none, cat.instance_isa<foo_backend>("fleeb"));
+
+        auto cat2 = cat;
+        EXPECT_EQ(cat.instance_isa<bar_backend>("fleeb"), cat2.instance_isa<bar_backend>("fleeb"));
+    }
+
+    setenv("ARB_SIMD_ISA", "sse", 1);
+    EXPECT_THROW(runtime_simd_isa(), arb::arbor_exception);
+
+    // An implementation only for an instruction set wider than permitted
+    // is unavailable.
+
+    mechanism_catalogue cat3;
+    cat3.add("fleeb", fleeb_info);
+    cat3.register_implementation<bar_backend>("fleeb", make_mech<bar_backend, avx2_fleeb_bar>(), simd_isa::avx2);
+    setenv("ARB_SIMD_ISA", "none", 1);
+    EXPECT_THROW(cat3.instance<bar_backend>("fleeb"), arb::no_such_implementation);
+
+    if (env) {
+        setenv("ARB_SIMD_ISA", saved.c_str(), 1);
+    }
+    else {
+        unsetenv("ARB_SIMD_ISA");
+    }
+}
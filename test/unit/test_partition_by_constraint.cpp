@@ -1,5 +1,6 @@
 #include "../gtest.h"
 
+#include <algorithm>
 #include <array>
 #include <forward_list>
 #include <string>
@@ -158,3 +159,66 @@ TEST(partition_by_constraint, partition_random) {
     }
 
 }
+
+TEST(partition_by_constraint, independent_order) {
+    // Many entries on a few indices, as for synapses on a soma, and one entry
+    // on each of a run of other indices.
+    std::vector<fvm_index_type> node_index;
+    for (int i = 0; i<19; ++i) node_index.push_back(0);
+    for (int i = 0; i<13; ++i) node_index.push_back(3);
+    for (int i = 0; i<30; ++i) node_index.push_back(10+i);
+
+    for (unsigned width: {1u, 2u, 4u, 8u}) {
+        SCOPED_TRACE(width);
+        auto order = multicore::make_independent_order(node_index, width);
+
+        // The order is a permutation, and entries with the same index keep
+        // their relative order.
+        ASSERT_EQ(node_index.size(), order.size());
+        std::vector<fvm_index_type> sorted(order);
+        std::sort(sorted.begin(), sorted.end());
+        for (unsigned i = 0; i<sorted.size(); ++i) {
+            EXPECT_EQ(fvm_index_type(i), sorted[i]);
+        }
+        for (unsigned i = 0; i<order.size(); ++i) {
+            for (unsigned j = i+1; j<order.size(); ++j) {
+                if (node_index[order[i]]==node_index[order[j]]) {
+                    EXPECT_LT(order[i], order[j]);
+                }
+            }
+        }
+
+        // Pad both orders with their last index, as for mechanism instances.
+        iarray layout(node_index.size()+width, node_index.back());
+        std::copy(node_index.begin(), node_index.end(), layout.begin());
+
+        iarray permuted(node_index.size()+width, 0);
+        for (unsigned j = 0; j<order.size(); ++j) {
+            permuted[j] = node_index[order[j]];
+        }
+        std::fill(permuted.begin()+order.size(), permuted.end(), permuted[order.size()-1]);
+
+        auto before = multicore::make_constraint_partition(layout, node_index.size(), width);
+        auto after = multicore::make_constraint_partition(permuted, node_index.size(), width);
+        EXPECT_LE(after.none.size(), before.none.size());
+
+        // Repeated indices are in adjacent lanes of each block.
+        for (unsigned i = 0; i<order.size(); i += width) {
+            for (unsigned j = i+1; j<i+width; ++j) {
+                EXPECT_LE(permuted[j-1], permuted[j]);
+            }
+        }
+
+        if (width==1) {
+            for (unsigned i = 0; i<order.size(); ++i) {
+                EXPECT_EQ(fvm_index_type(i), order[i]);
+            }
+        }
+        else {
+            // Constant blocks are kept; with the entries left over, only the
+            // last block, padded with its last index, repeats an index.
+            EXPECT_EQ(before.constant.size(), after.constant.size());
+            EXPECT_EQ(width>2? 1u: 0u, after.none.size());
+        }
+    }
+}
@@ -1,5 +1,9 @@
 #include "../gtest.h"
 
+#include <algorithm>
+#include <vector>
+
+#include <arbor/arbexcept.hpp>
 #include <arbor/common_types.hpp>
 #include <arbor/cable_cell.hpp>
 
@@ -7,6 +11,7 @@
 #include "backends/multicore/fvm.hpp"
 #include "fvm_lowered_cell_impl.hpp"
 #include "util/rangeutil.hpp"
+#include "util/span.hpp"
 
 #include "common.hpp"
 #include "../common_cells.hpp"
@@ -86,3 +91,95 @@ TEST(probe, fvm_lowered_cell) {
     EXPECT_EQ(voltage[0], *p0);
 }
 
+
+TEST(probe, fvm_lowered_cell_reduction) {
+    execution_context context;
+
+    cable_cell bs = make_cell_ball_and_stick(false);
+
+    i_clamp stim(0, 100, 0.3);
+    bs.place(mlocation{1, 1}, stim);
+
+    cable1d_recipe rec(bs);
+
+    mlocation loc0{0, 0};
+    mlocation loc1{1, 0.3};
+
+    using reduction = cell_probe_reduction;
+    rec.add_probe(0, 0, cell_probe_address{loc0, cell_probe_address::membrane_voltage});
+    rec.add_probe(0, 0, cell_probe_address{loc1, cell_probe_address::membrane_current});
+    rec.add_probe(0, 0, reduction{{}, cell_probe_address::membrane_voltage, reduction::mean, {}});
+    rec.add_probe(0, 0, reduction{{loc1}, cell_probe_address::membrane_current, reduction::sum, {}});
+    rec.add_probe(0, 0, reduction{{}, cell_probe_address::membrane_voltage, reduction::histogram, {-1000, -64.9, 1000}});
+    rec.add_probe(0, 0, reduction{{loc0, loc0}, cell_probe_address::membrane_voltage, reduction::mean, {}});
+
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map<probe_handle> probe_map;
+
+    fvm_cell lcell(context);
+    lcell.initialize({0}, rec, cell_to_intdom, targets, probe_map);
+
+    ASSERT_EQ(6u, probe_map.size());
+    EXPECT_EQ(1, probe_map.at({0, 2}).width);
+    EXPECT_EQ(2, probe_map.at({0, 4}).width);
+
+    // Take all samples at once, after a few integration steps. Values for
+    // probe j are stored from value_offset[j].
+
+    const time_type t_sample = 0.0475;
+    lcell.integrate(t_sample, 0.0025, {}, {});
+
+    auto& state = *(lcell.*fvm_state_ptr).get();
+    std::vector<fvm_value_type> voltage(state.voltage.begin(), state.voltage.begin()+state.n_cv);
+
+    sample_size_type value_offset[] = {0, 1, 2, 3, 4, 6};
+    std::vector<sample_event> samples;
+    for (cell_lid_type j: util::make_span(6)) {
+        const auto& pa = probe_map.at({0, j});
+        samples.push_back(sample_event{t_sample, 0, {pa.handle, (sample_size_type)j, value_offset[j], pa.width}});
+    }
+
+    auto result = lcell.integrate(0.05, 0.0025, {}, util::range_pointer_view(samples));
+    ASSERT_EQ(7u, result.sample_value.size());
+    const fvm_value_type* value = result.sample_value.data();
+
+    // Mean over all CVs is area-weighted.
+    ASSERT_EQ(4u, state.reductions.size());
+    double wsum = 0, wvsum = 0;
+    for (auto cv: util::make_span(voltage.size())) {
+        wsum += state.reduction_weight[cv];
+        wvsum += state.reduction_weight[cv]*voltage[cv];
+    }
+    EXPECT_DOUBLE_EQ(wvsum/wsum, value[2]);
+
+    // Sum of current density over one CV is current density times area.
+    auto loc1_area = state.reduction_weight[state.reductions[1].cv_begin];
+    EXPECT_NE(0., value[1]);
+    EXPECT_DOUBLE_EQ(loc1_area*value[1], value[3]);
+
+    // Histogram counts CVs.
+    auto n_below = std::count_if(voltage.begin(), voltage.end(), [](double v) { return v<-64.9; });
+    EXPECT_LT(0, n_below);
+    EXPECT_LT(n_below, (long)voltage.size());
+    EXPECT_EQ(n_below, value[4]);
+    EXPECT_EQ(voltage.size()-n_below, value[5]);
+
+    // Mean over a single CV is its value.
+    EXPECT_EQ(value[0], value[6]);
+    EXPECT_EQ(voltage[0], value[6]);
+}
+
+TEST(probe, bad_reduction) {
+    execution_context context;
+
+    cable1d_recipe rec(make_cell_ball_and_stick(false));
+    rec.add_probe(0, 0, cell_probe_reduction{{}, cell_probe_address::membrane_voltage, cell_probe_reduction::histogram, {-10}});
+
+    std::vector<target_handle> targets;
+    std::vector<fvm_index_type> cell_to_intdom;
+    probe_association_map<probe_handle> probe_map;
+
+    fvm_cell lcell(context);
+    EXPECT_THROW(lcell.initialize({0}, rec, cell_to_intdom, targets, probe_map), bad_probe_reduction);
+}
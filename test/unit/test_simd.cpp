@@ -490,6 +490,25 @@ TYPED_TEST_P(simd_value, mask_unpack) {
     }
 }
 
+TYPED_TEST_P(simd_value, mask_pack) {
+    using simd = TypeParam;
+    using mask = typename simd::simd_mask;
+    constexpr unsigned N = simd::width;
+
+    std::minstd_rand rng(1036);
+
+    for (unsigned i = 0; i<nrounds; ++i) {
+        bool b[N];
+        fill_random(b, rng);
+
+        unsigned long long packed = mask(b).pack();
+        for (unsigned j = 0; j<N; ++j) {
+            EXPECT_EQ(b[j], (bool)(packed&(1ull<<j)));
+        }
+        EXPECT_EQ(0ull, packed>>N);
+    }
+}
+
 TYPED_TEST_P(simd_value, maths) {
     // min, max, abs tests valid for both fp and int types.
 
@@ -565,7 +584,7 @@ TYPED_TEST_P(simd_value, simd_array_cast) {
     }
 }
 
-REGISTER_TYPED_TEST_CASE_P(simd_value, elements, element_lvalue, copy_to_from, copy_to_from_masked, construct_masked, arithmetic, compound_assignment, comparison, mask_elements, mask_element_lvalue, mask_copy_to_from, mask_unpack, maths, simd_array_cast, reductions);
+REGISTER_TYPED_TEST_CASE_P(simd_value, elements, element_lvalue, copy_to_from, copy_to_from_masked, construct_masked, arithmetic, compound_assignment, comparison, mask_elements, mask_element_lvalue, mask_copy_to_from, mask_unpack, mask_pack, maths, simd_array_cast, reductions);
 
 typedef ::testing::Types<
 
@@ -854,7 +873,38 @@ TYPED_TEST_P(simd_fp_value, log_special_values) {
     }
 }
 
-REGISTER_TYPED_TEST_CASE_P(simd_fp_value, fp_maths, exp_special_values, expm1_special_values, log_special_values);
+// Load and store with conversion to the other floating point type.
+
+TYPED_TEST_P(simd_fp_value, convert_to_from) {
+    using simd = TypeParam;
+    using fp = typename simd::scalar_type;
+    using other = std::conditional_t<std::is_same<fp, float>::value, double, float>;
+    constexpr unsigned N = simd::width;
+
+    std::minstd_rand rng(1015);
+
+    for (unsigned i = 0; i<nrounds; ++i) {
+        other a[N], b[N];
+        fp r[N], expected[N];
+
+        fill_random(a, rng);
+        for (unsigned j = 0; j<N; ++j) expected[j] = fp(a[j]);
+
+        simd s(a);
+        s.copy_to(r);
+        EXPECT_TRUE(testing::indexed_eq_n(N, expected, r));
+
+        fp u[N];
+        other expected_b[N];
+        fill_random(u, rng);
+        for (unsigned j = 0; j<N; ++j) expected_b[j] = other(u[j]);
+
+        simd(u).copy_to(b);
+        EXPECT_TRUE(testing::indexed_eq_n(N, expected_b, b));
+    }
+}
+
+REGISTER_TYPED_TEST_CASE_P(simd_fp_value, fp_maths, exp_special_values, expm1_special_values, log_special_values, convert_to_from);
 
 typedef ::testing::Types<
 
@@ -1156,6 +1206,21 @@ TYPED_TEST_P(simd_indirect, constrained_add) {
 
         EXPECT_TRUE(::testing::indexed_almost_eq_n(buflen, test, array));
 
+        // None: runs of repeated indices.
+
+        for (unsigned j = 1; j<N; ++j) {
+            offset[j] = offset[j-1]+(rng()%2);
+        }
+
+        make_test_array();
+        indirect(array, simd_index(offset), index_constraint::none) += simd(values);
+
+        EXPECT_TRUE(::testing::indexed_almost_eq_n(buflen, test, array));
+
+        make_test_array();
+        reduce_by_key(simd(values), array, simd_index(offset));
+
+        EXPECT_TRUE(::testing::indexed_almost_eq_n(buflen, test, array));
     }
 }
 
@@ -1,5 +1,9 @@
 #include "../gtest.h"
 
+#include <random>
+#include <vector>
+
+#include <arbor/math.hpp>
 #include <arbor/spike.hpp>
 
 #include <backends/multicore/fvm.hpp>
@@ -155,3 +159,78 @@ TEST(SPIKES_TEST_CLASS, threshold_watcher) {
     EXPECT_FALSE(watch.is_crossed(2));
 }
 
+
+// Compare against a scalar state machine with enough detectors to fill
+// several words of the crossing state and leave a partial SIMD block, some
+// of them watching the same CV with different thresholds.
+TEST(SPIKES_TEST_CLASS, threshold_watcher_many) {
+    using value_type = backend::value_type;
+    using index_type = backend::index_type;
+    using array = backend::array;
+    using iarray = backend::iarray;
+
+    execution_context context;
+    const unsigned n_cv = 100;
+    const unsigned n_watch = 151;
+    const unsigned n_cell = 3;
+
+    std::minstd_rand gen(7);
+    std::uniform_real_distribution<value_type> U(0, 1);
+
+    std::vector<index_type> index(n_watch);
+    std::vector<value_type> thresh(n_watch);
+    for (unsigned i = 0; i<n_watch; ++i) {
+        index[i] = (7*i)%n_cv;
+        thresh[i] = U(gen);
+    }
+
+    std::vector<value_type> v(n_cv);
+    array values(n_cv, 0);
+    iarray cell_index(n_cv, 0);
+    for (unsigned i = 0; i<n_cv; ++i) {
+        v[i] = U(gen);
+        values[i] = v[i];
+        cell_index[i] = i%n_cell;
+    }
+    array time_before(n_cell, 0.);
+    array time_after(n_cell, 0.);
+
+    backend::threshold_watcher watch(cell_index.data(), time_before.data(), time_after.data(), values.data(), index, thresh, context);
+
+    std::vector<bool> crossed(n_watch);
+    for (unsigned i = 0; i<n_watch; ++i) {
+        crossed[i] = v[index[i]]>=thresh[i];
+        EXPECT_EQ(crossed[i], watch.is_crossed(i));
+    }
+
+    std::vector<threshold_crossing> expected;
+    for (unsigned step = 1; step<=50; ++step) {
+        memory::copy(time_after, time_before);
+        memory::fill(time_after, value_type(step));
+
+        std::vector<value_type> v_prev = v;
+        for (unsigned i = 0; i<n_cv; ++i) {
+            v[i] = U(gen);
+            values[i] = v[i];
+        }
+        watch.test();
+
+        for (unsigned i = 0; i<n_watch; ++i) {
+            auto cv = index[i];
+            bool above = v[cv]>=thresh[i];
+            if (above && !crossed[i]) {
+                auto pos = (thresh[i]-v_prev[cv])/(v[cv]-v_prev[cv]);
+                expected.push_back({i, math::lerp(value_type(step-1), value_type(step), pos)});
+            }
+            crossed[i] = above;
+            EXPECT_EQ(crossed[i], watch.is_crossed(i));
+        }
+    }
+
+    const auto& crossings = watch.crossings();
+    ASSERT_EQ(expected.size(), crossings.size());
+    for (unsigned i = 0; i<expected.size(); ++i) {
+        EXPECT_EQ(expected[i].index, crossings[i].index);
+        EXPECT_DOUBLE_EQ(expected[i].time, crossings[i].time);
+    }
+}
@@ -31,6 +31,12 @@
 #include "mechanisms/read_eX.hpp"
 #include "mechanisms/write_multiple_eX.hpp"
 #include "mechanisms/write_eX.hpp"
+#include "mechanisms/single/hh.hpp"
+#include "mechanisms/single/expsyn.hpp"
+#include "mechanisms/table/hh.hpp"
+#include "mechanisms/table/nax.hpp"
+#include "mechanisms/table/kdrmt.hpp"
+#include "mechanisms/table/kamt.hpp"
 
 #include "../gtest.h"
 
@@ -74,6 +80,12 @@ mechanism_catalogue make_unit_test_catalogue() {
     ADD_MECH(cat, read_eX)
     ADD_MECH(cat, write_multiple_eX)
     ADD_MECH(cat, write_eX)
+    ADD_MECH(cat, hh_single)
+    ADD_MECH(cat, expsyn_single)
+    ADD_MECH(cat, hh_table)
+    ADD_MECH(cat, nax_table)
+    ADD_MECH(cat, kdrmt_table)
+    ADD_MECH(cat, kamt_table)
 
     return cat;
 }
@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+#coding: utf-8
+
+# Plot error against run time for the voltage integration schemes, from the
+# JSON output of the voltage_integration micro-benchmark:
+#
+#     voltage_integration --benchmark_format=json > vi.json
+#     plot_convergence.py vi.json -o convergence.pdf
+#
+# Benchmarks are named bench_voltage_integration/<active>/<scheme>/<steps>,
+# where active is 0 for the passive cell and 1 for the HH cell, and scheme
+# 0 for backward Euler and 1 for Crank–Nicolson. One panel is drawn per
+# cell, with one line per scheme, each point labelled with its time step.
+
+from __future__ import print_function
+
+import argparse
+import json
+import sys
+import matplotlib
+matplotlib.use('Agg')
+import matplotlib.pyplot as P
+
+cells = ['passive', 'HH']
+schemes = ['backward Euler', 'Crank–Nicolson']
+
+def parse_clargs():
+    P = argparse.ArgumentParser(description='Plot voltage integration convergence.')
+    P.add_argument('input', metavar='FILE', help='benchmark output in JSON format')
+    P.add_argument('-o', '--output', metavar='FILE', dest='outfile', default='convergence.pdf',
+                   help='save plot to file FILE')
+    return P.parse_args()
+
+def read_results(filename):
+    with open(filename) as f:
+        data = json.load(f)
+
+    results = {}
+    for b in data['benchmarks']:
+        name = b['name'].split('/')
+        if name[0]!='bench_voltage_integration' or b.get('run_type', 'iteration')!='iteration':
+            continue
+        active, scheme = int(name[1]), int(name[2])
+        results.setdefault((active, scheme), []).append((b['real_time'], b['error'], b['dt']))
+    return results
+
+def plot(results, outfile):
+    fig, axes = P.subplots(1, len(cells), figsize=(6*len(cells), 5))
+    for active, ax in enumerate(axes):
+        for scheme, label in enumerate(schemes):
+            points = sorted(results.get((active, scheme), []))
+            if not points:
+                continue
+            time, error, dt = zip(*points)
+            ax.loglog(time, error, marker='o', label=label)
+            for x, y, h in points:
+                ax.annotate('{:g}'.format(h), (x, y), textcoords='offset points', xytext=(4, 4), fontsize=8)
+        ax.set_title('{} cell'.format(cells[active]))
+        ax.set_xlabel('run time [ms]')
+        ax.set_ylabel('max soma voltage error [mV]')
+        ax.grid(True, which='both', alpha=0.3)
+        ax.legend()
+    fig.tight_layout()
+    fig.savefig(outfile)
+
+args = parse_clargs()
+results = read_results(args.input)
+if not results:
+    print('no voltage_integration benchmarks in '+args.input, file=sys.stderr)
+    sys.exit(1)
+plot(results, args.outfile)